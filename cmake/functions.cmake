@@ -26,6 +26,10 @@ endfunction()
 # Function: setup_implementation - NAME:       implementation sub‐directory name
 # (e.g. “mpi”) - PROJ_NAME:  project base name - BASE_DIR:   root source
 # directory - TESTS:      list of test executables to link against
+#
+# The hybrid MPI+threads implementation lives in an "all" directory. It needs
+# no extra setup: core_module_lib already carries MPI, OpenMP and TBB, and the
+# node-level helpers are in task/include/hybrid.hpp.
 # ============================================================================
 function(setup_implementation)
   # parse named args: NAME, PROJ_NAME, BASE_DIR; multi‐value: TESTS
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "performance/include/performance.hpp"
+#include "task/include/task.hpp"
+#include "util/include/tuning.hpp"
+#include "util/include/util.hpp"
+
+namespace ppc::performance {
+
+/// @brief One tuning parameter and the values to try; the first value is the task's default.
+struct TuneParam {
+  std::string name;
+  std::vector<std::int64_t> values;
+};
+
+enum class SearchStrategy : std::uint8_t {
+  /// Every combination of the values, for small spaces.
+  kGrid,
+  /// One parameter at a time: each pass tries all values of a parameter with the others fixed at their best so
+  /// far, until a pass brings no improvement. Needs the sum rather than the product of the value counts per pass.
+  kCoordinateDescent,
+};
+
+struct TuneTrial {
+  ppc::util::TuneConfig config;
+  double time_sec = 0.0;
+};
+
+struct TuneResult {
+  ppc::util::TuneConfig best;
+  double best_time_sec = std::numeric_limits<double>::infinity();
+  /// @brief Every measured configuration in the order it was tried.
+  std::vector<TuneTrial> trials;
+};
+
+namespace detail {
+
+inline void CheckSpace(const std::vector<TuneParam> &space) {
+  for (const auto &param : space) {
+    if (param.values.empty()) {
+      throw std::runtime_error("Tuning parameter '" + param.name + "' has no values to try");
+    }
+  }
+}
+
+// Measures each configuration once and keeps the best; returns false when the trial budget is used up
+class TrialRecorder {
+ public:
+  TrialRecorder(const std::function<double(const ppc::util::TuneConfig &)> &measure, std::size_t max_trials)
+      : measure_(measure), max_trials_(max_trials == 0 ? std::numeric_limits<std::size_t>::max() : max_trials) {}
+
+  bool Try(const ppc::util::TuneConfig &config) {
+    if (times_.contains(config)) {
+      return true;
+    }
+    if (result_.trials.size() >= max_trials_) {
+      return false;
+    }
+    const double time = measure_(config);
+    times_[config] = time;
+    result_.trials.push_back({.config = config, .time_sec = time});
+    if (time < result_.best_time_sec) {
+      result_.best_time_sec = time;
+      result_.best = config;
+    }
+    return true;
+  }
+
+  [[nodiscard]] const TuneResult &Result() const {
+    return result_;
+  }
+
+ private:
+  const std::function<double(const ppc::util::TuneConfig &)> &measure_;
+  std::size_t max_trials_;
+  std::map<ppc::util::TuneConfig, double> times_;
+  TuneResult result_;
+};
+
+}  // namespace detail
+
+/// @brief Searches @p space for the configuration with the smallest @p measure time.
+/// @param max_trials Upper limit on the number of measured configurations; 0 means no limit.
+/// @details Every configuration is measured once. With MPI, @p measure must return the same time on every rank
+/// (e.g. the critical-path time of Perf with the perf-test aggregation), so that all ranks take the same path.
+/// @throws std::runtime_error If a parameter has no values.
+inline TuneResult SearchConfig(const std::vector<TuneParam> &space,
+                               const std::function<double(const ppc::util::TuneConfig &)> &measure,
+                               SearchStrategy strategy, std::size_t max_trials = 0) {
+  detail::CheckSpace(space);
+  detail::TrialRecorder recorder(measure, max_trials);
+  ppc::util::TuneConfig config;
+  for (const auto &param : space) {
+    config[param.name] = param.values.front();
+  }
+
+  if (strategy == SearchStrategy::kGrid) {
+    std::vector<std::size_t> index(space.size(), 0);
+    while (recorder.Try(config)) {
+      // Odometer over the value indices, the last parameter changing fastest
+      std::size_t pos = space.size();
+      while (pos > 0 && ++index[pos - 1] == space[pos - 1].values.size()) {
+        index[pos - 1] = 0;
+        pos--;
+      }
+      if (pos == 0) {
+        break;
+      }
+      for (std::size_t i = 0; i < space.size(); i++) {
+        config[space[i].name] = space[i].values[index[i]];
+      }
+    }
+    return recorder.Result();
+  }
+
+  if (!recorder.Try(config)) {
+    return recorder.Result();
+  }
+  bool improved = true;
+  while (improved) {
+    improved = false;
+    for (const auto &param : space) {
+      auto candidate = recorder.Result().best;
+      for (const auto value : param.values) {
+        candidate[param.name] = value;
+        const double before = recorder.Result().best_time_sec;
+        if (!recorder.Try(candidate)) {
+          return recorder.Result();
+        }
+        improved = improved || recorder.Result().best_time_sec < before;
+      }
+    }
+  }
+  return recorder.Result();
+}
+
+/// @brief Mean time of the task made by @p make_task in the given mode, measured with Perf.
+template <typename InType, typename OutType>
+double MeasureTask(const std::function<ppc::task::TaskPtr<InType, OutType>()> &make_task, const PerfAttr &perf_attr,
+                   PerfResults::TypeOfRunning mode = PerfResults::TypeOfRunning::kTaskRun) {
+  Perf<InType, OutType> perf(make_task());
+  if (mode == PerfResults::TypeOfRunning::kPipeline) {
+    perf.PipelineRun(perf_attr);
+  } else if (mode == PerfResults::TypeOfRunning::kTaskRun) {
+    perf.TaskRun(perf_attr);
+  } else {
+    throw std::runtime_error("Autotuning measures kPipeline or kTaskRun runs only");
+  }
+  return perf.GetPerfResults().time_sec;
+}
+
+/// @brief Where and for which input an autotuning run stores its result.
+struct TuneTarget {
+  /// @brief Task namespace, the key the task passes to ppc::util::GetTunedValue().
+  std::string task;
+  /// @brief Input size the task passes to ppc::util::GetTunedValue().
+  std::uint64_t size = 0;
+  int num_proc = 1;
+  /// @brief Cache file to update; empty leaves the cache alone.
+  std::string cache_file = ppc::util::GetTuningCacheFile();
+};
+
+/// @brief Tunes a task: runs SearchConfig() with each configuration made visible to the task through
+/// ppc::util::ScopedTuneConfig, then stores the best one in the cache of @p target, which later runs of the task
+/// pick up in PreProcessing.
+/// @details With MPI this is collective: rank 0 of MPI_COMM_WORLD writes the file, and the other ranks wait for it
+/// before they reload the cache.
+/// @throws std::runtime_error On every rank if the cache file cannot be read or written.
+template <typename InType, typename OutType>
+TuneResult Autotune(const TuneTarget &target, const std::vector<TuneParam> &space,
+                    const std::function<ppc::task::TaskPtr<InType, OutType>()> &make_task, const PerfAttr &perf_attr,
+                    SearchStrategy strategy = SearchStrategy::kGrid, std::size_t max_trials = 0) {
+  auto result = SearchConfig(
+      space,
+      [&](const ppc::util::TuneConfig &config) {
+        const ppc::util::ScopedTuneConfig scoped(target.task, config);
+        return MeasureTask<InType, OutType>(make_task, perf_attr);
+      },
+      strategy, max_trials);
+  int mpi_initialized = 0;
+  MPI_Initialized(&mpi_initialized);
+  int rank = 0;
+  if (mpi_initialized != 0) {
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  }
+  std::exception_ptr error;
+  if (rank == 0 && !target.cache_file.empty() && !result.trials.empty()) {
+    try {
+      ppc::util::TuningCache cache(target.cache_file);
+      cache.Store(target.task, target.size, target.num_proc, result.best, result.best_time_sec);
+      cache.Save();
+    } catch (...) {
+      error = std::current_exception();
+    }
+  }
+  int failed = error ? 1 : 0;
+  if (mpi_initialized != 0) {
+    // Rank 0 sends after Save() has renamed the finished file into place, so every rank then reads the new cache;
+    // a failed write is reported on all ranks instead of leaving them waiting for rank 0
+    MPI_Bcast(&failed, 1, MPI_INT, 0, MPI_COMM_WORLD);
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  if (failed != 0) {
+    throw std::runtime_error("Rank 0 failed to save the tuning cache " + target.cache_file);
+  }
+  ppc::util::ReloadTuningCache();
+  return result;
+}
+
+}  // namespace ppc::performance
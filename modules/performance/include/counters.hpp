@@ -0,0 +1,200 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#ifdef __linux__
+#  include <linux/perf_event.h>
+#  include <sys/ioctl.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+namespace ppc::performance {
+
+/// @brief Hardware events counted around the measured region.
+enum class HardwareCounter : uint8_t { kCycles, kInstructions, kLlcMisses, kBranchMisses, kDtlbMisses };
+
+inline constexpr std::size_t kNumHardwareCounters = 5;
+
+inline std::string GetStringHardwareCounter(HardwareCounter counter) {
+  switch (counter) {
+    case HardwareCounter::kCycles:
+      return "cycles";
+    case HardwareCounter::kInstructions:
+      return "instructions";
+    case HardwareCounter::kLlcMisses:
+      return "llc_misses";
+    case HardwareCounter::kBranchMisses:
+      return "branch_misses";
+    case HardwareCounter::kDtlbMisses:
+      return "dtlb_misses";
+  }
+  return "unknown";
+}
+
+/// @brief Counter values of one process, averaged per measured iteration.
+struct CounterValues {
+  /// @brief Whether the event could be opened and was scheduled on the PMU.
+  std::array<bool, kNumHardwareCounters> valid{};
+  std::array<double, kNumHardwareCounters> values{};
+
+  [[nodiscard]] bool Has(HardwareCounter counter) const {
+    return valid[static_cast<std::size_t>(counter)];
+  }
+  [[nodiscard]] double Get(HardwareCounter counter) const {
+    return values[static_cast<std::size_t>(counter)];
+  }
+  /// @brief Instructions per cycle; 0 if either counter is missing.
+  [[nodiscard]] double Ipc() const {
+    if (!Has(HardwareCounter::kCycles) || !Has(HardwareCounter::kInstructions) ||
+        Get(HardwareCounter::kCycles) == 0.0) {
+      return 0.0;
+    }
+    return Get(HardwareCounter::kInstructions) / Get(HardwareCounter::kCycles);
+  }
+  /// @brief Events of @p counter per thousand instructions; 0 if either counter is missing.
+  [[nodiscard]] double PerKiloInstruction(HardwareCounter counter) const {
+    if (!Has(counter) || !Has(HardwareCounter::kInstructions) || Get(HardwareCounter::kInstructions) == 0.0) {
+      return 0.0;
+    }
+    return 1000.0 * Get(counter) / Get(HardwareCounter::kInstructions);
+  }
+  [[nodiscard]] bool Any() const {
+    for (bool v : valid) {
+      if (v) {
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+/// @brief Group of perf_event_open counters of the calling thread and the threads it starts while open.
+/// @details Events that the kernel refuses (no PMU in a container, perf_event_paranoid, non-Linux systems)
+/// are skipped; if none can be opened the group does nothing and Read() reports no valid counter.
+/// Only user-space events are counted. Worker threads that exist before the group opens (thread pools, OpenMP,
+/// TBB) are not counted, so for threaded tasks the values describe the calling thread only.
+class CounterGroup {
+ public:
+  CounterGroup() {
+#ifdef __linux__
+    for (std::size_t i = 0; i < kNumHardwareCounters; i++) {
+      fds_[i] = Open(static_cast<HardwareCounter>(i), leader_);
+      if (leader_ == -1) {
+        leader_ = fds_[i];
+      }
+    }
+#endif
+  }
+  ~CounterGroup() {
+#ifdef __linux__
+    for (int fd : fds_) {
+      if (fd != -1) {
+        close(fd);
+      }
+    }
+#endif
+  }
+
+  CounterGroup(const CounterGroup &) = delete;
+  CounterGroup &operator=(const CounterGroup &) = delete;
+  CounterGroup(CounterGroup &&) = delete;
+  CounterGroup &operator=(CounterGroup &&) = delete;
+
+  [[nodiscard]] bool Available() const {
+    return leader_ != -1;
+  }
+
+  /// @brief Sets the counts to zero.
+  void Reset() {
+#ifdef __linux__
+    if (Available()) {
+      ioctl(leader_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+  }
+
+  /// @brief Starts counting; the counts add up over Start()/Stop() pairs until Reset().
+  void Start() {
+#ifdef __linux__
+    if (Available()) {
+      ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+  }
+
+  void Stop() {
+#ifdef __linux__
+    if (Available()) {
+      ioctl(leader_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+  }
+
+  /// @brief Reads the counters, scaled for multiplexing and divided by @p iterations.
+  [[nodiscard]] CounterValues Read(std::size_t iterations) const {
+    CounterValues result;
+#ifdef __linux__
+    for (std::size_t i = 0; i < kNumHardwareCounters; i++) {
+      // value, time_enabled, time_running (PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING)
+      std::array<uint64_t, 3> data{};
+      if (fds_[i] == -1 || read(fds_[i], data.data(), sizeof(data)) != static_cast<ssize_t>(sizeof(data)) ||
+          data[2] == 0) {
+        continue;
+      }
+      const double scaled = static_cast<double>(data[0]) * static_cast<double>(data[1]) / static_cast<double>(data[2]);
+      result.valid[i] = true;
+      result.values[i] = iterations == 0 ? scaled : scaled / static_cast<double>(iterations);
+    }
+#else
+    static_cast<void>(iterations);
+#endif
+    return result;
+  }
+
+ private:
+  std::array<int, kNumHardwareCounters> fds_{-1, -1, -1, -1, -1};
+  int leader_ = -1;
+
+#ifdef __linux__
+  static int Open(HardwareCounter counter, int group_fd) {
+    perf_event_attr attr{};
+    attr.size = sizeof(attr);
+    switch (counter) {
+      case HardwareCounter::kCycles:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CPU_CYCLES;
+        break;
+      case HardwareCounter::kInstructions:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+        break;
+      case HardwareCounter::kLlcMisses:
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8U) |
+                      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16U);
+        break;
+      case HardwareCounter::kBranchMisses:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+        break;
+      case HardwareCounter::kDtlbMisses:
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8U) |
+                      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16U);
+        break;
+    }
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attr.disabled = group_fd == -1 ? 1 : 0;
+    attr.inherit = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+  }
+#endif
+};
+
+}  // namespace ppc::performance
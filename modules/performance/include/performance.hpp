@@ -1,15 +1,24 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "performance/include/counters.hpp"
+#include "performance/include/statistics.hpp"
+#include "task/include/batch.hpp"
 #include "task/include/task.hpp"
+#include "util/include/memory_usage.hpp"
 #include "util/include/util.hpp"
 
 namespace ppc::performance {
@@ -18,6 +27,69 @@ inline double DefaultTimer() {
   return -1.0;
 }
 
+/// @brief Per-stage pipeline times in seconds over the processes of a run.
+/// @details For MPI tasks the slowest and the fastest process are kept apart, so imbalance stays visible.
+struct StageBreakdown {
+  ppc::task::StageTimings min{};
+  ppc::task::StageTimings avg{};
+  ppc::task::StageTimings max{};
+};
+
+/// @brief Breakdown of a single process: min, avg and max are the local times.
+inline StageBreakdown LocalStageBreakdown(const ppc::task::StageTimings &timings) {
+  return {.min = timings, .avg = timings, .max = timings};
+}
+
+/// @brief Minimum, average and maximum of a per-process value over the processes of a run.
+struct ValueBreakdown {
+  double min = 0.0;
+  double avg = 0.0;
+  double max = 0.0;
+};
+
+/// @brief Per-iteration times of the measured iterations over the processes of a run, indexed like the samples.
+struct SampleBreakdown {
+  std::vector<double> min;
+  std::vector<double> avg;
+  std::vector<double> max;
+};
+
+/// @brief Breakdown of a single process: min, avg and max are the local samples.
+inline SampleBreakdown LocalSampleBreakdown(const std::vector<double> &samples) {
+  return {.min = samples, .avg = samples, .max = samples};
+}
+
+/// @brief Memory measurements of a single process.
+struct MemorySample {
+  double peak_rss_bytes = 0.0;
+  /// @brief Number of operator new calls of each pipeline stage per measured iteration, indexed by TimedStage.
+  /// @details Only the allocations of the thread that runs the pipeline are counted, not those of its workers.
+  ppc::task::StageTimings alloc_count{};
+  /// @brief Bytes requested from operator new by each pipeline stage per measured iteration.
+  ppc::task::StageTimings alloc_bytes{};
+};
+
+/// @brief Memory use of a measured run over the processes.
+struct MemoryUsage {
+  /// @brief Peak resident set size in bytes, from the start of the measurement.
+  ValueBreakdown peak_rss_bytes;
+  /// @brief False if the peak could not be reset before the measurement and covers the life of the process.
+  bool peak_rss_reset = false;
+  /// @brief Whether the binary counts allocations (see ppc::util::IsAllocationHookInstalled).
+  bool allocations_tracked = false;
+  StageBreakdown alloc_count;
+  StageBreakdown alloc_bytes;
+};
+
+/// @brief Memory use of a single process: min, avg and max are the local values.
+inline MemoryUsage LocalMemoryUsage(const MemorySample &sample) {
+  MemoryUsage memory;
+  memory.peak_rss_bytes = {.min = sample.peak_rss_bytes, .avg = sample.peak_rss_bytes, .max = sample.peak_rss_bytes};
+  memory.alloc_count = LocalStageBreakdown(sample.alloc_count);
+  memory.alloc_bytes = LocalStageBreakdown(sample.alloc_bytes);
+  return memory;
+}
+
 struct PerfAttr {
   /// @brief Number of times the task is run for performance evaluation.
   uint64_t num_running = 5;
@@ -25,13 +97,87 @@ struct PerfAttr {
   /// @cond
   std::function<double()> current_timer = DefaultTimer;
   /// @endcond
+  /// @brief Untimed runs made before sampling (first-touch page faults, thread pool start-up).
+  uint64_t num_warmup = 0;
+  /// @brief Samples farther than this many scaled MADs from the median are dropped; 0 keeps every sample.
+  double outlier_threshold = 0.0;
+  /// @brief Number of bootstrap resamples for the confidence interval of the mean; 0 skips the bootstrap.
+  uint64_t bootstrap_resamples = 1000;
+  /// @brief Enables auto-calibration: after num_running samples, sampling continues until the half-width of the
+  /// confidence interval is at most this fraction of the mean. 0 disables it.
+  /// @details The stopping rule uses the normal-approximation interval of the running mean, which costs constant
+  /// time per sample; the bootstrap interval of the results is computed once, after sampling.
+  double target_relative_ci = 0.0;
+  /// @brief Upper limit on the number of samples taken by auto-calibration.
+  uint64_t max_running = 1000;
+  /// @brief Time budget in seconds for auto-calibration, counted from the first sample.
+  double time_budget_sec = 5.0;
+  /// @brief Combines the local "stop sampling" decision of all processes.
+  /// @details MPI tasks must run the same number of iterations on every rank, so the perf tests reduce the
+  /// decision over the communicator. The default keeps the local decision.
+  /// @cond
+  std::function<bool(bool)> all_agree = [](bool stop) { return stop; };
+  /// @endcond
+  /// @brief Called right before every measured iteration, outside the timed region.
+  /// @details The perf tests hold MPI tasks at a barrier here, so that all ranks start an iteration together and
+  /// the time of a rank that waits for a slower one is counted. The default does nothing.
+  /// @cond
+  std::function<void()> sync_start = [] {};
+  /// @endcond
+  /// @brief Combines the per-iteration times of all processes; the perf tests reduce them over the communicator.
+  /// @cond
+  std::function<SampleBreakdown(const std::vector<double> &)> aggregate_samples = LocalSampleBreakdown;
+  /// @endcond
+  /// @brief Combines the per-stage times of all processes; the perf tests reduce them over the communicator.
+  /// @cond
+  std::function<StageBreakdown(const ppc::task::StageTimings &)> aggregate_stages = LocalStageBreakdown;
+  /// @endcond
+  /// @brief Combines the memory measurements of all processes; the perf tests reduce them over the communicator.
+  /// @cond
+  std::function<MemoryUsage(const MemorySample &)> aggregate_memory = LocalMemoryUsage;
+  /// @endcond
+  /// @brief Opens hardware counters (Linux perf_event_open) that count the measured pipeline calls only.
+  bool collect_counters = false;
+  /// @brief Collects the counter values of all processes, indexed by rank; the default keeps the local values.
+  /// @cond
+  std::function<std::vector<CounterValues>(const CounterValues &)> gather_counters = [](const CounterValues &local) {
+    return std::vector<CounterValues>{local};
+  };
+  /// @endcond
+};
+
+/// @brief Throughput of a batch of independent task instances, see ppc::task::BatchExecutor.
+struct BatchThroughput {
+  std::size_t num_tasks = 0;
+  double tasks_per_sec = 0.0;
+  /// @brief Longest latency of a single task in seconds.
+  double max_latency = 0.0;
 };
 
 struct PerfResults {
-  /// @brief Measured execution time in seconds.
+  /// @brief Measured execution time in seconds (mean of the kept samples).
   double time_sec = 0.0;
-  enum class TypeOfRunning : uint8_t { kPipeline, kTaskRun, kNone };
+  enum class TypeOfRunning : uint8_t { kPipeline, kTaskRun, kBatch, kNone };
   TypeOfRunning type_of_running = TypeOfRunning::kNone;
+  /// @brief Statistics of the per-iteration samples.
+  SampleStatistics statistics;
+  /// @brief Raw per-iteration times in seconds, in the order they were taken, outliers included.
+  /// @details Each sample is the time of the slowest process in that iteration, i.e. the critical path of the run.
+  std::vector<double> samples;
+  /// @brief Mean per-iteration time of the fastest, an average and the slowest process.
+  ValueBreakdown rank_time;
+  /// @brief Load imbalance rank_time.max / rank_time.avg: 1 for a balanced run, up to P when one of P processes
+  /// does all the work.
+  double imbalance_ratio = 1.0;
+  /// @brief Average time of each pipeline stage per measured iteration. In kTaskRun mode only Run is repeated,
+  /// so the other stages come from their single call.
+  StageBreakdown stages;
+  /// @brief Hardware counters per measured iteration, one entry per process; empty if collection is off.
+  std::vector<CounterValues> counters;
+  /// @brief Peak RSS and per-stage allocations, aggregated like the stage times.
+  MemoryUsage memory;
+  /// @brief Filled for kBatch results only; statistics and samples then hold the per-task latencies.
+  BatchThroughput batch;
   constexpr static double kMaxTime = 10.0;
 };
 
@@ -47,22 +193,61 @@ class Perf {
   void PipelineRun(const PerfAttr &perf_attr) {
     perf_results_.type_of_running = PerfResults::TypeOfRunning::kPipeline;
 
+    const bool peak_rss_reset = ppc::util::ResetPeakResidentBytes();
+    ppc::task::StageTimings stage_sum{};
+    ppc::task::StageTimings alloc_count_sum{};
+    ppc::task::StageTimings alloc_bytes_sum{};
     CommonRun(perf_attr, [&] {
       task_->Validation();
       task_->PreProcessing();
       task_->Run();
       task_->PostProcessing();
-    }, perf_results_);
+    }, perf_results_, [&] {
+      AddStageTimings(stage_sum, task_->GetStageTimings());
+      AddStageAllocations(alloc_count_sum, alloc_bytes_sum, task_->GetStageAllocations());
+    });
+
+    const auto num_samples = perf_results_.samples.size();
+    DivideStageTimings(stage_sum, num_samples);
+    DivideStageTimings(alloc_count_sum, num_samples);
+    DivideStageTimings(alloc_bytes_sum, num_samples);
+    perf_results_.stages = perf_attr.aggregate_stages(stage_sum);
+    perf_results_.memory = CollectMemoryUsage(perf_attr, peak_rss_reset, alloc_count_sum, alloc_bytes_sum);
   }
   // Check performance of task's Run() function
   void TaskRun(const PerfAttr &perf_attr) {
     perf_results_.type_of_running = PerfResults::TypeOfRunning::kTaskRun;
 
+    const bool peak_rss_reset = ppc::util::ResetPeakResidentBytes();
     task_->Validation();
     task_->PreProcessing();
-    CommonRun(perf_attr, [&] { task_->Run(); }, perf_results_);
+    ppc::task::StageTimings stage_sum{};
+    ppc::task::StageTimings alloc_count_sum{};
+    ppc::task::StageTimings alloc_bytes_sum{};
+    const auto run_index = static_cast<std::size_t>(ppc::task::TimedStage::kRun);
+    CommonRun(perf_attr, [&] { task_->Run(); }, perf_results_, [&] {
+      stage_sum[run_index] += task_->GetStageTimings()[run_index];
+      const auto &run_allocations = task_->GetStageAllocations()[run_index];
+      alloc_count_sum[run_index] += static_cast<double>(run_allocations.count);
+      alloc_bytes_sum[run_index] += static_cast<double>(run_allocations.bytes);
+    });
     task_->PostProcessing();
 
+    const auto num_samples = perf_results_.samples.size();
+    DivideStageTimings(stage_sum, num_samples);
+    DivideStageTimings(alloc_count_sum, num_samples);
+    DivideStageTimings(alloc_bytes_sum, num_samples);
+    auto stage_timings = task_->GetStageTimings();
+    stage_timings[run_index] = stage_sum[run_index];
+    perf_results_.stages = perf_attr.aggregate_stages(stage_timings);
+
+    ppc::task::StageTimings alloc_count{};
+    ppc::task::StageTimings alloc_bytes{};
+    AddStageAllocations(alloc_count, alloc_bytes, task_->GetStageAllocations());
+    alloc_count[run_index] = alloc_count_sum[run_index];
+    alloc_bytes[run_index] = alloc_bytes_sum[run_index];
+    perf_results_.memory = CollectMemoryUsage(perf_attr, peak_rss_reset, alloc_count, alloc_bytes);
+
     task_->Validation();
     task_->PreProcessing();
     task_->Run();
@@ -87,6 +272,11 @@ class Perf {
     if (time_secs < max_time) {
       perf_res_str << std::fixed << std::setprecision(10) << time_secs;
       std::cout << test_id << ":" << type_test_name << ":" << perf_res_str.str() << '\n';
+      PrintSampleStatistics(test_id, type_test_name);
+      PrintStageBreakdown(test_id, type_test_name);
+      PrintRankTime(test_id, type_test_name);
+      PrintCounters(test_id, type_test_name);
+      PrintMemoryUsage(test_id, type_test_name);
     } else {
       std::stringstream err_msg;
       err_msg << '\n' << "Task execute time need to be: ";
@@ -106,13 +296,185 @@ class Perf {
  private:
   PerfResults perf_results_;
   std::shared_ptr<ppc::task::Task<InType, OutType>> task_;
-  static void CommonRun(const PerfAttr &perf_attr, const std::function<void()> &pipeline, PerfResults &perf_results) {
-    auto begin = perf_attr.current_timer();
-    for (uint64_t i = 0; i < perf_attr.num_running; i++) {
+  // Extra line with the sample statistics; the "stats" token keeps it apart from the timing line above
+  void PrintSampleStatistics(const std::string &test_id, const std::string &type_test_name) const {
+    const auto &stats = perf_results_.statistics;
+    std::stringstream stats_str;
+    stats_str << std::scientific << std::setprecision(4) << "samples=" << stats.num_samples
+              << ",outliers=" << stats.num_outliers << ",min=" << stats.min << ",median=" << stats.median
+              << ",p90=" << stats.p90 << ",p99=" << stats.p99 << ",stddev=" << stats.stddev << ",ci95=["
+              << stats.ci_low << "," << stats.ci_high << "]";
+    std::cout << test_id << ":" << type_test_name << ":stats:" << stats_str.str() << '\n';
+  }
+  // One more line with min/avg/max over the processes for each stage
+  void PrintStageBreakdown(const std::string &test_id, const std::string &type_test_name) const {
+    const auto &stages = perf_results_.stages;
+    std::stringstream stages_str;
+    stages_str << std::scientific << std::setprecision(4);
+    for (std::size_t i = 0; i < stages.avg.size(); i++) {
+      stages_str << (i == 0 ? "" : ",") << ppc::task::GetStringTimedStage(static_cast<ppc::task::TimedStage>(i))
+                 << "=[" << stages.min[i] << "," << stages.avg[i] << "," << stages.max[i] << "]";
+    }
+    std::cout << test_id << ":" << type_test_name << ":stages:" << stages_str.str() << '\n';
+  }
+  // Mean iteration time of the fastest, an average and the slowest process, and their imbalance
+  void PrintRankTime(const std::string &test_id, const std::string &type_test_name) const {
+    const auto &rank_time = perf_results_.rank_time;
+    std::stringstream ranks_str;
+    ranks_str << std::scientific << std::setprecision(4) << "min=" << rank_time.min << ",avg=" << rank_time.avg
+              << ",max=" << rank_time.max << std::fixed << std::setprecision(3)
+              << ",imbalance=" << perf_results_.imbalance_ratio;
+    std::cout << test_id << ":" << type_test_name << ":ranks:" << ranks_str.str() << '\n';
+  }
+  // One line per process with the derived counter metrics: IPC and misses per thousand instructions. The counters
+  // follow the thread that runs the task and its new threads only, so the line is marked as main-thread data
+  void PrintCounters(const std::string &test_id, const std::string &type_test_name) const {
+    for (std::size_t rank = 0; rank < perf_results_.counters.size(); rank++) {
+      const auto &counters = perf_results_.counters[rank];
+      std::stringstream counters_str;
+      counters_str << "rank=" << rank << ",scope=main_thread";
+      if (!counters.Any()) {
+        counters_str << ",unavailable";
+      } else {
+        counters_str << std::fixed << std::setprecision(3) << ",ipc=" << counters.Ipc()
+                     << ",llc_mpki=" << counters.PerKiloInstruction(HardwareCounter::kLlcMisses)
+                     << ",branch_mpki=" << counters.PerKiloInstruction(HardwareCounter::kBranchMisses)
+                     << ",dtlb_mpki=" << counters.PerKiloInstruction(HardwareCounter::kDtlbMisses);
+      }
+      std::cout << test_id << ":" << type_test_name << ":counters:" << counters_str.str() << '\n';
+    }
+  }
+  // Peak RSS in MiB over the processes, then the allocation count and MiB of each stage as [min,avg,max]
+  void PrintMemoryUsage(const std::string &test_id, const std::string &type_test_name) const {
+    constexpr double kMiB = 1024.0 * 1024.0;
+    const auto &memory = perf_results_.memory;
+    std::stringstream memory_str;
+    memory_str << std::fixed << std::setprecision(2) << "peak_rss_mib=[" << memory.peak_rss_bytes.min / kMiB << ","
+               << memory.peak_rss_bytes.avg / kMiB << "," << memory.peak_rss_bytes.max / kMiB << "]";
+    if (!memory.peak_rss_reset) {
+      memory_str << ",peak_rss=process_lifetime";
+    }
+    if (!memory.allocations_tracked) {
+      memory_str << ",allocations=untracked";
+    }
+    for (std::size_t i = 0; memory.allocations_tracked && i < memory.alloc_count.avg.size(); i++) {
+      const auto stage = ppc::task::GetStringTimedStage(static_cast<ppc::task::TimedStage>(i));
+      memory_str << "," << stage << "_allocs=[" << memory.alloc_count.min[i] << "," << memory.alloc_count.avg[i]
+                 << "," << memory.alloc_count.max[i] << "]," << stage << "_alloc_mib=["
+                 << memory.alloc_bytes.min[i] / kMiB << "," << memory.alloc_bytes.avg[i] / kMiB << ","
+                 << memory.alloc_bytes.max[i] / kMiB << "]";
+    }
+    std::cout << test_id << ":" << type_test_name << ":memory:" << memory_str.str() << '\n';
+  }
+  // Measures the peak RSS and combines it and the per-stage allocations of all processes; collective for MPI tasks
+  static MemoryUsage CollectMemoryUsage(const PerfAttr &perf_attr, bool peak_rss_reset,
+                                        const ppc::task::StageTimings &alloc_count,
+                                        const ppc::task::StageTimings &alloc_bytes) {
+    MemorySample sample;
+    sample.peak_rss_bytes = static_cast<double>(ppc::util::GetPeakResidentBytes());
+    sample.alloc_count = alloc_count;
+    sample.alloc_bytes = alloc_bytes;
+    MemoryUsage memory = perf_attr.aggregate_memory(sample);
+    memory.peak_rss_reset = peak_rss_reset;
+    memory.allocations_tracked = ppc::util::IsAllocationHookInstalled();
+    return memory;
+  }
+  // The per-stage allocation counts and bytes are summed as doubles, like the stage times
+  static void AddStageAllocations(ppc::task::StageTimings &count_sum, ppc::task::StageTimings &bytes_sum,
+                                  const ppc::task::StageAllocations &allocations) {
+    for (std::size_t i = 0; i < allocations.size(); i++) {
+      count_sum[i] += static_cast<double>(allocations[i].count);
+      bytes_sum[i] += static_cast<double>(allocations[i].bytes);
+    }
+  }
+  static void AddStageTimings(ppc::task::StageTimings &sum, const ppc::task::StageTimings &timings) {
+    for (std::size_t i = 0; i < sum.size(); i++) {
+      sum[i] += timings[i];
+    }
+  }
+  static void DivideStageTimings(ppc::task::StageTimings &sum, std::size_t count) {
+    if (count == 0) {
+      return;
+    }
+    for (auto &value : sum) {
+      value /= static_cast<double>(count);
+    }
+  }
+  // on_sample is called after every measured (non-warmup) iteration
+  static void CommonRun(const PerfAttr &perf_attr, const std::function<void()> &pipeline, PerfResults &perf_results,
+                        const std::function<void()> &on_sample = {}) {
+    for (uint64_t i = 0; i < perf_attr.num_warmup; i++) {
       pipeline();
     }
-    auto end = perf_attr.current_timer();
-    perf_results.time_sec = (end - begin) / static_cast<double>(perf_attr.num_running);
+
+    std::vector<double> samples;
+    samples.reserve(perf_attr.num_running);
+    RunningMoments moments;
+    // Counters run around the pipeline only, so the barrier, the callbacks and the calibration are not counted
+    std::optional<CounterGroup> counters;
+    if (perf_attr.collect_counters) {
+      counters.emplace();
+      counters->Reset();
+    }
+    auto run_once = [&] {
+      perf_attr.sync_start();
+      if (counters) {
+        counters->Start();
+      }
+      const double begin = perf_attr.current_timer();
+      pipeline();
+      samples.push_back(perf_attr.current_timer() - begin);
+      moments.Add(samples.back());
+      if (counters) {
+        counters->Stop();
+      }
+      if (on_sample) {
+        on_sample();
+      }
+    };
+
+    const double start = perf_attr.current_timer();
+    for (uint64_t i = 0; i < perf_attr.num_running; i++) {
+      run_once();
+    }
+    if (perf_attr.target_relative_ci > 0.0) {
+      while (!perf_attr.all_agree(IsCalibrated(perf_attr, moments, perf_attr.current_timer() - start))) {
+        run_once();
+      }
+    }
+
+    if (counters) {
+      perf_results.counters = perf_attr.gather_counters(counters->Read(samples.size()));
+    }
+
+    // Every rank reports the slowest rank of each iteration, so the statistics describe the critical path
+    auto per_rank = perf_attr.aggregate_samples(samples);
+    perf_results.rank_time = {.min = Mean(per_rank.min), .avg = Mean(per_rank.avg), .max = Mean(per_rank.max)};
+    perf_results.imbalance_ratio =
+        perf_results.rank_time.avg > 0.0 ? perf_results.rank_time.max / perf_results.rank_time.avg : 1.0;
+    perf_results.statistics =
+        ComputeStatistics(per_rank.max, perf_attr.outlier_threshold, perf_attr.bootstrap_resamples);
+    perf_results.time_sec = perf_results.statistics.mean;
+    perf_results.samples = std::move(per_rank.max);
+  }
+  static double Mean(const std::vector<double> &values) {
+    if (values.empty()) {
+      return 0.0;
+    }
+    double sum = 0.0;
+    for (double value : values) {
+      sum += value;
+    }
+    return sum / static_cast<double>(values.size());
+  }
+  static bool IsCalibrated(const PerfAttr &perf_attr, const RunningMoments &moments, double elapsed) {
+    if (moments.count >= perf_attr.max_running || elapsed >= perf_attr.time_budget_sec) {
+      return true;
+    }
+    if (moments.count < 2) {
+      return false;
+    }
+    return moments.MeanHalfWidth() <= perf_attr.target_relative_ci * moments.mean;
   }
 };
 
@@ -123,7 +485,41 @@ inline std::string GetStringParamName(PerfResults::TypeOfRunning type_of_running
   if (type_of_running == PerfResults::TypeOfRunning::kPipeline) {
     return "pipeline";
   }
+  if (type_of_running == PerfResults::TypeOfRunning::kBatch) {
+    return "batch";
+  }
   return "none";
 }
 
+/// @brief Turns the timing of a batch run into perf results.
+/// @details time_sec is the wall time of the whole batch. The latencies are kept as samples without outlier
+/// rejection, so p90/p99 of the statistics give the tail latency.
+inline PerfResults MakeBatchPerfResults(const ppc::task::BatchStats &stats) {
+  PerfResults results;
+  results.type_of_running = PerfResults::TypeOfRunning::kBatch;
+  results.time_sec = stats.total_sec;
+  results.samples = stats.latencies;
+  results.statistics = ComputeStatistics(stats.latencies, 0.0, 0);
+  results.batch.num_tasks = stats.num_tasks;
+  if (stats.total_sec > 0.0) {
+    results.batch.tasks_per_sec = static_cast<double>(stats.num_tasks) / stats.total_sec;
+  }
+  if (!stats.latencies.empty()) {
+    results.batch.max_latency = *std::ranges::max_element(stats.latencies);
+  }
+  return results;
+}
+
+/// @brief Prints "<test>:batch:<seconds>" and a line with the throughput and the tail latency of a batch run.
+inline void PrintBatchStatistic(const std::string &test_id, const PerfResults &results) {
+  const auto &stats = results.statistics;
+  std::stringstream batch_str;
+  batch_str << "tasks=" << results.batch.num_tasks << std::scientific << std::setprecision(4)
+            << ",tasks_per_sec=" << results.batch.tasks_per_sec << ",latency_median=" << stats.median
+            << ",latency_p90=" << stats.p90 << ",latency_p99=" << stats.p99
+            << ",latency_max=" << results.batch.max_latency;
+  std::cout << test_id << ":batch:" << std::fixed << std::setprecision(10) << results.time_sec << '\n';
+  std::cout << test_id << ":batch:throughput:" << batch_str.str() << '\n';
+}
+
 }  // namespace ppc::performance
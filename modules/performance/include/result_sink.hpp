@@ -0,0 +1,149 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "performance/include/counters.hpp"
+#include "performance/include/performance.hpp"
+#include "task/include/task.hpp"
+#include "util/include/util.hpp"
+
+namespace ppc::performance {
+
+/// @brief Amount of work done by one task run in the natural unit of the task.
+/// @details E.g. {n, "elements"}, {edges, "edges"} or {2.0 * n * n * n / 1e9, "GFLOP"}; the throughput is reported
+/// as count / time in "<unit>/s". A zero count means the test does not report a throughput.
+struct WorkAmount {
+  double count = 0.0;
+  std::string unit;
+};
+
+/// @brief Describes where and how a measurement was taken.
+struct RunContext {
+  /// @brief Task namespace, e.g. "example_threads".
+  std::string task;
+  /// @brief Implementation type: "seq", "mpi", "omp", ...
+  std::string impl;
+  int num_proc = 1;
+  int num_threads = 1;
+  /// @brief Factor by which the input was grown for weak scaling; 1 for the regular input.
+  int problem_scale = 1;
+  /// @brief Input size N of a size-sweep test case; 0 for a test with its fixed input.
+  std::size_t problem_size = 0;
+  WorkAmount work;
+  std::string hostname;
+  std::string git_sha;
+};
+
+/// @brief Current UTC time in ISO 8601 format, e.g. "2025-01-31T12:00:00Z".
+inline std::string CurrentUtcTimestamp() {
+  const std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+  std::tm utc{};
+#ifdef _WIN32
+  gmtime_s(&utc, &now);
+#else
+  gmtime_r(&now, &utc);
+#endif
+  std::stringstream ss;
+  ss << std::put_time(&utc, "%Y-%m-%dT%H:%M:%SZ");
+  return ss.str();
+}
+
+/// @brief Builds the JSON record of one measurement.
+/// @details Holds the run context, the mean time, the throughput if the test reports its work, every field of
+/// SampleStatistics, the raw samples (used by the rank test of scripts/perf_regression.py), the per-stage
+/// breakdown, the per-process iteration time with its imbalance ratio, the peak RSS and per-stage allocations, the
+/// throughput of batch runs and, if they were collected, the hardware counters of each process.
+inline nlohmann::json MakePerfRecord(const RunContext &context, const PerfResults &results) {
+  const auto &stats = results.statistics;
+  nlohmann::json record = {
+      {"task", context.task},
+      {"impl", context.impl},
+      {"mode", GetStringParamName(results.type_of_running)},
+      {"num_proc", context.num_proc},
+      {"num_threads", context.num_threads},
+      {"problem_scale", context.problem_scale},
+      {"problem_size", context.problem_size},
+      {"time_sec", results.time_sec},
+      {"statistics",
+       {{"mean", stats.mean},
+        {"min", stats.min},
+        {"median", stats.median},
+        {"p90", stats.p90},
+        {"p99", stats.p99},
+        {"stddev", stats.stddev},
+        {"ci_low", stats.ci_low},
+        {"ci_high", stats.ci_high},
+        {"num_samples", stats.num_samples},
+        {"num_outliers", stats.num_outliers}}},
+      {"samples", results.samples},
+      {"hostname", context.hostname},
+      {"git_sha", context.git_sha},
+      {"timestamp", CurrentUtcTimestamp()},
+  };
+  for (std::size_t i = 0; i < results.stages.avg.size(); i++) {
+    const auto name = ppc::task::GetStringTimedStage(static_cast<ppc::task::TimedStage>(i));
+    record["stages"][name] = {
+        {"min", results.stages.min[i]}, {"avg", results.stages.avg[i]}, {"max", results.stages.max[i]}};
+  }
+  if (results.type_of_running != PerfResults::TypeOfRunning::kBatch) {
+    record["ranks"] = {{"min", results.rank_time.min},
+                       {"avg", results.rank_time.avg},
+                       {"max", results.rank_time.max},
+                       {"imbalance_ratio", results.imbalance_ratio}};
+  }
+  if (context.work.count > 0.0 && results.time_sec > 0.0) {
+    record["work"] = {{"count", context.work.count}, {"unit", context.work.unit}};
+    record["throughput"] = context.work.count / results.time_sec;
+  }
+  if (results.type_of_running == PerfResults::TypeOfRunning::kBatch) {
+    record["batch"] = {{"num_tasks", results.batch.num_tasks},
+                       {"tasks_per_sec", results.batch.tasks_per_sec},
+                       {"max_latency", results.batch.max_latency}};
+  }
+  const auto &memory = results.memory;
+  record["memory"] = {{"peak_rss_bytes",
+                       {{"min", memory.peak_rss_bytes.min},
+                        {"avg", memory.peak_rss_bytes.avg},
+                        {"max", memory.peak_rss_bytes.max}}},
+                      {"peak_rss_reset", memory.peak_rss_reset}};
+  for (std::size_t i = 0; memory.allocations_tracked && i < memory.alloc_count.avg.size(); i++) {
+    const auto name = ppc::task::GetStringTimedStage(static_cast<ppc::task::TimedStage>(i));
+    record["memory"]["allocations"][name] = {
+        {"count",
+         {{"min", memory.alloc_count.min[i]}, {"avg", memory.alloc_count.avg[i]}, {"max", memory.alloc_count.max[i]}}},
+        {"bytes",
+         {{"min", memory.alloc_bytes.min[i]}, {"avg", memory.alloc_bytes.avg[i]}, {"max", memory.alloc_bytes.max[i]}}}};
+  }
+  for (const auto &counters : results.counters) {
+    nlohmann::json entry = nlohmann::json::object();
+    for (std::size_t i = 0; i < kNumHardwareCounters; i++) {
+      if (counters.valid[i]) {
+        entry[GetStringHardwareCounter(static_cast<HardwareCounter>(i))] = counters.values[i];
+      }
+    }
+    if (counters.Any()) {
+      entry["ipc"] = counters.Ipc();
+    }
+    record["counters"].push_back(entry);
+  }
+  return record;
+}
+
+/// @brief Appends @p record as a single line to the JSON Lines file at @p path.
+/// @throws std::runtime_error If the file cannot be opened.
+inline void AppendPerfRecord(const std::string &path, const nlohmann::json &record) {
+  std::ofstream file(path, std::ios::app);
+  if (!file.is_open()) {
+    throw std::runtime_error("Failed to open perf results file " + path);
+  }
+  file << record.dump() << '\n';
+}
+
+}  // namespace ppc::performance
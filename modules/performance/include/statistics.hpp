@@ -0,0 +1,148 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace ppc::performance {
+
+/// @brief Summary of per-iteration timings in seconds.
+struct SampleStatistics {
+  double mean = 0.0;
+  double min = 0.0;
+  double median = 0.0;
+  double p90 = 0.0;
+  double p99 = 0.0;
+  /// @brief Sample standard deviation.
+  double stddev = 0.0;
+  /// @brief Bounds of the 95% bootstrap confidence interval of the mean.
+  double ci_low = 0.0;
+  double ci_high = 0.0;
+  /// @brief Number of samples kept after outlier rejection.
+  std::size_t num_samples = 0;
+  /// @brief Number of samples dropped as outliers.
+  std::size_t num_outliers = 0;
+};
+
+/// @brief Returns the q-th quantile (q in [0, 1]) of sorted data, interpolating between neighbours.
+inline double Percentile(const std::vector<double> &sorted, double q) {
+  if (sorted.empty()) {
+    return 0.0;
+  }
+  const double pos = q * static_cast<double>(sorted.size() - 1);
+  const auto lower = static_cast<std::size_t>(std::floor(pos));
+  const std::size_t upper = std::min(lower + 1, sorted.size() - 1);
+  const double frac = pos - static_cast<double>(lower);
+  return sorted[lower] + (frac * (sorted[upper] - sorted[lower]));
+}
+
+/// @brief Drops samples farther than @p threshold scaled median absolute deviations from the median.
+/// @details The MAD is scaled by 1.4826 so that it estimates the standard deviation of normal data.
+/// Nothing is dropped if @p threshold is not positive or the MAD is zero.
+/// @return Number of dropped samples.
+inline std::size_t RejectOutliers(std::vector<double> &samples, double threshold) {
+  if (threshold <= 0.0 || samples.size() < 3) {
+    return 0;
+  }
+  std::vector<double> sorted = samples;
+  std::ranges::sort(sorted);
+  const double median = Percentile(sorted, 0.5);
+
+  std::vector<double> deviations(sorted.size());
+  std::ranges::transform(sorted, deviations.begin(), [median](double x) { return std::abs(x - median); });
+  std::ranges::sort(deviations);
+  const double mad = 1.4826 * Percentile(deviations, 0.5);
+  if (mad == 0.0) {
+    return 0;
+  }
+
+  const auto removed = std::erase_if(samples, [&](double x) { return std::abs(x - median) > threshold * mad; });
+  return static_cast<std::size_t>(removed);
+}
+
+/// @brief Percentile bootstrap confidence interval of the mean.
+/// @details Resampling uses a fixed seed, so the same samples always give the same interval.
+inline std::pair<double, double> BootstrapMeanInterval(const std::vector<double> &samples, uint64_t resamples,
+                                                       double confidence = 0.95) {
+  if (samples.empty()) {
+    return {0.0, 0.0};
+  }
+  const double mean = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(samples.size());
+  if (resamples == 0 || samples.size() == 1) {
+    return {mean, mean};
+  }
+
+  std::mt19937_64 gen(0x5eed);
+  std::uniform_int_distribution<std::size_t> pick(0, samples.size() - 1);
+  std::vector<double> means(resamples);
+  for (auto &resample_mean : means) {
+    double sum = 0.0;
+    for (std::size_t i = 0; i < samples.size(); i++) {
+      sum += samples[pick(gen)];
+    }
+    resample_mean = sum / static_cast<double>(samples.size());
+  }
+  std::ranges::sort(means);
+  const double tail = (1.0 - confidence) / 2.0;
+  return {Percentile(means, tail), Percentile(means, 1.0 - tail)};
+}
+
+/// @brief Mean and variance of a stream of samples, updated in constant time per sample (Welford's method).
+struct RunningMoments {
+  std::size_t count = 0;
+  double mean = 0.0;
+  /// @brief Sum of squared deviations from the mean.
+  double m2 = 0.0;
+
+  void Add(double x) {
+    count++;
+    const double delta = x - mean;
+    mean += delta / static_cast<double>(count);
+    m2 += delta * (x - mean);
+  }
+  /// @brief Sample standard deviation; 0 for fewer than two samples.
+  [[nodiscard]] double StdDev() const {
+    return count > 1 ? std::sqrt(m2 / static_cast<double>(count - 1)) : 0.0;
+  }
+  /// @brief Half-width of the normal-approximation 95% confidence interval of the mean.
+  [[nodiscard]] double MeanHalfWidth() const {
+    return count > 0 ? 1.96 * StdDev() / std::sqrt(static_cast<double>(count)) : 0.0;
+  }
+};
+
+/// @brief Computes the summary of @p samples after outlier rejection.
+inline SampleStatistics ComputeStatistics(std::vector<double> samples, double outlier_threshold,
+                                          uint64_t bootstrap_resamples) {
+  SampleStatistics stats;
+  stats.num_outliers = RejectOutliers(samples, outlier_threshold);
+  stats.num_samples = samples.size();
+  if (samples.empty()) {
+    return stats;
+  }
+
+  std::vector<double> sorted = samples;
+  std::ranges::sort(sorted);
+  const auto n = static_cast<double>(sorted.size());
+  stats.mean = std::accumulate(sorted.begin(), sorted.end(), 0.0) / n;
+  stats.min = sorted.front();
+  stats.median = Percentile(sorted, 0.5);
+  stats.p90 = Percentile(sorted, 0.9);
+  stats.p99 = Percentile(sorted, 0.99);
+  if (sorted.size() > 1) {
+    double sq_sum = 0.0;
+    for (double x : sorted) {
+      sq_sum += (x - stats.mean) * (x - stats.mean);
+    }
+    stats.stddev = std::sqrt(sq_sum / (n - 1.0));
+  }
+  std::tie(stats.ci_low, stats.ci_high) = BootstrapMeanInterval(sorted, bootstrap_resamples);
+  return stats;
+}
+
+}  // namespace ppc::performance
@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <array>
 #include <chrono>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
@@ -8,12 +11,19 @@
 #include <memory>
 #include <ostream>
 #include <stdexcept>
+#include <string>
 #include <string_view>
 #include <thread>
 #include <vector>
 
+#include "performance/include/autotune.hpp"
 #include "performance/include/performance.hpp"
+#include "performance/include/result_sink.hpp"
+#include "task/include/batch.hpp"
 #include "task/include/task.hpp"
+#include "util/include/memory_usage.hpp"
+#include "util/include/perf_test_util.hpp"
+#include "util/include/tuning.hpp"
 #include "util/include/util.hpp"
 
 using ppc::task::StatusOfTask;
@@ -61,6 +71,29 @@ class FakePerfTask : public TestPerfTask<InType, OutType> {
   }
 };
 
+template <typename InType, typename OutType>
+class ShortSleepPerfTask : public TestPerfTask<InType, OutType> {
+ public:
+  explicit ShortSleepPerfTask(const InType &in) : TestPerfTask<InType, OutType>(in) {}
+
+  bool RunImpl() override {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    return TestPerfTask<InType, OutType>::RunImpl();
+  }
+};
+
+template <typename InType, typename OutType>
+class AllocatingPerfTask : public TestPerfTask<InType, OutType> {
+ public:
+  explicit AllocatingPerfTask(const InType &in) : TestPerfTask<InType, OutType>(in) {}
+
+  // Stands in for the counting operator new, which only ppc_perf_tests links
+  bool RunImpl() override {
+    ppc::util::CountAllocation(4096);
+    return TestPerfTask<InType, OutType>::RunImpl();
+  }
+};
+
 }  // namespace ppc::test
 
 namespace ppc::performance {
@@ -350,6 +383,335 @@ TEST(PerfTest, PipelineRunAndTaskRun) {
   EXPECT_GT(res_taskrun.time_sec, 0.0);
 }
 
+TEST(PerfTest, WarmupRunsAreNotSampled) {
+  auto task_ptr = std::make_shared<DummyTask>();
+  Perf<int, int> perf(task_ptr);
+
+  PerfAttr attr;
+  double time = 0.0;
+  attr.num_running = 3;
+  attr.num_warmup = 2;
+  attr.current_timer = [&time]() { return time += 1.0; };
+
+  perf.PipelineRun(attr);
+  const auto res = perf.GetPerfResults();
+  EXPECT_EQ(res.samples.size(), 3U);
+  EXPECT_EQ(res.statistics.num_samples, 3U);
+  EXPECT_DOUBLE_EQ(res.time_sec, 1.0);
+}
+
+TEST(PerfTest, SampleStatisticsRejectOutliers) {
+  const std::vector<double> samples = {1.0, 1.1, 0.9, 1.0, 1.05, 0.95, 50.0};
+  const auto stats = ComputeStatistics(samples, 3.5, 200);
+  EXPECT_EQ(stats.num_outliers, 1U);
+  EXPECT_EQ(stats.num_samples, 6U);
+  EXPECT_DOUBLE_EQ(stats.min, 0.9);
+  EXPECT_DOUBLE_EQ(stats.median, 1.0);
+  EXPECT_NEAR(stats.mean, 1.0, 1e-12);
+  EXPECT_LE(stats.ci_low, stats.mean);
+  EXPECT_GE(stats.ci_high, stats.mean);
+  EXPECT_LE(stats.p90, 1.1);
+  EXPECT_GT(stats.stddev, 0.0);
+}
+
+TEST(PerfTest, SampleStatisticsKeepEverythingWithoutThreshold) {
+  const auto stats = ComputeStatistics({1.0, 2.0, 3.0, 4.0, 100.0}, 0.0, 0);
+  EXPECT_EQ(stats.num_outliers, 0U);
+  EXPECT_DOUBLE_EQ(stats.mean, 22.0);
+  EXPECT_DOUBLE_EQ(stats.median, 3.0);
+  EXPECT_DOUBLE_EQ(stats.ci_low, stats.ci_high);
+}
+
+TEST(PerfTest, PercentileInterpolates) {
+  const std::vector<double> sorted = {0.0, 10.0};
+  EXPECT_DOUBLE_EQ(Percentile(sorted, 0.5), 5.0);
+  EXPECT_DOUBLE_EQ(Percentile(sorted, 0.9), 9.0);
+  EXPECT_DOUBLE_EQ(Percentile({}, 0.5), 0.0);
+}
+
+TEST(PerfTest, RunningMomentsMatchTheBatchStatistics) {
+  const std::vector<double> samples = {1.0, 2.0, 4.0, 8.0, 16.0};
+  ppc::performance::RunningMoments moments;
+  for (const double sample : samples) {
+    moments.Add(sample);
+  }
+  const auto stats = ComputeStatistics(samples, 0.0, 0);
+  EXPECT_EQ(moments.count, samples.size());
+  EXPECT_NEAR(moments.mean, stats.mean, 1e-12);
+  EXPECT_NEAR(moments.StdDev(), stats.stddev, 1e-12);
+  EXPECT_NEAR(moments.MeanHalfWidth(), 1.96 * stats.stddev / std::sqrt(5.0), 1e-12);
+}
+
+TEST(PerfTest, AutoCalibrationStopsAtSampleLimit) {
+  auto task_ptr = std::make_shared<DummyTask>();
+  Perf<int, int> perf(task_ptr);
+
+  PerfAttr attr;
+  double time = 0.0;
+  double step = 0.0;
+  attr.num_running = 2;
+  attr.target_relative_ci = 1e-9;
+  attr.max_running = 7;
+  attr.time_budget_sec = 1e9;
+  // Every sample is longer than the previous one, so only the sample limit can stop the loop
+  attr.current_timer = [&]() { return time += (step += 1.0); };
+
+  perf.TaskRun(attr);
+  EXPECT_EQ(perf.GetPerfResults().samples.size(), 7U);
+}
+
+TEST(PerfTest, AutoCalibrationStopsWhenIntervalIsTight) {
+  auto task_ptr = std::make_shared<DummyTask>();
+  Perf<int, int> perf(task_ptr);
+
+  PerfAttr attr;
+  double time = 0.0;
+  attr.num_running = 2;
+  attr.target_relative_ci = 0.01;
+  attr.current_timer = [&time]() { return time += 1.0; };
+
+  perf.TaskRun(attr);
+  EXPECT_EQ(perf.GetPerfResults().samples.size(), 2U);
+}
+
+TEST(PerfTest, StageBreakdownIsFilled) {
+  std::vector<uint32_t> in(128, 1);
+  auto test_task = std::make_shared<ppc::test::ShortSleepPerfTask<std::vector<uint32_t>, uint32_t>>(in);
+  Perf<std::vector<uint32_t>, uint32_t> perf_analyzer(test_task);
+
+  PerfAttr attr;
+  attr.num_running = 2;
+  int aggregate_calls = 0;
+  attr.aggregate_stages = [&aggregate_calls](const ppc::task::StageTimings &timings) {
+    aggregate_calls++;
+    return LocalStageBreakdown(timings);
+  };
+
+  perf_analyzer.PipelineRun(attr);
+  const auto &stages = perf_analyzer.GetPerfResults().stages;
+  const auto run_index = static_cast<std::size_t>(ppc::task::TimedStage::kRun);
+  EXPECT_EQ(aggregate_calls, 1);
+  EXPECT_GT(stages.avg[run_index], 0.0);
+  EXPECT_LE(stages.min[run_index], stages.avg[run_index]);
+  EXPECT_GE(stages.max[run_index], stages.avg[run_index]);
+  EXPECT_LT(stages.avg[static_cast<std::size_t>(ppc::task::TimedStage::kValidation)], stages.avg[run_index]);
+}
+
+TEST(PerfTest, MemoryUsageIsFilled) {
+  std::vector<uint32_t> in(128, 1);
+  auto test_task = std::make_shared<ppc::test::AllocatingPerfTask<std::vector<uint32_t>, uint32_t>>(in);
+  Perf<std::vector<uint32_t>, uint32_t> perf_analyzer(test_task);
+
+  PerfAttr attr;
+  attr.num_running = 3;
+  int aggregate_calls = 0;
+  attr.aggregate_memory = [&aggregate_calls](const MemorySample &sample) {
+    aggregate_calls++;
+    return LocalMemoryUsage(sample);
+  };
+
+  perf_analyzer.TaskRun(attr);
+  const auto &memory = perf_analyzer.GetPerfResults().memory;
+  const auto run_index = static_cast<std::size_t>(ppc::task::TimedStage::kRun);
+  EXPECT_EQ(aggregate_calls, 1);
+  EXPECT_DOUBLE_EQ(memory.alloc_count.avg[run_index], 1.0);
+  EXPECT_DOUBLE_EQ(memory.alloc_bytes.max[run_index], 4096.0);
+  EXPECT_DOUBLE_EQ(memory.alloc_count.avg[static_cast<std::size_t>(ppc::task::TimedStage::kValidation)], 0.0);
+#ifdef __linux__
+  EXPECT_GT(memory.peak_rss_bytes.max, 0.0);
+#endif
+}
+
+TEST(PerfTest, MakePerfRecordHoldsMemoryUsage) {
+  PerfResults results;
+  results.type_of_running = PerfResults::TypeOfRunning::kPipeline;
+  results.memory.peak_rss_bytes.max = 1024.0;
+  results.memory.alloc_count.avg[static_cast<std::size_t>(ppc::task::TimedStage::kRun)] = 3.0;
+
+  auto record = MakePerfRecord(RunContext{}, results);
+  EXPECT_DOUBLE_EQ(record["memory"]["peak_rss_bytes"]["max"].get<double>(), 1024.0);
+  EXPECT_FALSE(record["memory"].contains("allocations"));
+
+  results.memory.allocations_tracked = true;
+  record = MakePerfRecord(RunContext{}, results);
+  EXPECT_DOUBLE_EQ(record["memory"]["allocations"]["run"]["count"]["avg"].get<double>(), 3.0);
+}
+
+TEST(PerfTest, SamplesFollowTheSlowestProcess) {
+  auto task_ptr = std::make_shared<DummyTask>();
+  Perf<int, int> perf(task_ptr);
+
+  PerfAttr attr;
+  double time = 0.0;
+  attr.num_running = 3;
+  attr.current_timer = [&time]() { return time += 1.0; };
+  int sync_calls = 0;
+  attr.sync_start = [&sync_calls] { sync_calls++; };
+  // As if a second process took three times as long in every iteration
+  attr.aggregate_samples = [](const std::vector<double> &samples) {
+    SampleBreakdown breakdown{.min = samples, .avg = samples, .max = samples};
+    for (std::size_t i = 0; i < samples.size(); i++) {
+      breakdown.avg[i] = 2.0 * samples[i];
+      breakdown.max[i] = 3.0 * samples[i];
+    }
+    return breakdown;
+  };
+
+  perf.TaskRun(attr);
+  const auto results = perf.GetPerfResults();
+  EXPECT_EQ(sync_calls, 3);
+  EXPECT_EQ(results.samples, std::vector<double>(3, 3.0));
+  EXPECT_DOUBLE_EQ(results.time_sec, 3.0);
+  EXPECT_DOUBLE_EQ(results.rank_time.min, 1.0);
+  EXPECT_DOUBLE_EQ(results.rank_time.avg, 2.0);
+  EXPECT_DOUBLE_EQ(results.imbalance_ratio, 1.5);
+
+  const auto record = MakePerfRecord(RunContext{}, results);
+  EXPECT_DOUBLE_EQ(record["ranks"]["imbalance_ratio"].get<double>(), 1.5);
+}
+
+TEST(PerfTest, MakeBatchPerfResultsReportsThroughputAndTailLatency) {
+  ppc::task::BatchStats stats;
+  stats.num_tasks = 4;
+  stats.total_sec = 2.0;
+  stats.latencies = {0.1, 0.2, 0.3, 1.5};
+
+  const auto results = ppc::performance::MakeBatchPerfResults(stats);
+  EXPECT_EQ(results.type_of_running, PerfResults::TypeOfRunning::kBatch);
+  EXPECT_DOUBLE_EQ(results.time_sec, 2.0);
+  EXPECT_DOUBLE_EQ(results.batch.tasks_per_sec, 2.0);
+  EXPECT_DOUBLE_EQ(results.batch.max_latency, 1.5);
+  EXPECT_EQ(results.statistics.num_samples, 4U);
+  EXPECT_GT(results.statistics.p99, results.statistics.median);
+
+  const auto record = MakePerfRecord(RunContext{}, results);
+  EXPECT_EQ(record["mode"], "batch");
+  EXPECT_EQ(record["batch"]["num_tasks"], 4);
+  EXPECT_DOUBLE_EQ(record["batch"]["tasks_per_sec"].get<double>(), 2.0);
+}
+
+TEST(PerfTest, MakePerfRecordHoldsSizeAndThroughput) {
+  PerfResults results;
+  results.type_of_running = PerfResults::TypeOfRunning::kTaskRun;
+  results.time_sec = 0.5;
+
+  RunContext context;
+  context.problem_size = 4096;
+  auto record = MakePerfRecord(context, results);
+  EXPECT_EQ(record["problem_size"], 4096);
+  EXPECT_FALSE(record.contains("throughput"));
+
+  context.work = {.count = 2.0, .unit = "GFLOP"};
+  record = MakePerfRecord(context, results);
+  EXPECT_EQ(record["work"]["unit"], "GFLOP");
+  EXPECT_DOUBLE_EQ(record["throughput"].get<double>(), 4.0);
+}
+
+TEST(PerfTest, ParseProblemSizeReadsSizeSuffix) {
+  EXPECT_EQ(ppc::util::ParseProblemSize("example_threads_omp_enabled_size65536"), 65536U);
+  EXPECT_EQ(ppc::util::ParseProblemSize("example_threads_omp_enabled"), 0U);
+  EXPECT_EQ(ppc::util::ParseProblemSize("example_threads_omp_enabled_size12x"), 0U);
+}
+
+TEST(PerfTest, GeometricSizesGrowByRatio) {
+  constexpr auto kSizes = ppc::util::GeometricSizes<4>(1000, 4);
+  EXPECT_EQ(kSizes, (std::array<std::size_t, 4>{1000, 4000, 16000, 64000}));
+}
+
+TEST(PerfTest, MakePerfRecordHoldsContextAndStatistics) {
+  PerfResults results;
+  results.type_of_running = PerfResults::TypeOfRunning::kTaskRun;
+  results.time_sec = 0.5;
+  results.statistics.median = 0.4;
+  results.statistics.num_samples = 7;
+  results.stages.max[static_cast<std::size_t>(ppc::task::TimedStage::kRun)] = 0.6;
+  results.samples = {0.4, 0.6};
+
+  RunContext context;
+  context.task = "example_threads";
+  context.impl = "omp";
+  context.num_proc = 2;
+  context.num_threads = 4;
+  const auto record = MakePerfRecord(context, results);
+  EXPECT_EQ(record["task"], "example_threads");
+  EXPECT_EQ(record["impl"], "omp");
+  EXPECT_EQ(record["mode"], "task_run");
+  EXPECT_EQ(record["num_proc"], 2);
+  EXPECT_EQ(record["num_threads"], 4);
+  EXPECT_DOUBLE_EQ(record["time_sec"].get<double>(), 0.5);
+  EXPECT_DOUBLE_EQ(record["statistics"]["median"].get<double>(), 0.4);
+  EXPECT_EQ(record["statistics"]["num_samples"], 7);
+  EXPECT_DOUBLE_EQ(record["stages"]["run"]["max"].get<double>(), 0.6);
+  EXPECT_EQ(record["samples"].size(), 2U);
+  EXPECT_FALSE(record["timestamp"].get<std::string>().empty());
+}
+
+TEST(PerfTest, AppendPerfRecordWritesOneLinePerRecord) {
+  const auto path = std::filesystem::temp_directory_path() / "ppc_perf_results_test.jsonl";
+  std::filesystem::remove(path);
+  AppendPerfRecord(path.string(), {{"task", "a"}});
+  AppendPerfRecord(path.string(), {{"task", "b"}});
+
+  std::ifstream file(path);
+  std::string line;
+  std::vector<std::string> tasks;
+  while (std::getline(file, line)) {
+    tasks.push_back(nlohmann::json::parse(line)["task"]);
+  }
+  EXPECT_EQ(tasks, (std::vector<std::string>{"a", "b"}));
+  file.close();
+  std::filesystem::remove(path);
+}
+
+TEST(PerfTest, AppendPerfRecordThrowsIfFileCannotBeOpened) {
+  EXPECT_THROW(AppendPerfRecord("/nonexistent_dir/perf_results.jsonl", {}), std::runtime_error);
+}
+
+TEST(PerfTest, CounterValuesDeriveIpcAndMissRates) {
+  CounterValues counters;
+  counters.valid = {true, true, true, true, false};
+  counters.values = {2000.0, 4000.0, 8.0, 20.0, 0.0};
+  EXPECT_DOUBLE_EQ(counters.Ipc(), 2.0);
+  EXPECT_DOUBLE_EQ(counters.PerKiloInstruction(HardwareCounter::kLlcMisses), 2.0);
+  EXPECT_DOUBLE_EQ(counters.PerKiloInstruction(HardwareCounter::kBranchMisses), 5.0);
+  EXPECT_DOUBLE_EQ(counters.PerKiloInstruction(HardwareCounter::kDtlbMisses), 0.0);
+  EXPECT_TRUE(counters.Any());
+  EXPECT_FALSE(CounterValues{}.Any());
+}
+
+TEST(PerfTest, CounterGroupWorksWithAndWithoutCounters) {
+  CounterGroup group;
+  group.Start();
+  volatile uint64_t sum = 0;
+  for (uint64_t i = 0; i < 100000; i++) {
+    sum = sum + i;
+  }
+  group.Stop();
+  const auto values = group.Read(1);
+  if (!group.Available()) {
+    EXPECT_FALSE(values.Any());
+  } else if (values.Has(HardwareCounter::kInstructions)) {
+    EXPECT_GT(values.Get(HardwareCounter::kInstructions), 0.0);
+  }
+}
+
+TEST(PerfTest, CountersAreCollectedOnlyWhenRequested) {
+  auto task_ptr = std::make_shared<DummyTask>();
+  Perf<int, int> perf(task_ptr);
+
+  PerfAttr attr;
+  double time = 0.0;
+  attr.num_running = 2;
+  attr.current_timer = [&time]() { return time += 1.0; };
+
+  perf.PipelineRun(attr);
+  EXPECT_TRUE(perf.GetPerfResults().counters.empty());
+
+  attr.collect_counters = true;
+  perf.PipelineRun(attr);
+  EXPECT_EQ(perf.GetPerfResults().counters.size(), 1U);
+}
+
 TEST(PerfTest, PrintPerfStatisticThrowsOnNone) {
   {
     auto task_ptr = std::make_shared<DummyTask>();
@@ -366,6 +728,80 @@ TEST(PerfTest, GetStringParamNameTest) {
   EXPECT_EQ(GetStringParamName(PerfResults::TypeOfRunning::kNone), "none");
 }
 
+TEST(PerfTest, GridSearchTriesEveryCombination) {
+  const std::vector<TuneParam> space = {{.name = "a", .values = {1, 2, 3}}, {.name = "b", .values = {10, 20}}};
+  const auto cost = [](const ppc::util::TuneConfig &config) {
+    return std::abs(static_cast<double>(config.at("a") - 2)) + std::abs(static_cast<double>(config.at("b") - 20));
+  };
+  const auto result = SearchConfig(space, cost, SearchStrategy::kGrid);
+  EXPECT_EQ(result.trials.size(), 6U);
+  EXPECT_EQ(result.best, (ppc::util::TuneConfig{{"a", 2}, {"b", 20}}));
+  EXPECT_DOUBLE_EQ(result.best_time_sec, 0.0);
+
+  EXPECT_EQ(SearchConfig(space, cost, SearchStrategy::kGrid, 4).trials.size(), 4U);
+  EXPECT_THROW((void)SearchConfig({{.name = "a", .values = {}}}, cost, SearchStrategy::kGrid), std::runtime_error);
+}
+
+TEST(PerfTest, CoordinateDescentFindsSeparableOptimumWithFewerTrials) {
+  std::vector<std::int64_t> values(10);
+  for (std::size_t i = 0; i < values.size(); i++) {
+    values[i] = static_cast<std::int64_t>(i);
+  }
+  const std::vector<TuneParam> space = {{.name = "x", .values = values}, {.name = "y", .values = values}};
+  const auto cost = [](const ppc::util::TuneConfig &config) {
+    const auto dx = static_cast<double>(config.at("x") - 7);
+    const auto dy = static_cast<double>(config.at("y") - 3);
+    return (dx * dx) + (dy * dy);
+  };
+  const auto result = SearchConfig(space, cost, SearchStrategy::kCoordinateDescent);
+  EXPECT_EQ(result.best, (ppc::util::TuneConfig{{"x", 7}, {"y", 3}}));
+  EXPECT_LT(result.trials.size(), 100U);
+}
+
+namespace {
+
+double tuned_clock = 0.0;
+
+// Run takes as many clock ticks as its tuned "cost"
+class TunedTask : public DummyTask {
+ public:
+  bool PreProcessingImpl() override {
+    cost_ = static_cast<double>(ppc::util::GetTunedValue("tuned_task", "cost", 100, 1, 5));
+    return true;
+  }
+  bool RunImpl() override {
+    tuned_clock += cost_;
+    return true;
+  }
+
+ private:
+  double cost_ = 0.0;
+};
+
+}  // namespace
+
+TEST(PerfTest, AutotuneStoresTheFastestConfigForTheTask) {
+  const auto cache_file = std::filesystem::temp_directory_path() / "ppc_autotune_test.json";
+  std::filesystem::remove(cache_file);
+  PerfAttr attr;
+  attr.num_running = 2;
+  attr.bootstrap_resamples = 0;
+  attr.current_timer = [] { return tuned_clock; };
+
+  const TuneTarget target{.task = "tuned_task", .size = 100, .num_proc = 1, .cache_file = cache_file.string()};
+  const auto result = Autotune<int, int>(target, {{.name = "cost", .values = {5, 2, 9}}},
+                                         [] { return std::make_shared<TunedTask>(); }, attr);
+  EXPECT_EQ(result.trials.size(), 3U);
+  EXPECT_EQ(result.best.at("cost"), 2);
+  EXPECT_DOUBLE_EQ(result.best_time_sec, 2.0);
+
+  const ppc::util::TuningCache cache(cache_file);
+  const auto stored = cache.Find("tuned_task", 100, 1);
+  ASSERT_TRUE(stored.has_value());
+  EXPECT_EQ(stored->at("cost"), 2);
+  std::filesystem::remove(cache_file);
+}
+
 TEST(TaskTest, DestructorInvalidPipelineOrderTerminatesPartialPipeline) {
   {
     struct BadTask : Task<int, int> {
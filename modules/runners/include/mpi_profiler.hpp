@@ -0,0 +1,98 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ppc::runners {
+
+/// @brief MPI operations intercepted by the PMPI wrappers of ppc_perf_tests.
+enum class MpiOp : uint8_t {
+  kSend,
+  kRecv,
+  kBcast,
+  kScatterv,
+  kGatherv,
+  kAllgatherv,
+  kAllreduce,
+  kReduce,
+  kAlltoallv,
+  kBarrier
+};
+
+/// @brief Name of @p op, e.g. "MPI_Bcast"; a string literal, so it can name trace spans.
+const char *GetStringMpiOp(MpiOp op);
+
+/// @brief Accumulated statistics of one MPI call site.
+struct MpiCallStats {
+  uint64_t calls = 0;
+  /// @brief Size of the buffers this rank passed to the calls.
+  uint64_t bytes = 0;
+  double seconds = 0.0;
+};
+
+/// @brief Collects per-call-site statistics of MPI calls.
+/// @details The PMPI wrappers in tasks/common/runners/mpi_profiler.cpp are linked into ppc_perf_tests only and
+/// call Record() while the profiler is active, which MpiProfileReporter arranges for the duration of each test
+/// when PPC_MPI_PROFILE=1. Calls are expected from the thread that initialized MPI.
+class MpiProfiler {
+ public:
+  static MpiProfiler &Instance();
+
+  [[nodiscard]] bool Active() const {
+    return active_;
+  }
+  void SetActive(bool active) {
+    active_ = active;
+  }
+
+  /// @param call_site Return address of the intercepted call.
+  void Record(MpiOp op, const void *call_site, uint64_t bytes, double seconds);
+
+  /// @brief Returns the statistics keyed by operation and symbolized call site, and clears them.
+  std::map<std::pair<MpiOp, std::string>, MpiCallStats> TakeResolved();
+
+ private:
+  MpiProfiler() = default;
+
+  bool active_ = false;
+  std::map<std::pair<MpiOp, const void *>, MpiCallStats> calls_;
+};
+
+/// @brief Names the function containing @p address, e.g. "ns::Task::RunImpl()+0x4c".
+/// @details Falls back to "<module>+0x<offset>", which can be passed to addr2line, if the symbol is not exported.
+std::string ResolveCallSite(const void *address);
+
+/// @brief One row of the profile table, summed over the ranks.
+struct MpiProfileEntry {
+  MpiOp op = MpiOp::kSend;
+  std::string call_site;
+  MpiCallStats total;
+  /// @brief Largest time a single rank spent at this call site.
+  double max_rank_seconds = 0.0;
+};
+
+/// @brief Sorts @p entries by total time, longest first, and keeps at most @p count of them.
+std::vector<MpiProfileEntry> TopEntries(std::vector<MpiProfileEntry> entries, std::size_t count);
+
+/// @brief Renders the profile table of a test.
+std::string FormatMpiProfile(const std::string &test_name, const std::vector<MpiProfileEntry> &entries);
+
+/// @brief GTest event listener that turns the MPI profiler on for each test and prints the top call sites.
+/// @details Statistics of all ranks are merged on rank 0. Nothing is printed for tests without profiled calls.
+class MpiProfileReporter : public ::testing::EmptyTestEventListener {
+ public:
+  explicit MpiProfileReporter(std::size_t top_count) : top_count_(top_count) {}
+  void OnTestStart(const ::testing::TestInfo &test_info) override;
+  void OnTestEnd(const ::testing::TestInfo &test_info) override;
+
+ private:
+  std::size_t top_count_;
+};
+
+}  // namespace ppc::runners
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <gtest/gtest.h>
+#include <mpi.h>
 
 #include <memory>
 #include <utility>
@@ -11,11 +12,13 @@ namespace ppc::runners {
 /// @note Used to detect unexpected inter-process communication leftovers.
 class UnreadMessagesDetector : public ::testing::EmptyTestEventListener {
  public:
-  UnreadMessagesDetector() = default;
+  /// @param comm Communicator to check; every rank of it must run the tests.
+  explicit UnreadMessagesDetector(MPI_Comm comm = MPI_COMM_WORLD) : comm_(comm) {}
   /// @brief Called by GTest after a test ends. Checks for unread messages.
   void OnTestEnd(const ::testing::TestInfo & /*test_info*/) override;
 
  private:
+  MPI_Comm comm_;
 };
 
 /// @brief GTest event listener that prints additional information on test failures in worker processes.
@@ -0,0 +1,194 @@
+#include "runners/include/mpi_profiler.hpp"
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__) || defined(__APPLE__)
+#  include <cxxabi.h>
+#  include <dlfcn.h>
+
+#  include <cstdlib>
+#endif
+
+namespace ppc::runners {
+
+const char *GetStringMpiOp(MpiOp op) {
+  switch (op) {
+    case MpiOp::kSend:
+      return "MPI_Send";
+    case MpiOp::kRecv:
+      return "MPI_Recv";
+    case MpiOp::kBcast:
+      return "MPI_Bcast";
+    case MpiOp::kScatterv:
+      return "MPI_Scatterv";
+    case MpiOp::kGatherv:
+      return "MPI_Gatherv";
+    case MpiOp::kAllgatherv:
+      return "MPI_Allgatherv";
+    case MpiOp::kAllreduce:
+      return "MPI_Allreduce";
+    case MpiOp::kReduce:
+      return "MPI_Reduce";
+    case MpiOp::kAlltoallv:
+      return "MPI_Alltoallv";
+    case MpiOp::kBarrier:
+      return "MPI_Barrier";
+  }
+  return "unknown";
+}
+
+MpiProfiler &MpiProfiler::Instance() {
+  static MpiProfiler instance;
+  return instance;
+}
+
+void MpiProfiler::Record(MpiOp op, const void *call_site, uint64_t bytes, double seconds) {
+  auto &stats = calls_[{op, call_site}];
+  stats.calls++;
+  stats.bytes += bytes;
+  stats.seconds += seconds;
+}
+
+std::map<std::pair<MpiOp, std::string>, MpiCallStats> MpiProfiler::TakeResolved() {
+  std::map<std::pair<MpiOp, std::string>, MpiCallStats> resolved;
+  for (const auto &[key, stats] : calls_) {
+    auto &entry = resolved[{key.first, ResolveCallSite(key.second)}];
+    entry.calls += stats.calls;
+    entry.bytes += stats.bytes;
+    entry.seconds += stats.seconds;
+  }
+  calls_.clear();
+  return resolved;
+}
+
+std::string ResolveCallSite(const void *address) {
+  const auto addr = reinterpret_cast<std::uintptr_t>(address);
+#if defined(__linux__) || defined(__APPLE__)
+  Dl_info info{};
+  if (dladdr(address, &info) != 0) {
+    if (info.dli_sname != nullptr && info.dli_saddr != nullptr) {
+      int status = 0;
+      std::unique_ptr<char, void (*)(void *)> demangled{
+          abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status), std::free};
+      const std::string name = status == 0 ? demangled.get() : info.dli_sname;
+      return std::format("{}+0x{:x}", name, addr - reinterpret_cast<std::uintptr_t>(info.dli_saddr));
+    }
+    if (info.dli_fname != nullptr && info.dli_fbase != nullptr) {
+      return std::format("{}+0x{:x}", std::filesystem::path(info.dli_fname).filename().string(),
+                         addr - reinterpret_cast<std::uintptr_t>(info.dli_fbase));
+    }
+  }
+#endif
+  return std::format("0x{:x}", addr);
+}
+
+std::vector<MpiProfileEntry> TopEntries(std::vector<MpiProfileEntry> entries, std::size_t count) {
+  std::ranges::sort(entries, [](const MpiProfileEntry &a, const MpiProfileEntry &b) {
+    return a.total.seconds > b.total.seconds;
+  });
+  if (entries.size() > count) {
+    entries.resize(count);
+  }
+  return entries;
+}
+
+std::string FormatMpiProfile(const std::string &test_name, const std::vector<MpiProfileEntry> &entries) {
+  std::stringstream out;
+  out << std::format("[ MPI PROFILE ] {}\n", test_name);
+  out << std::format("{:>14} {:>14} {:>10} {:>14}  {:<15} {}\n", "time_sum(s)", "time_max(s)", "calls", "bytes", "op",
+                     "call site");
+  for (const auto &entry : entries) {
+    out << std::format("{:>14.6f} {:>14.6f} {:>10} {:>14}  {:<15} {}\n", entry.total.seconds, entry.max_rank_seconds,
+                       entry.total.calls, entry.total.bytes, GetStringMpiOp(entry.op), entry.call_site);
+  }
+  return out.str();
+}
+
+namespace {
+
+// Serializes the local statistics and merges those of all ranks on rank 0
+std::vector<MpiProfileEntry> GatherProfile(const std::map<std::pair<MpiOp, std::string>, MpiCallStats> &local) {
+  int rank = 0;
+  int size = 1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  nlohmann::json local_json = nlohmann::json::array();
+  for (const auto &[key, stats] : local) {
+    local_json.push_back({static_cast<int>(key.first), key.second, stats.calls, stats.bytes, stats.seconds});
+  }
+  const std::string payload = local_json.dump();
+  int length = static_cast<int>(payload.size());
+
+  std::vector<int> lengths(rank == 0 ? size : 0);
+  MPI_Gather(&length, 1, MPI_INT, lengths.data(), 1, MPI_INT, 0, MPI_COMM_WORLD);
+  std::vector<int> displs(lengths.size());
+  std::string all;
+  if (rank == 0) {
+    for (std::size_t i = 1; i < lengths.size(); i++) {
+      displs[i] = displs[i - 1] + lengths[i - 1];
+    }
+    all.resize(static_cast<std::size_t>(displs.back() + lengths.back()));
+  }
+  MPI_Gatherv(payload.data(), length, MPI_CHAR, all.data(), lengths.data(), displs.data(), MPI_CHAR, 0,
+              MPI_COMM_WORLD);
+  if (rank != 0) {
+    return {};
+  }
+
+  std::map<std::pair<MpiOp, std::string>, MpiProfileEntry> merged;
+  for (std::size_t i = 0; i < lengths.size(); i++) {
+    const auto rank_json = nlohmann::json::parse(all.substr(static_cast<std::size_t>(displs[i]),
+                                                            static_cast<std::size_t>(lengths[i])));
+    for (const auto &row : rank_json) {
+      const auto op = static_cast<MpiOp>(row[0].get<int>());
+      auto &entry = merged[{op, row[1].get<std::string>()}];
+      entry.op = op;
+      entry.call_site = row[1].get<std::string>();
+      entry.total.calls += row[2].get<uint64_t>();
+      entry.total.bytes += row[3].get<uint64_t>();
+      entry.total.seconds += row[4].get<double>();
+      entry.max_rank_seconds = std::max(entry.max_rank_seconds, row[4].get<double>());
+    }
+  }
+  std::vector<MpiProfileEntry> entries;
+  entries.reserve(merged.size());
+  for (auto &[key, entry] : merged) {
+    entries.push_back(std::move(entry));
+  }
+  return entries;
+}
+
+}  // namespace
+
+void MpiProfileReporter::OnTestStart(const ::testing::TestInfo & /*test_info*/) {
+  MpiProfiler::Instance().SetActive(true);
+}
+
+void MpiProfileReporter::OnTestEnd(const ::testing::TestInfo &test_info) {
+  auto &profiler = MpiProfiler::Instance();
+  profiler.SetActive(false);
+  const auto entries = GatherProfile(profiler.TakeResolved());
+  if (entries.empty()) {
+    return;
+  }
+  const std::string test_name = std::string(test_info.test_suite_name()) + "." + test_info.name();
+  std::cout << FormatMpiProfile(test_name, TopEntries(entries, top_count_)) << std::flush;
+}
+
+}  // namespace ppc::runners
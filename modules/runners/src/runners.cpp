@@ -2,8 +2,11 @@
 
 #include <gtest/gtest.h>
 #include <mpi.h>
+#include <omp.h>
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <exception>
@@ -14,22 +17,29 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include "oneapi/tbb/global_control.h"
+#include "oneapi/tbb/task_arena.h"
+#include "oneapi/tbb/task_scheduler_observer.h"
+#include "runners/include/mpi_profiler.hpp"
+#include "util/include/affinity.hpp"
+#include "util/include/trace.hpp"
 #include "util/include/util.hpp"
 
 namespace ppc::runners {
 
 void UnreadMessagesDetector::OnTestEnd(const ::testing::TestInfo & /*test_info*/) {
   int rank = -1;
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_rank(comm_, &rank);
 
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(comm_);
 
   int flag = -1;
   MPI_Status status;
 
-  const int iprobe_res = MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, MPI_COMM_WORLD, &flag, &status);
+  const int iprobe_res = MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm_, &flag, &status);
   if (iprobe_res != MPI_SUCCESS) {
     std::cerr << std::format("[  PROCESS {}  ] [  ERROR  ] MPI_Iprobe failed with code {}", rank, iprobe_res) << '\n';
     MPI_Abort(MPI_COMM_WORLD, iprobe_res);
@@ -44,7 +54,7 @@ void UnreadMessagesDetector::OnTestEnd(const ::testing::TestInfo & /*test_info*/
     MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
   }
 
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(comm_);
 }
 
 void WorkerTestFailurePrinter::OnTestEnd(const ::testing::TestInfo &test_info) {
@@ -137,6 +147,97 @@ int RunAllTestsSafely() {
     return EXIT_FAILURE;
   }
 }
+
+// OpenMP, TBB and ThreadPool workers take one CPU of the rank each; the main thread keeps the whole set, so the
+// threads it starts later are not all stuck on one CPU
+class TbbPinningObserver : public tbb::task_scheduler_observer {
+ public:
+  TbbPinningObserver() {
+    observe(true);
+  }
+  ~TbbPinningObserver() override {
+    observe(false);
+  }
+
+  TbbPinningObserver(const TbbPinningObserver &) = delete;
+  TbbPinningObserver &operator=(const TbbPinningObserver &) = delete;
+  TbbPinningObserver(TbbPinningObserver &&) = delete;
+  TbbPinningObserver &operator=(TbbPinningObserver &&) = delete;
+
+  void on_scheduler_entry(bool is_worker) override {
+    if (is_worker) {
+      ppc::util::PinThreadToSlot(tbb::this_task_arena::current_thread_index());
+    }
+  }
+};
+
+// Restricts the rank to its CPUs under the PPC_PIN policy; returns false if nothing was pinned
+bool PinRankToCpus() {
+  ppc::util::PinPolicy policy = ppc::util::PinPolicy::kNone;
+  try {
+    policy = ppc::util::ParsePinPolicy(ppc::util::GetPinPolicy());
+  } catch (const std::exception &e) {
+    std::cerr << std::format("[  WARNING  ] {}; ranks are not pinned", e.what()) << '\n';
+  }
+  if (policy == ppc::util::PinPolicy::kNone) {
+    return false;
+  }
+
+  MPI_Comm node_comm = MPI_COMM_NULL;
+  MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &node_comm);
+  int local_rank = 0;
+  int local_size = 1;
+  MPI_Comm_rank(node_comm, &local_rank);
+  MPI_Comm_size(node_comm, &local_size);
+
+  // A rank that cannot read the topology stays unpinned, but still takes part in the reductions of its node
+  std::vector<ppc::util::CpuInfo> topology;
+  try {
+    topology = ppc::util::ReadCpuTopology();
+  } catch (const std::exception &e) {
+    std::cerr << std::format("[  WARNING  ] {}; ranks are not pinned", e.what()) << '\n';
+  }
+  int local_max_cpu = -1;
+  for (const auto &cpu : topology) {
+    local_max_cpu = std::max(local_max_cpu, cpu.cpu);
+  }
+  int max_cpu = -1;
+  MPI_Allreduce(&local_max_cpu, &max_cpu, 1, MPI_INT, MPI_MAX, node_comm);
+
+  // Only the CPUs the launcher gave to some rank of this node are used
+  std::vector<int> local_allowed(static_cast<std::size_t>(max_cpu + 1));
+  for (const int cpu : ppc::util::GetThreadAffinity()) {
+    if (cpu <= max_cpu) {
+      local_allowed[static_cast<std::size_t>(cpu)] = 1;
+    }
+  }
+  std::vector<int> allowed(local_allowed.size());
+  MPI_Allreduce(local_allowed.data(), allowed.data(), static_cast<int>(allowed.size()), MPI_INT, MPI_MAX, node_comm);
+  MPI_Comm_free(&node_comm);
+  std::erase_if(topology,
+                [&](const ppc::util::CpuInfo &cpu) { return allowed[static_cast<std::size_t>(cpu.cpu)] == 0; });
+
+  auto cpus = ppc::util::RankCpus(std::move(topology), policy, local_rank, local_size);
+  if (cpus.empty()) {
+    return false;
+  }
+  try {
+    ppc::util::SetThreadAffinity(cpus);
+  } catch (const std::exception &e) {
+    std::cerr << std::format("[  WARNING  ] {}; ranks are not pinned", e.what()) << '\n';
+    return false;
+  }
+  ppc::util::SetThreadPlacement(std::move(cpus));
+
+  // The OpenMP threads stay alive between tasks, so pinning them once is enough
+#pragma omp parallel default(none) num_threads(ppc::util::GetNumThreads())
+  {
+    if (omp_get_thread_num() > 0) {
+      ppc::util::PinThreadToSlot(omp_get_thread_num());
+    }
+  }
+  return true;
+}
 }  // namespace
 
 int Init(int argc, char **argv) {
@@ -150,6 +251,11 @@ int Init(int argc, char **argv) {
   // Limit the number of threads in TBB
   tbb::global_control control(tbb::global_control::max_allowed_parallelism, ppc::util::GetNumThreads());
 
+  std::unique_ptr<TbbPinningObserver> tbb_pinning;
+  if (PinRankToCpus()) {
+    tbb_pinning = std::make_unique<TbbPinningObserver>();
+  }
+
   ::testing::InitGoogleTest(&argc, argv);
 
   // Synchronize GoogleTest internals across ranks to avoid divergence
@@ -165,9 +271,31 @@ int Init(int argc, char **argv) {
     listeners.Append(new WorkerTestFailurePrinter(std::shared_ptr<::testing::TestEventListener>(listener)));
   }
   listeners.Append(new UnreadMessagesDetector());
+  // Appended last so that it stops recording before the other listeners communicate at the end of a test
+  if (const int profile_top = ppc::util::GetMpiProfileTop(); profile_top > 0) {
+    listeners.Append(new MpiProfileReporter(static_cast<std::size_t>(profile_top)));
+  }
+
+  const std::string trace_dir = ppc::util::GetTraceDir();
+  if (!trace_dir.empty()) {
+    ppc::util::StartTracing(MPI_COMM_WORLD);
+  }
 
   const int status = RunAllTestsSafely();
 
+  if (!trace_dir.empty()) {
+    try {
+      ppc::util::FinishTracing(trace_dir, MPI_COMM_WORLD);
+    } catch (const std::exception &e) {
+      std::cerr << std::format("[  ERROR  ] {}", e.what()) << '\n';
+    }
+  }
+
+#if _OPENMP >= 201811
+  // OpenMP threads are kept between tasks; releasing them once here lets leak checkers see a clean exit
+  omp_pause_resource_all(omp_pause_hard);
+#endif
+
   const int finalize_res = MPI_Finalize();
   if (finalize_res != MPI_SUCCESS) {
     std::cerr << std::format("[  ERROR  ] MPI_Finalize failed with code {}", finalize_res) << '\n';
@@ -0,0 +1,59 @@
+#include "runners/include/mpi_profiler.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace ppc::runners {
+
+namespace {
+
+void ProfiledFunction() {}
+
+}  // namespace
+
+TEST(MpiProfiler, RecordsOnlyWhileActiveAndMergesCallSites) {
+  auto &profiler = MpiProfiler::Instance();
+  profiler.TakeResolved();
+  profiler.Record(MpiOp::kBcast, reinterpret_cast<const void *>(&ProfiledFunction), 64, 0.5);
+  profiler.Record(MpiOp::kBcast, reinterpret_cast<const void *>(&ProfiledFunction), 32, 0.25);
+  profiler.Record(MpiOp::kSend, reinterpret_cast<const void *>(&ProfiledFunction), 8, 0.125);
+
+  const auto resolved = profiler.TakeResolved();
+  ASSERT_EQ(resolved.size(), 2U);
+  const auto &bcast = resolved.begin()->first.first == MpiOp::kBcast ? resolved.begin()->second
+                                                                      : resolved.rbegin()->second;
+  EXPECT_EQ(bcast.calls, 2U);
+  EXPECT_EQ(bcast.bytes, 96U);
+  EXPECT_DOUBLE_EQ(bcast.seconds, 0.75);
+  EXPECT_TRUE(profiler.TakeResolved().empty());
+}
+
+TEST(MpiProfiler, ResolvesCallSite) {
+  EXPECT_FALSE(ResolveCallSite(reinterpret_cast<const void *>(&ProfiledFunction)).empty());
+}
+
+TEST(MpiProfiler, TopEntriesKeepsTheSlowest) {
+  std::vector<MpiProfileEntry> entries(3);
+  entries[0].total.seconds = 1.0;
+  entries[1].total.seconds = 3.0;
+  entries[2].total.seconds = 2.0;
+  const auto top = TopEntries(entries, 2);
+  ASSERT_EQ(top.size(), 2U);
+  EXPECT_DOUBLE_EQ(top[0].total.seconds, 3.0);
+  EXPECT_DOUBLE_EQ(top[1].total.seconds, 2.0);
+}
+
+TEST(MpiProfiler, FormatListsOperationAndCallSite) {
+  MpiProfileEntry entry;
+  entry.op = MpiOp::kAllreduce;
+  entry.call_site = "ns::Task::RunImpl()+0x10";
+  entry.total.calls = 4;
+  const auto table = FormatMpiProfile("Suite.Test", {entry});
+  EXPECT_NE(table.find("Suite.Test"), std::string::npos);
+  EXPECT_NE(table.find("MPI_Allreduce"), std::string::npos);
+  EXPECT_NE(table.find("ns::Task::RunImpl()+0x10"), std::string::npos);
+}
+
+}  // namespace ppc::runners
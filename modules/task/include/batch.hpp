@@ -0,0 +1,255 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "task/include/task.hpp"
+#include "util/include/util.hpp"
+
+namespace ppc::task {
+
+/// @brief How BatchExecutor spreads the tasks of a batch.
+enum class BatchMode : uint8_t {
+  /// @brief Every process runs the whole batch on its own threads, several tasks at a time. For SEQ and threaded
+  /// tasks only: MPI tasks are rejected, since concurrent instances would all talk over the same communicator.
+  kThreads,
+  /// @brief Rank 0 hands the tasks out one at a time to the ranks that ask for work (manager/worker) and collects
+  /// their outputs. Every task runs on MPI_COMM_SELF of its worker, passed with Task::SetComm().
+  /// @warning MPI tasks must communicate only over GetComm(). A task that calls collectives on MPI_COMM_WORLD
+  /// directly, as most tasks in tasks/ do, waits for ranks that are busy with other tasks and deadlocks the batch;
+  /// run such tasks one at a time instead.
+  kRanks
+};
+
+/// @brief Timing of the latest batch run.
+struct BatchStats {
+  std::size_t num_tasks = 0;
+  /// @brief Wall time of the whole batch in seconds.
+  double total_sec = 0.0;
+  /// @brief Time from Validation to the end of PostProcessing of every task, indexed like the batch.
+  /// @details In kRanks mode only rank 0 has them.
+  std::vector<double> latencies;
+};
+
+namespace detail {
+
+/// @brief Manager side of a task farm over @p comm: answers work requests with the indices [0, @p count) and then
+/// with a stop signal. @p store receives the @p payload_bytes every worker sends back for an index.
+/// @return True if a worker reported a failed task; the remaining indices are then not handed out.
+bool FarmManager(std::size_t count, std::size_t payload_bytes, MPI_Comm comm,
+                 const std::function<void(std::size_t, const std::byte *)> &store);
+
+/// @brief Worker side of a task farm over @p comm: requests indices from rank 0 until it stops and fills
+/// @p payload_bytes for each of them with @p run.
+/// @return The exception thrown by @p run, which is reported to the manager instead of a result, or null.
+std::exception_ptr FarmWorker(std::size_t payload_bytes, MPI_Comm comm,
+                              const std::function<void(std::size_t, std::byte *)> &run);
+
+/// @brief Duplicate of a communicator that is freed when it goes out of scope.
+class OwnedComm {
+ public:
+  explicit OwnedComm(MPI_Comm comm) {
+    MPI_Comm_dup(comm, &comm_);
+  }
+  ~OwnedComm() {
+    MPI_Comm_free(&comm_);
+  }
+
+  OwnedComm(const OwnedComm &) = delete;
+  OwnedComm &operator=(const OwnedComm &) = delete;
+  OwnedComm(OwnedComm &&) = delete;
+  OwnedComm &operator=(OwnedComm &&) = delete;
+
+  [[nodiscard]] MPI_Comm Get() const {
+    return comm_;
+  }
+
+ private:
+  MPI_Comm comm_ = MPI_COMM_NULL;
+};
+
+}  // namespace detail
+
+/// @brief Runs many small independent instances of one task type and reports their throughput.
+/// @details Tasks are created from the inputs only where they run, so each instance goes through its pipeline
+/// exactly once. Instances are dispatched dynamically: a fast worker simply takes more of them.
+/// @tparam InType Input data type.
+/// @tparam OutType Output data type; it must be trivially copyable for kRanks mode.
+template <typename InType, typename OutType>
+class BatchExecutor {
+ public:
+  using TaskGetterType = std::function<TaskPtr<InType, OutType>(InType)>;
+
+  /// @param task_getter Creates a task from an input, e.g. ppc::task::TaskGetter<TaskType, InType>.
+  /// @param inputs Inputs of the batch.
+  BatchExecutor(TaskGetterType task_getter, std::vector<InType> inputs)
+      : task_getter_(std::move(task_getter)), inputs_(std::move(inputs)) {}
+
+  /// @brief Runs every task of the batch once.
+  /// @param mode How the tasks are spread.
+  /// @param num_threads Threads per process in kThreads mode.
+  /// @param comm Ranks taking part in kRanks mode; the call is collective over it.
+  /// @return Outputs indexed like the inputs. In kRanks mode only rank 0 gets them, the other ranks get an empty
+  /// vector.
+  /// @throws std::runtime_error If a stage of a task fails, kThreads is used with an MPI task or kRanks with a non
+  /// trivially copyable output. In kRanks mode a failure on one rank stops the farm and is thrown on every rank.
+  std::vector<OutType> Run(BatchMode mode, int num_threads = ppc::util::GetNumThreads(),
+                           MPI_Comm comm = MPI_COMM_WORLD) {
+    stats_ = {};
+    stats_.num_tasks = inputs_.size();
+    if (mode == BatchMode::kThreads) {
+      return RunOnThreads(num_threads);
+    }
+    return RunOnRanks(comm);
+  }
+
+  /// @brief Returns the timing of the latest Run().
+  [[nodiscard]] const BatchStats &GetStats() const {
+    return stats_;
+  }
+
+ private:
+  TaskGetterType task_getter_;
+  std::vector<InType> inputs_;
+  BatchStats stats_;
+
+  static double SecondsSince(std::chrono::high_resolution_clock::time_point begin) {
+    return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - begin).count();
+  }
+
+  // Output and latency of the task made from the input at index; MPI_COMM_NULL marks a run on a thread
+  std::pair<OutType, double> RunOne(std::size_t index, MPI_Comm comm) {
+    auto task = task_getter_(inputs_[index]);
+    if (comm != MPI_COMM_NULL) {
+      task->SetComm(comm);
+    } else if (task->GetDynamicTypeOfTask() == TypeOfTask::kMPI || task->GetDynamicTypeOfTask() == TypeOfTask::kALL) {
+      throw std::runtime_error("Batches on threads cannot run MPI tasks, use BatchMode::kRanks");
+    }
+    const auto begin = std::chrono::high_resolution_clock::now();
+    if (!task->Validation() || !task->PreProcessing() || !task->Run() || !task->PostProcessing()) {
+      throw std::runtime_error("Task " + std::to_string(index) + " of the batch failed");
+    }
+    return {std::move(task->GetOutput()), SecondsSince(begin)};
+  }
+
+  std::vector<OutType> RunOnThreads(int num_threads) {
+    const std::size_t count = inputs_.size();
+    // Pairs rather than a vector<OutType>, so that bool outputs are not packed into shared words
+    std::vector<std::pair<OutType, double>> results(count);
+    std::atomic<std::size_t> next = 0;
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    const auto begin = std::chrono::high_resolution_clock::now();
+    {
+      const auto workers_count = std::clamp<std::size_t>(static_cast<std::size_t>(std::max(num_threads, 1)), 1,
+                                                         std::max<std::size_t>(count, 1));
+      std::vector<std::jthread> workers;
+      workers.reserve(workers_count);
+      for (std::size_t worker = 0; worker < workers_count; worker++) {
+        workers.emplace_back([&] {
+          for (std::size_t index = next++; index < count; index = next++) {
+            try {
+              results[index] = RunOne(index, MPI_COMM_NULL);
+            } catch (...) {
+              const std::scoped_lock lock(error_mutex);
+              if (!error) {
+                error = std::current_exception();
+              }
+              next = count;
+            }
+          }
+        });
+      }
+    }
+    stats_.total_sec = SecondsSince(begin);
+    if (error) {
+      std::rethrow_exception(error);
+    }
+    return TakeOutputs(results);
+  }
+
+  // Splits the results into the outputs it returns and the latencies of the stats
+  std::vector<OutType> TakeOutputs(std::vector<std::pair<OutType, double>> &results) {
+    std::vector<OutType> outputs;
+    outputs.reserve(results.size());
+    stats_.latencies.reserve(results.size());
+    for (auto &[output, latency] : results) {
+      outputs.push_back(std::move(output));
+      stats_.latencies.push_back(latency);
+    }
+    return outputs;
+  }
+
+  std::vector<OutType> RunOnRanks(MPI_Comm comm) {
+    if constexpr (!std::is_trivially_copyable_v<OutType>) {
+      throw std::runtime_error("Batches over ranks need a trivially copyable output type");
+    } else {
+      // A private copy of the communicator keeps the farm messages apart from any other traffic
+      const detail::OwnedComm owned_farm(comm);
+      const MPI_Comm farm = owned_farm.Get();
+      int rank = 0;
+      int size = 1;
+      MPI_Comm_rank(farm, &rank);
+      MPI_Comm_size(farm, &size);
+
+      const std::size_t count = inputs_.size();
+      std::vector<std::pair<OutType, double>> results(rank == 0 ? count : 0);
+      constexpr std::size_t kPayloadBytes = sizeof(double) + sizeof(OutType);
+      std::exception_ptr error;
+      bool failed = false;
+
+      MPI_Barrier(farm);
+      const auto begin = std::chrono::high_resolution_clock::now();
+      if (size == 1) {
+        try {
+          for (std::size_t index = 0; index < count; index++) {
+            results[index] = RunOne(index, MPI_COMM_SELF);
+          }
+        } catch (...) {
+          error = std::current_exception();
+        }
+      } else if (rank == 0) {
+        failed = detail::FarmManager(count, kPayloadBytes, farm, [&](std::size_t index, const std::byte *payload) {
+          std::memcpy(&results[index].second, payload, sizeof(double));
+          std::memcpy(&results[index].first, payload + sizeof(double), sizeof(OutType));
+        });
+      } else {
+        error = detail::FarmWorker(kPayloadBytes, farm, [&](std::size_t index, std::byte *payload) {
+          const auto [output, latency] = RunOne(index, MPI_COMM_SELF);
+          std::memcpy(payload, &latency, sizeof(double));
+          std::memcpy(payload + sizeof(double), &output, sizeof(OutType));
+        });
+      }
+      stats_.total_sec = SecondsSince(begin);
+
+      // Every rank has left the farm: a failure anywhere is thrown everywhere
+      int any_failed = (failed || error) ? 1 : 0;
+      MPI_Allreduce(MPI_IN_PLACE, &any_failed, 1, MPI_INT, MPI_LOR, farm);
+      if (error) {
+        std::rethrow_exception(error);
+      }
+      if (any_failed != 0) {
+        throw std::runtime_error("A task of the batch failed on another rank");
+      }
+      return TakeOutputs(results);
+    }
+  }
+};
+
+}  // namespace ppc::task
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <mpi.h>
+
+namespace ppc::task {
+
+/// @brief Split of a communicator into groups of consecutive ranks that run independent task instances.
+/// @details Group g holds the ranks [g * size / count, (g + 1) * size / count) of the parent communicator, so the
+/// groups differ in size by at most one rank. Pass Group() to Task::SetComm() to run a task on the group of the
+/// calling rank; the tasks of different groups then run concurrently.
+class CommGroups {
+ public:
+  /// @param count Number of groups.
+  /// @param comm Communicator to split.
+  /// @throws std::runtime_error If @p count is not between 1 and the size of @p comm, or the split fails.
+  explicit CommGroups(int count, MPI_Comm comm = MPI_COMM_WORLD);
+  ~CommGroups();
+
+  CommGroups(const CommGroups &) = delete;
+  CommGroups &operator=(const CommGroups &) = delete;
+  CommGroups(CommGroups &&) = delete;
+  CommGroups &operator=(CommGroups &&) = delete;
+
+  /// @brief Communicator of the group of the calling rank.
+  [[nodiscard]] MPI_Comm Group() const {
+    return group_;
+  }
+  /// @brief Index of the group of the calling rank.
+  [[nodiscard]] int GroupIndex() const {
+    return group_index_;
+  }
+  [[nodiscard]] int GroupCount() const {
+    return group_count_;
+  }
+  [[nodiscard]] int GroupRank() const {
+    return group_rank_;
+  }
+  [[nodiscard]] int GroupSize() const {
+    return group_size_;
+  }
+
+  /// @brief Index of the group that holds @p rank of a communicator of @p size ranks split into @p count groups.
+  static int GroupOf(int rank, int size, int count) {
+    return (((rank + 1) * count) - 1) / size;
+  }
+
+ private:
+  MPI_Comm group_ = MPI_COMM_NULL;
+  int group_index_ = 0;
+  int group_count_ = 1;
+  int group_rank_ = 0;
+  int group_size_ = 1;
+};
+
+}  // namespace ppc::task
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+
+namespace ppc::task {
+
+/// @brief Node-level split of a communicator for hybrid (kALL) tasks.
+/// @details Ranks that share memory are grouped with MPI_Comm_split_type(MPI_COMM_TYPE_SHARED).
+/// Rank 0 of every node group is its leader, and the leaders form a second communicator.
+/// The rank order of the parent communicator is kept, so its rank 0 is always a leader.
+/// Hybrid tasks are meant to be launched with one rank per node or socket (e.g. `mpirun --map-by socket`)
+/// and to split the local work across PPC_NUM_THREADS threads.
+class NodeComm {
+ public:
+  /// @throws std::runtime_error If the communicator cannot be split.
+  explicit NodeComm(MPI_Comm comm = MPI_COMM_WORLD);
+  ~NodeComm();
+
+  NodeComm(const NodeComm &) = delete;
+  NodeComm &operator=(const NodeComm &) = delete;
+  NodeComm(NodeComm &&) = delete;
+  NodeComm &operator=(NodeComm &&) = delete;
+
+  /// @brief Communicator of the ranks on this node.
+  [[nodiscard]] MPI_Comm Node() const {
+    return node_;
+  }
+  /// @brief Communicator of the node leaders; MPI_COMM_NULL on the other ranks.
+  [[nodiscard]] MPI_Comm Leaders() const {
+    return leaders_;
+  }
+  [[nodiscard]] int NodeRank() const {
+    return node_rank_;
+  }
+  [[nodiscard]] int NodeSize() const {
+    return node_size_;
+  }
+  [[nodiscard]] bool IsLeader() const {
+    return node_rank_ == 0;
+  }
+
+ private:
+  MPI_Comm node_ = MPI_COMM_NULL;
+  MPI_Comm leaders_ = MPI_COMM_NULL;
+  int node_rank_ = 0;
+  int node_size_ = 1;
+};
+
+/// @brief Array of trivially copyable elements stored once per node in an MPI shared-memory window.
+/// @details The node leader allocates the memory and every rank of the node maps the same buffer,
+/// so replicated data (a broadcast matrix, a graph) costs one copy per node instead of one per rank.
+/// The window stays in a passive-target epoch (MPI_Win_lock_all) for its whole lifetime, and the ranks access it
+/// with plain loads and stores ordered by Sync(), as the unified memory model of shared windows allows.
+template <typename T>
+class NodeSharedArray {
+ public:
+  /// @throws std::runtime_error If the window cannot be allocated.
+  NodeSharedArray(const NodeComm &comm, std::size_t count) : comm_(comm), count_(count) {
+    const auto local_bytes = static_cast<MPI_Aint>(comm.IsLeader() ? count * sizeof(T) : 0);
+    void *base = nullptr;
+    if (MPI_Win_allocate_shared(local_bytes, sizeof(T), MPI_INFO_NULL, comm.Node(), &base, &win_) != MPI_SUCCESS) {
+      throw std::runtime_error("Failed to allocate a node shared window");
+    }
+    MPI_Aint size = 0;
+    int disp_unit = 0;
+    MPI_Win_shared_query(win_, 0, &size, &disp_unit, &base);
+    data_ = static_cast<T *>(base);
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, win_);
+  }
+  ~NodeSharedArray() {
+    MPI_Win_unlock_all(win_);
+    MPI_Win_free(&win_);
+  }
+
+  NodeSharedArray(const NodeSharedArray &) = delete;
+  NodeSharedArray &operator=(const NodeSharedArray &) = delete;
+  NodeSharedArray(NodeSharedArray &&) = delete;
+  NodeSharedArray &operator=(NodeSharedArray &&) = delete;
+
+  [[nodiscard]] std::span<T> Data() const {
+    return {data_, count_};
+  }
+
+  /// @brief Makes the stores of every rank on the node visible to the others. Collective over the node.
+  void Sync() {
+    // Completes the own stores, waits for the other ranks to do the same and then observes theirs
+    MPI_Win_sync(win_);
+    MPI_Barrier(comm_.Node());
+    MPI_Win_sync(win_);
+  }
+
+  /// @brief Copies the buffer of the root's node into the buffers of all other nodes.
+  /// @details Must be called by every rank after the root (rank 0 of the parent communicator) has written its
+  /// node buffer. Only the leaders communicate; the data is sent in chunks that fit into an int count.
+  void BroadcastFromRoot() {
+    Sync();
+    if (comm_.IsLeader()) {
+      auto *bytes = reinterpret_cast<char *>(data_);
+      const std::size_t total = count_ * sizeof(T);
+      for (std::size_t offset = 0; offset < total; offset += INT_MAX) {
+        const auto chunk = static_cast<int>(std::min<std::size_t>(INT_MAX, total - offset));
+        MPI_Bcast(bytes + offset, chunk, MPI_BYTE, 0, comm_.Leaders());
+      }
+    }
+    Sync();
+  }
+
+ private:
+  const NodeComm &comm_;
+  MPI_Win win_ = MPI_WIN_NULL;
+  T *data_ = nullptr;
+  std::size_t count_ = 0;
+};
+
+}  // namespace ppc::task
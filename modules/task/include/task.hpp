@@ -1,9 +1,11 @@
 #pragma once
 
+#include <mpi.h>
 #include <omp.h>
 
 #include <array>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <fstream>
@@ -13,6 +15,8 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <util/include/memory_usage.hpp>
+#include <util/include/trace.hpp>
 #include <util/include/util.hpp>
 #include <utility>
 
@@ -98,6 +102,31 @@ inline std::string GetStringTaskType(TypeOfTask type_of_task, const std::string
 
 enum class StateOfTesting : uint8_t { kFunc, kPerf };
 
+/// @brief Pipeline stages whose wall time is recorded by Task.
+enum class TimedStage : uint8_t { kValidation, kPreProcessing, kRun, kPostProcessing };
+
+/// @brief Seconds spent in each TimedStage, indexed by the enum value.
+using StageTimings = std::array<double, 4>;
+
+/// @brief Allocations made through operator new during each TimedStage, indexed by the enum value.
+/// @details Counted only in binaries that link the counting operator new (ppc_perf_tests), zero elsewhere.
+using StageAllocations = std::array<ppc::util::AllocationStats, 4>;
+
+/// @brief Returns the name of a timed stage as used in perf output.
+inline std::string GetStringTimedStage(TimedStage stage) {
+  switch (stage) {
+    case TimedStage::kValidation:
+      return "validation";
+    case TimedStage::kPreProcessing:
+      return "pre_processing";
+    case TimedStage::kRun:
+      return "run";
+    case TimedStage::kPostProcessing:
+      return "post_processing";
+  }
+  return "unknown";
+}
+
 template <typename InType, typename OutType>
 /// @brief Base abstract class representing a generic task with a defined pipeline.
 /// @tparam InType Input data type.
@@ -113,7 +142,12 @@ class Task {
       stage_ = PipelineStage::kException;
       throw std::runtime_error("Validation should be called before preprocessing");
     }
-    return ValidationImpl();
+    const auto allocations_begin = ppc::util::CurrentAllocations();
+    const ppc::util::TraceSpan span("Validation", "task");
+    const auto begin = std::chrono::high_resolution_clock::now();
+    const bool result = ValidationImpl();
+    RecordStage(TimedStage::kValidation, begin, allocations_begin);
+    return result;
   }
 
   /// @brief Performs preprocessing on the input data.
@@ -128,7 +162,12 @@ class Task {
     if (state_of_testing_ == StateOfTesting::kFunc) {
       InternalTimeTest();
     }
-    return PreProcessingImpl();
+    const auto allocations_begin = ppc::util::CurrentAllocations();
+    const ppc::util::TraceSpan span("PreProcessing", "task");
+    const auto begin = std::chrono::high_resolution_clock::now();
+    const bool result = PreProcessingImpl();
+    RecordStage(TimedStage::kPreProcessing, begin, allocations_begin);
+    return result;
   }
 
   /// @brief Executes the main logic of the task.
@@ -140,7 +179,12 @@ class Task {
       stage_ = PipelineStage::kException;
       throw std::runtime_error("Run should be called after preprocessing");
     }
-    return RunImpl();
+    const auto allocations_begin = ppc::util::CurrentAllocations();
+    const ppc::util::TraceSpan span("Run", "task");
+    const auto begin = std::chrono::high_resolution_clock::now();
+    const bool result = RunImpl();
+    RecordStage(TimedStage::kRun, begin, allocations_begin);
+    return result;
   }
 
   /// @brief Performs postprocessing on the output data.
@@ -155,7 +199,24 @@ class Task {
     if (state_of_testing_ == StateOfTesting::kFunc) {
       InternalTimeTest();
     }
-    return PostProcessingImpl();
+    const auto allocations_begin = ppc::util::CurrentAllocations();
+    const ppc::util::TraceSpan span("PostProcessing", "task");
+    const auto begin = std::chrono::high_resolution_clock::now();
+    const bool result = PostProcessingImpl();
+    RecordStage(TimedStage::kPostProcessing, begin, allocations_begin);
+    return result;
+  }
+
+  /// @brief Returns the wall time of the latest call of each pipeline stage.
+  /// @return Seconds per stage, indexed by TimedStage.
+  [[nodiscard]] const StageTimings &GetStageTimings() const {
+    return stage_timings_;
+  }
+
+  /// @brief Returns the allocations of the latest call of each pipeline stage.
+  /// @return Allocation count and bytes per stage, indexed by TimedStage.
+  [[nodiscard]] const StageAllocations &GetStageAllocations() const {
+    return stage_allocations_;
   }
 
   /// @brief Returns the current testing mode.
@@ -188,12 +249,36 @@ class Task {
     return TypeOfTask::kUnknown;
   }
 
+  /// @brief Sets the communicator the task runs on.
+  /// @details Lets several task instances run concurrently on disjoint rank groups (see CommGroups) or a task run
+  /// on a sub-communicator inside another task. Implementations must communicate over GetComm() for this to work.
+  /// @param comm Communicator to use; it must stay valid until the pipeline is done.
+  /// @throws std::runtime_error If the pipeline is in progress.
+  void SetComm(MPI_Comm comm) {
+    if (stage_ != PipelineStage::kNone && stage_ != PipelineStage::kDone) {
+      throw std::runtime_error("Communicator should be set before validation");
+    }
+    comm_ = comm;
+  }
+
+  /// @brief Returns the communicator the task runs on.
+  /// @return MPI_COMM_WORLD unless SetComm() was called.
+  [[nodiscard]] MPI_Comm GetComm() const {
+    return comm_;
+  }
+
   /// @brief Returns a reference to the input data.
   /// @return Reference to the task's input data.
   InType &GetInput() {
     return input_;
   }
 
+  /// @brief Returns a read-only reference to the input data.
+  /// @return Const reference to the task's input data.
+  [[nodiscard]] const InType &GetInput() const {
+    return input_;
+  }
+
   /// @brief Returns a reference to the output data.
   /// @return Reference to the task's output data.
   OutType &GetOutput() {
@@ -207,7 +292,10 @@ class Task {
       ppc::util::DestructorFailureFlag::Set();
     }
 #if _OPENMP >= 201811
-    omp_pause_resource_all(omp_pause_soft);
+    // OpenMP threads are kept for the next task unless their release is requested
+    if (ppc::util::IsThreadReleaseEnabled()) {
+      omp_pause_resource_all(omp_pause_soft);
+    }
 #endif
   }
 
@@ -259,8 +347,11 @@ class Task {
   OutType output_{};
   StateOfTesting state_of_testing_ = StateOfTesting::kFunc;
   TypeOfTask type_of_task_ = TypeOfTask::kUnknown;
+  MPI_Comm comm_ = MPI_COMM_WORLD;
   StatusOfTask status_of_task_ = StatusOfTask::kEnabled;
   std::chrono::high_resolution_clock::time_point tmp_time_point_;
+  StageTimings stage_timings_{};
+  StageAllocations stage_allocations_{};
   enum class PipelineStage : uint8_t {
     kNone,
     kValidation,
@@ -269,6 +360,19 @@ class Task {
     kDone,
     kException
   } stage_ = PipelineStage::kNone;
+
+  /// @brief Stores the time elapsed and the allocations made since @p begin and @p allocations_begin as those
+  /// of @p stage.
+  void RecordStage(TimedStage stage, std::chrono::high_resolution_clock::time_point begin,
+                   const ppc::util::AllocationStats &allocations_begin) {
+    const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::high_resolution_clock::now() - begin)
+                              .count();
+    const auto allocations_end = ppc::util::CurrentAllocations();
+    stage_timings_[static_cast<std::size_t>(stage)] = static_cast<double>(duration) * 1e-9;
+    stage_allocations_[static_cast<std::size_t>(stage)] = {.count = allocations_end.count - allocations_begin.count,
+                                                           .bytes = allocations_end.bytes - allocations_begin.bytes};
+  }
 };
 
 /// @brief Smart pointer alias for Task.
@@ -278,13 +382,16 @@ template <typename InType, typename OutType>
 using TaskPtr = std::shared_ptr<Task<InType, OutType>>;
 
 /// @brief Constructs and returns a shared pointer to a task with the given input.
+/// @details The input is moved into the task constructor, so a task that takes `InType` by value and moves it into
+/// GetInput() receives large inputs without a copy. Inputs meant to be shared between several tasks can be declared
+/// as `std::shared_ptr<const T>`.
 /// @tparam TaskType Type of the task to create.
 /// @tparam InType Type of the input.
 /// @param in Input to pass to the task constructor.
 /// @return Shared a pointer to the newly created task.
 template <typename TaskType, typename InType>
-std::shared_ptr<TaskType> TaskGetter(const InType &in) {
-  return std::make_shared<TaskType>(in);
+std::shared_ptr<TaskType> TaskGetter(InType in) {
+  return std::make_shared<TaskType>(std::move(in));
 }
 
 }  // namespace ppc::task
@@ -0,0 +1,83 @@
+#include "task/include/batch.hpp"
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <vector>
+
+namespace ppc::task::detail {
+
+namespace {
+
+constexpr int kWorkTag = 1;
+constexpr int kReplyTag = 2;
+// Sent instead of an index when there is no work left, and by a worker that has no result yet
+constexpr int64_t kNoIndex = -1;
+// Status word of a reply, after the index
+constexpr int64_t kTaskDone = 0;
+constexpr int64_t kTaskFailed = 1;
+constexpr std::size_t kHeaderBytes = 2 * sizeof(int64_t);
+
+}  // namespace
+
+bool FarmManager(std::size_t count, std::size_t payload_bytes, MPI_Comm comm,
+                 const std::function<void(std::size_t, const std::byte *)> &store) {
+  int size = 1;
+  MPI_Comm_size(comm, &size);
+  std::vector<std::byte> reply(kHeaderBytes + payload_bytes);
+  std::size_t next = 0;
+  bool failed = false;
+  int active_workers = size - 1;
+  while (active_workers > 0) {
+    MPI_Status status;
+    MPI_Recv(reply.data(), static_cast<int>(reply.size()), MPI_BYTE, MPI_ANY_SOURCE, kReplyTag, comm, &status);
+    int64_t index = kNoIndex;
+    int64_t task_status = kTaskDone;
+    std::memcpy(&index, reply.data(), sizeof(index));
+    std::memcpy(&task_status, reply.data() + sizeof(index), sizeof(task_status));
+    if (task_status == kTaskFailed) {
+      failed = true;
+    } else if (index != kNoIndex) {
+      store(static_cast<std::size_t>(index), reply.data() + kHeaderBytes);
+    }
+    // After a failure every request is answered with the stop signal, so the workers leave the farm
+    int64_t work = kNoIndex;
+    if (!failed && next < count) {
+      work = static_cast<int64_t>(next++);
+    } else {
+      active_workers--;
+    }
+    MPI_Send(&work, 1, MPI_INT64_T, status.MPI_SOURCE, kWorkTag, comm);
+  }
+  return failed;
+}
+
+std::exception_ptr FarmWorker(std::size_t payload_bytes, MPI_Comm comm,
+                              const std::function<void(std::size_t, std::byte *)> &run) {
+  std::vector<std::byte> reply(kHeaderBytes + payload_bytes);
+  std::exception_ptr error;
+  int64_t index = kNoIndex;
+  while (true) {
+    // The reply to the previous index doubles as the request for the next one
+    const int64_t task_status = error ? kTaskFailed : kTaskDone;
+    std::memcpy(reply.data(), &index, sizeof(index));
+    std::memcpy(reply.data() + sizeof(index), &task_status, sizeof(task_status));
+    MPI_Send(reply.data(), static_cast<int>(reply.size()), MPI_BYTE, 0, kReplyTag, comm);
+    MPI_Recv(&index, 1, MPI_INT64_T, 0, kWorkTag, comm, MPI_STATUS_IGNORE);
+    if (index == kNoIndex) {
+      break;
+    }
+    try {
+      run(static_cast<std::size_t>(index), reply.data() + kHeaderBytes);
+    } catch (...) {
+      error = std::current_exception();
+    }
+  }
+  return error;
+}
+
+}  // namespace ppc::task::detail
@@ -0,0 +1,31 @@
+#include "task/include/comm_groups.hpp"
+
+#include <mpi.h>
+
+#include <stdexcept>
+
+namespace ppc::task {
+
+CommGroups::CommGroups(int count, MPI_Comm comm) : group_count_(count) {
+  int rank = 0;
+  int size = 1;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &size);
+  if (count < 1 || count > size) {
+    throw std::runtime_error("Number of communicator groups must be between 1 and the number of processes");
+  }
+  group_index_ = GroupOf(rank, size, count);
+  if (MPI_Comm_split(comm, group_index_, rank, &group_) != MPI_SUCCESS) {
+    throw std::runtime_error("Failed to split the communicator into groups");
+  }
+  MPI_Comm_rank(group_, &group_rank_);
+  MPI_Comm_size(group_, &group_size_);
+}
+
+CommGroups::~CommGroups() {
+  if (group_ != MPI_COMM_NULL) {
+    MPI_Comm_free(&group_);
+  }
+}
+
+}  // namespace ppc::task
@@ -0,0 +1,29 @@
+#include "task/include/hybrid.hpp"
+
+#include <mpi.h>
+
+#include <stdexcept>
+
+namespace ppc::task {
+
+NodeComm::NodeComm(MPI_Comm comm) {
+  int rank = 0;
+  MPI_Comm_rank(comm, &rank);
+  if (MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &node_) != MPI_SUCCESS) {
+    throw std::runtime_error("Failed to split the communicator by shared memory");
+  }
+  MPI_Comm_rank(node_, &node_rank_);
+  MPI_Comm_size(node_, &node_size_);
+  MPI_Comm_split(comm, IsLeader() ? 0 : MPI_UNDEFINED, rank, &leaders_);
+}
+
+NodeComm::~NodeComm() {
+  if (leaders_ != MPI_COMM_NULL) {
+    MPI_Comm_free(&leaders_);
+  }
+  if (node_ != MPI_COMM_NULL) {
+    MPI_Comm_free(&node_);
+  }
+}
+
+}  // namespace ppc::task
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <mpi.h>
 
 #include <chrono>
 #include <cstddef>
@@ -16,7 +17,10 @@
 #include <vector>
 
 #include "runners/include/runners.hpp"
+#include "task/include/batch.hpp"
+#include "task/include/comm_groups.hpp"
 #include "task/include/task.hpp"
+#include "util/include/memory_usage.hpp"
 #include "util/include/util.hpp"
 
 using ppc::task::StatusOfTask;
@@ -40,8 +44,8 @@ namespace ppc::test {
 template <typename InType, typename OutType>
 class TestTask : public ppc::task::Task<InType, OutType> {
  public:
-  explicit TestTask(const InType &in) {
-    this->GetInput() = in;
+  explicit TestTask(InType in) {
+    this->GetInput() = std::move(in);
   }
 
   bool ValidationImpl() override {
@@ -76,6 +80,30 @@ class FakeSlowTask : public TestTask<InType, OutType> {
   }
 };
 
+template <typename InType, typename OutType>
+class FakeShortSleepTask : public TestTask<InType, OutType> {
+ public:
+  explicit FakeShortSleepTask(const InType &in) : TestTask<InType, OutType>(in) {}
+
+  bool RunImpl() override {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    return TestTask<InType, OutType>::RunImpl();
+  }
+};
+
+template <typename InType, typename OutType>
+class FakeAllocatingTask : public TestTask<InType, OutType> {
+ public:
+  explicit FakeAllocatingTask(const InType &in) : TestTask<InType, OutType>(in) {}
+
+  // Module tests do not link the counting operator new, so the allocations are reported by hand
+  bool RunImpl() override {
+    ppc::util::CountAllocation(256);
+    ppc::util::CountAllocation(768);
+    return TestTask<InType, OutType>::RunImpl();
+  }
+};
+
 }  // namespace ppc::test
 
 TEST(TaskTests, CheckInt32t) {
@@ -307,6 +335,116 @@ TEST(TaskTest, PostProcessingThrowsIfCalledBeforeRun) {
   EXPECT_THROW(task->PostProcessing(), std::runtime_error);
 }
 
+TEST(TaskTest, StageTimingsAreRecorded) {
+  std::vector<int32_t> in(20, 1);
+  ppc::test::FakeShortSleepTask<std::vector<int32_t>, int32_t> test_task(in);
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+
+  const auto &timings = test_task.GetStageTimings();
+  const auto run = timings[static_cast<std::size_t>(ppc::task::TimedStage::kRun)];
+  EXPECT_GE(run, 0.015);
+  EXPECT_LT(timings[static_cast<std::size_t>(ppc::task::TimedStage::kValidation)], run);
+  EXPECT_LT(timings[static_cast<std::size_t>(ppc::task::TimedStage::kPostProcessing)], run);
+}
+
+TEST(TaskTest, StageAllocationsAreRecorded) {
+  std::vector<int32_t> in(20, 1);
+  ppc::test::FakeAllocatingTask<std::vector<int32_t>, int32_t> test_task(in);
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+
+  const auto &allocations = test_task.GetStageAllocations();
+  const auto &run = allocations[static_cast<std::size_t>(ppc::task::TimedStage::kRun)];
+  EXPECT_EQ(run.count, 2U);
+  EXPECT_EQ(run.bytes, 1024U);
+  EXPECT_EQ(allocations[static_cast<std::size_t>(ppc::task::TimedStage::kValidation)].count, 0U);
+}
+
+TEST(TaskTest, TaskGetterMovesInput) {
+  std::vector<int32_t> in(1000, 1);
+  const auto *data = in.data();
+  auto task = ppc::task::TaskGetter<ppc::test::TestTask<std::vector<int32_t>, int32_t>>(std::move(in));
+  EXPECT_EQ(task->GetInput().data(), data);
+  ASSERT_TRUE(task->Validation());
+  task->PreProcessing();
+  task->Run();
+  task->PostProcessing();
+  EXPECT_EQ(task->GetOutput(), 1000);
+}
+
+TEST(TaskTest, TaskGetterCopiesLvalueInput) {
+  const std::vector<int32_t> in(10, 1);
+  auto task = ppc::task::TaskGetter<ppc::test::TestTask<std::vector<int32_t>, int32_t>>(in);
+  EXPECT_NE(task->GetInput().data(), in.data());
+  EXPECT_EQ(task->GetInput(), in);
+  task->Validation();
+  task->PreProcessing();
+  task->Run();
+  task->PostProcessing();
+}
+
+TEST(TaskTest, CommGroupsSplitRanksIntoContiguousBlocks) {
+  const std::vector<int> expected = {0, 0, 1, 1, 1};
+  for (int rank = 0; rank < 5; rank++) {
+    EXPECT_EQ(ppc::task::CommGroups::GroupOf(rank, 5, 2), expected[rank]);
+  }
+  for (int rank = 0; rank < 4; rank++) {
+    EXPECT_EQ(ppc::task::CommGroups::GroupOf(rank, 4, 4), rank);
+    EXPECT_EQ(ppc::task::CommGroups::GroupOf(rank, 4, 1), 0);
+  }
+}
+
+TEST(TaskTest, SetCommThrowsWhilePipelineRuns) {
+  std::vector<int32_t> in(20, 1);
+  ppc::test::TestTask<std::vector<int32_t>, int32_t> test_task(in);
+  EXPECT_EQ(test_task.GetComm(), MPI_COMM_WORLD);
+  test_task.SetComm(MPI_COMM_SELF);
+  EXPECT_EQ(test_task.GetComm(), MPI_COMM_SELF);
+  test_task.Validation();
+  EXPECT_THROW(test_task.SetComm(MPI_COMM_WORLD), std::runtime_error);
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+}
+
+TEST(TaskTest, BatchExecutorRunsEveryTaskOnThreads) {
+  std::vector<std::vector<int32_t>> inputs;
+  for (int32_t i = 1; i <= 50; i++) {
+    inputs.emplace_back(i, 1);
+  }
+  ppc::task::BatchExecutor<std::vector<int32_t>, int32_t> executor(
+      ppc::task::TaskGetter<ppc::test::TestTask<std::vector<int32_t>, int32_t>, std::vector<int32_t>>, inputs);
+
+  const auto outputs = executor.Run(ppc::task::BatchMode::kThreads, 3);
+  ASSERT_EQ(outputs.size(), inputs.size());
+  for (std::size_t i = 0; i < outputs.size(); i++) {
+    EXPECT_EQ(outputs[i], static_cast<int32_t>(i + 1));
+  }
+  const auto &stats = executor.GetStats();
+  EXPECT_EQ(stats.num_tasks, inputs.size());
+  EXPECT_EQ(stats.latencies.size(), inputs.size());
+  EXPECT_GT(stats.total_sec, 0.0);
+}
+
+TEST(TaskTest, BatchExecutorThrowsIfATaskFails) {
+  // An empty input fails validation of TestTask
+  std::vector<std::vector<int32_t>> inputs = {{1}, {}, {1, 1}};
+  ppc::task::BatchExecutor<std::vector<int32_t>, int32_t> executor(
+      ppc::task::TaskGetter<ppc::test::TestTask<std::vector<int32_t>, int32_t>, std::vector<int32_t>>, inputs);
+  EXPECT_THROW(executor.Run(ppc::task::BatchMode::kThreads, 2), std::runtime_error);
+  ppc::util::DestructorFailureFlag::Unset();
+}
+
+TEST(TaskTest, GetStringTimedStage) {
+  EXPECT_EQ(ppc::task::GetStringTimedStage(ppc::task::TimedStage::kValidation), "validation");
+  EXPECT_EQ(ppc::task::GetStringTimedStage(ppc::task::TimedStage::kPostProcessing), "post_processing");
+}
+
 int main(int argc, char **argv) {
   return ppc::runners::SimpleInit(argc, argv);
 }
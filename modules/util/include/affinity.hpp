@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ppc::util {
+
+/// @brief How the ranks of a node and their threads are placed on its CPUs.
+enum class PinPolicy : std::uint8_t {
+  /// Leave the placement to the MPI launcher and the OS.
+  kNone,
+  /// Ranks get neighbouring cores, threads of a rank fill a core's hardware threads before the next core.
+  kCompact,
+  /// Ranks are dealt round-robin over the NUMA nodes, threads of a rank take distinct cores first.
+  kScatter,
+};
+
+/// @brief Parses a PPC_PIN value: empty or "none", "compact", "scatter".
+/// @throws std::runtime_error For any other value.
+PinPolicy ParsePinPolicy(std::string_view name);
+
+/// @brief Location of one logical CPU.
+struct CpuInfo {
+  int cpu = 0;
+  int core = 0;
+  int package = 0;
+  int node = 0;
+};
+
+/// @brief Parses a kernel CPU list such as "0-3,8,10-11".
+/// @throws std::runtime_error If the list is malformed.
+std::vector<int> ParseCpuList(std::string_view list);
+
+/// @brief Online CPUs described by @p sysfs_root (cpu/cpuN/topology and node/nodeN/cpulist), ordered by CPU number.
+/// @details Missing topology files give every CPU its own core, package 0 and NUMA node 0. Returns an empty list
+/// where sysfs is not available.
+std::vector<CpuInfo> ReadCpuTopology(const std::filesystem::path &sysfs_root = "/sys/devices/system");
+
+/// @brief CPUs for rank @p local_rank of the @p local_size ranks sharing the node, in the order its threads should
+/// take them.
+/// @details The CPUs are split evenly; with more ranks than CPUs the ranks share them. Returns an empty list for
+/// PinPolicy::kNone or no CPUs.
+std::vector<int> RankCpus(std::vector<CpuInfo> cpus, PinPolicy policy, int local_rank, int local_size);
+
+/// @brief CPUs the calling thread may run on, empty where this cannot be queried.
+std::vector<int> GetThreadAffinity();
+
+/// @brief Restricts the calling thread, and the threads it creates afterwards, to @p cpus.
+/// @throws std::runtime_error If the system rejects the mask or does not support affinity.
+void SetThreadAffinity(const std::vector<int> &cpus);
+
+/// @brief Sets the CPUs that PinThreadToSlot() hands out in this process; an empty list disables slot pinning.
+void SetThreadPlacement(std::vector<int> cpus);
+
+/// @brief Pins the calling worker thread to CPU @p slot of the placement set by SetThreadPlacement() (modulo its
+/// size). Does nothing without a placement or if the system rejects the mask.
+void PinThreadToSlot(int slot);
+
+}  // namespace ppc::util
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace ppc::util {
+
+/// @brief Counts positions i < min(a.size(), b.size()) where a[i] != b[i].
+/// @details Compares whole vector blocks at once (64 bytes with AVX-512BW, 32 with AVX2, 16 with SSE2):
+/// the equality mask of each block is turned into a bit mask and the set bits are counted.
+/// The length difference of the two views is not included.
+std::size_t CountMismatches(std::string_view a, std::string_view b);
+
+/// @brief Returns the first index i < min(a.size(), b.size()) where a[i] != b[i].
+/// @details Uses the same block comparison as CountMismatches and locates the mismatch inside a block
+/// with a trailing zero count.
+/// @return min(a.size(), b.size()) if the common prefix has no mismatches.
+std::size_t FindFirstMismatch(std::string_view a, std::string_view b);
+
+}  // namespace ppc::util
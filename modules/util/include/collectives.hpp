@@ -0,0 +1,248 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "util/include/partition.hpp"
+
+namespace ppc::util {
+
+namespace detail {
+
+/// @brief Predefined MPI datatype of T, or MPI_DATATYPE_NULL if there is none.
+template <typename T>
+MPI_Datatype PredefinedDatatype() {
+  using U = std::remove_cv_t<T>;
+  if constexpr (std::is_same_v<U, char>) {
+    return MPI_CHAR;
+  } else if constexpr (std::is_same_v<U, signed char>) {
+    return MPI_SIGNED_CHAR;
+  } else if constexpr (std::is_same_v<U, unsigned char>) {
+    return MPI_UNSIGNED_CHAR;
+  } else if constexpr (std::is_same_v<U, short>) {
+    return MPI_SHORT;
+  } else if constexpr (std::is_same_v<U, unsigned short>) {
+    return MPI_UNSIGNED_SHORT;
+  } else if constexpr (std::is_same_v<U, int>) {
+    return MPI_INT;
+  } else if constexpr (std::is_same_v<U, unsigned>) {
+    return MPI_UNSIGNED;
+  } else if constexpr (std::is_same_v<U, long>) {
+    return MPI_LONG;
+  } else if constexpr (std::is_same_v<U, unsigned long>) {
+    return MPI_UNSIGNED_LONG;
+  } else if constexpr (std::is_same_v<U, long long>) {
+    return MPI_LONG_LONG;
+  } else if constexpr (std::is_same_v<U, unsigned long long>) {
+    return MPI_UNSIGNED_LONG_LONG;
+  } else if constexpr (std::is_same_v<U, float>) {
+    return MPI_FLOAT;
+  } else if constexpr (std::is_same_v<U, double>) {
+    return MPI_DOUBLE;
+  } else if constexpr (std::is_same_v<U, long double>) {
+    return MPI_LONG_DOUBLE;
+  } else {
+    return MPI_DATATYPE_NULL;
+  }
+}
+
+}  // namespace detail
+
+/// @brief MPI datatype for a unit of @p unit_size consecutive values of T, valid for the life of the object or until
+/// MPI_Finalize.
+/// @details Arithmetic types map to the predefined MPI types, other trivially copyable types (structs, std::array,
+/// std::complex) to a contiguous run of sizeof(T) bytes. A unit larger than one value is a committed
+/// contiguous type, so the counts of a collective can be given in rows or blocks and stay within int range when the
+/// number of values does not.
+template <typename T>
+class MpiDatatype {
+  static_assert(std::is_trivially_copyable_v<T>, "MPI collectives need a trivially copyable type");
+
+ public:
+  explicit MpiDatatype(std::int64_t unit_size = 1) {
+    if (unit_size <= 0 || unit_size > std::numeric_limits<int>::max()) {
+      throw std::runtime_error("MPI datatype unit must hold between 1 and INT_MAX values");
+    }
+    MPI_Datatype value_type = detail::PredefinedDatatype<T>();
+    MPI_Datatype bytes_type = MPI_DATATYPE_NULL;
+    if (value_type == MPI_DATATYPE_NULL) {
+      MPI_Type_contiguous(static_cast<int>(sizeof(T)), MPI_BYTE, &bytes_type);
+      value_type = bytes_type;
+    }
+    if (unit_size == 1 && bytes_type == MPI_DATATYPE_NULL) {
+      type_ = value_type;
+      return;
+    }
+    if (unit_size == 1) {
+      type_ = bytes_type;
+    } else {
+      MPI_Type_contiguous(static_cast<int>(unit_size), value_type, &type_);
+      if (bytes_type != MPI_DATATYPE_NULL) {
+        MPI_Type_free(&bytes_type);
+      }
+    }
+    MPI_Type_commit(&type_);
+    owned_ = true;
+  }
+  ~MpiDatatype() {
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+    if (owned_ && finalized == 0) {
+      MPI_Type_free(&type_);
+    }
+  }
+
+  MpiDatatype(const MpiDatatype &) = delete;
+  MpiDatatype &operator=(const MpiDatatype &) = delete;
+  MpiDatatype(MpiDatatype &&) = delete;
+  MpiDatatype &operator=(MpiDatatype &&) = delete;
+
+  [[nodiscard]] MPI_Datatype Get() const {
+    return type_;
+  }
+
+ private:
+  MPI_Datatype type_ = MPI_DATATYPE_NULL;
+  bool owned_ = false;
+};
+
+namespace detail {
+
+inline void CheckPartsMatchComm(const std::vector<Range> &parts, MPI_Comm comm) {
+  int size = 1;
+  MPI_Comm_size(comm, &size);
+  if (parts.size() != static_cast<std::size_t>(size)) {
+    throw std::runtime_error("Partition must have one part per rank of the communicator");
+  }
+}
+
+// Values the whole data holds, in units: the parts may come in any order and need not reach its end
+inline std::int64_t PartitionEnd(const std::vector<Range> &parts) {
+  std::int64_t end = 0;
+  for (const auto &part : parts) {
+    end = std::max(end, part.End());
+  }
+  return end;
+}
+
+inline int CommRank(MPI_Comm comm) {
+  int rank = 0;
+  MPI_Comm_rank(comm, &rank);
+  return rank;
+}
+
+// Where the values of each rank lie when the block-cyclic data is packed rank by rank
+inline std::vector<Range> BlockCyclicPacking(std::int64_t n, std::int64_t block, int size) {
+  std::vector<Range> packed(static_cast<std::size_t>(size));
+  std::int64_t begin = 0;
+  for (int part = 0; part < size; part++) {
+    packed[static_cast<std::size_t>(part)] = {.begin = begin, .count = BlockCyclicCount(n, block, size, part)};
+    begin += packed[static_cast<std::size_t>(part)].count;
+  }
+  return packed;
+}
+
+}  // namespace detail
+
+/// @brief Sends part r of @p data on @p root to rank r of @p comm. Collective.
+/// @param data Whole data; read on @p root only.
+/// @param parts Range of each rank in units of @p unit_size values, e.g. BlockPartition(rows, size) with
+/// unit_size = cols to hand out whole matrix rows. The ranges must not overlap but need not cover the data.
+/// @return The values of the calling rank.
+/// @throws std::runtime_error If @p parts does not have one part per rank or the counts do not fit in int.
+template <typename T>
+std::vector<T> ScatterPartition(const std::vector<T> &data, const std::vector<Range> &parts, int root, MPI_Comm comm,
+                                std::int64_t unit_size = 1) {
+  detail::CheckPartsMatchComm(parts, comm);
+  const MpiDatatype<T> unit(unit_size);
+  const auto counts = ToMpiCounts(parts);
+  const auto rank = static_cast<std::size_t>(detail::CommRank(comm));
+  std::vector<T> local(static_cast<std::size_t>(parts[rank].count * unit_size));
+  MPI_Scatterv(data.data(), counts.counts.data(), counts.displs.data(), unit.Get(), local.data(), counts.counts[rank],
+               unit.Get(), root, comm);
+  return local;
+}
+
+/// @brief Collects the values of every rank of @p comm into their place of the whole data on @p root. Collective.
+/// @return The whole data on @p root, an empty vector on the other ranks.
+template <typename T>
+std::vector<T> GatherPartition(const std::vector<T> &local, const std::vector<Range> &parts, int root, MPI_Comm comm,
+                               std::int64_t unit_size = 1) {
+  detail::CheckPartsMatchComm(parts, comm);
+  const MpiDatatype<T> unit(unit_size);
+  const auto counts = ToMpiCounts(parts);
+  const int rank = detail::CommRank(comm);
+  std::vector<T> data(rank == root ? static_cast<std::size_t>(detail::PartitionEnd(parts) * unit_size) : 0);
+  MPI_Gatherv(local.data(), counts.counts[static_cast<std::size_t>(rank)], unit.Get(), data.data(),
+              counts.counts.data(), counts.displs.data(), unit.Get(), root, comm);
+  return data;
+}
+
+/// @brief Like GatherPartition(), but every rank gets the whole data. Collective.
+template <typename T>
+std::vector<T> AllgatherPartition(const std::vector<T> &local, const std::vector<Range> &parts, MPI_Comm comm,
+                                  std::int64_t unit_size = 1) {
+  detail::CheckPartsMatchComm(parts, comm);
+  const MpiDatatype<T> unit(unit_size);
+  const auto counts = ToMpiCounts(parts);
+  const auto rank = static_cast<std::size_t>(detail::CommRank(comm));
+  std::vector<T> data(static_cast<std::size_t>(detail::PartitionEnd(parts) * unit_size));
+  MPI_Allgatherv(local.data(), counts.counts[rank], unit.Get(), data.data(), counts.counts.data(),
+                 counts.displs.data(), unit.Get(), comm);
+  return data;
+}
+
+/// @brief Deals the @p n values of @p data on @p root to the ranks of @p comm in blocks of @p block values, the
+/// block-cyclic distribution (block = 1 is the cyclic one). Collective.
+/// @return The values of the calling rank in increasing global order, see BlockCyclicRanges().
+template <typename T>
+std::vector<T> ScatterBlockCyclic(const std::vector<T> &data, std::int64_t n, std::int64_t block, int root,
+                                  MPI_Comm comm) {
+  int size = 1;
+  MPI_Comm_size(comm, &size);
+  const int rank = detail::CommRank(comm);
+  // The root packs the values of each rank together, so a single Scatterv moves them
+  const auto packed = detail::BlockCyclicPacking(n, block, size);
+  std::vector<T> send;
+  if (rank == root) {
+    send.reserve(static_cast<std::size_t>(n));
+    for (int part = 0; part < size; part++) {
+      for (const auto &range : BlockCyclicRanges(n, block, size, part)) {
+        send.insert(send.end(), data.begin() + range.begin, data.begin() + range.End());
+      }
+    }
+  }
+  return ScatterPartition(send, packed, root, comm);
+}
+
+/// @brief Inverse of ScatterBlockCyclic(): puts the values of every rank back into their global order on @p root.
+/// @return The whole data on @p root, an empty vector on the other ranks.
+template <typename T>
+std::vector<T> GatherBlockCyclic(const std::vector<T> &local, std::int64_t n, std::int64_t block, int root,
+                                 MPI_Comm comm) {
+  int size = 1;
+  MPI_Comm_size(comm, &size);
+  const auto packed = detail::BlockCyclicPacking(n, block, size);
+  auto received = GatherPartition(local, packed, root, comm);
+  if (detail::CommRank(comm) != root) {
+    return {};
+  }
+  std::vector<T> data(static_cast<std::size_t>(n));
+  for (int part = 0; part < size; part++) {
+    auto source = received.begin() + packed[static_cast<std::size_t>(part)].begin;
+    for (const auto &range : BlockCyclicRanges(n, block, size, part)) {
+      std::copy(source, source + range.count, data.begin() + range.begin);
+      source += range.count;
+    }
+  }
+  return data;
+}
+
+}  // namespace ppc::util
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "util/include/mapped_file.hpp"
+
+namespace ppc::util {
+
+/// @brief Identifies a generated input: the same key always maps to the same cached file.
+/// @details Change the seed (or add a version to @p task) when the generator changes, or clear the cache
+/// directory; the cache does not see the generator itself.
+struct DatasetKey {
+  /// @brief Name of the dataset, usually the task namespace plus what the data is, e.g. "sabirov_s_mins".
+  std::string task;
+  /// @brief Number of elements.
+  std::uint64_t size = 0;
+  std::uint64_t seed = 0;
+};
+
+/// @brief Size of the file header in front of the elements; keeps the mapped elements 64-byte aligned.
+inline constexpr std::size_t kDatasetHeaderSize = 64;
+
+/// @brief Number of threads GenerateDatasetChunks() starts: the CPUs the calling process may run on, but no more
+/// than its share of the node when the launcher starts several ranks on it, so that ranks generating at the same
+/// time do not oversubscribe the cores.
+std::size_t GetDatasetGeneratorThreads();
+
+/// @brief Path of the cache file of @p key under GetDatasetCacheDir().
+std::string GetDatasetPath(const DatasetKey &key, std::size_t element_size);
+
+/// @brief Whether @p path holds a complete dataset of @p key with elements of @p element_size bytes.
+bool IsDatasetValid(const std::string &path, const DatasetKey &key, std::size_t element_size);
+
+/// @brief Writes the header and @p bytes bytes of @p data to @p path.
+/// @details The file is written under a temporary name and renamed, so processes that generate the same dataset
+/// at the same time (all ranks of an MPI run) never see a partial file.
+/// @throws std::runtime_error If the file cannot be written.
+void WriteDataset(const std::string &path, const DatasetKey &key, std::size_t element_size, const void *data,
+                  std::size_t bytes);
+
+/// @brief Seed for the random engine of the chunk starting at @p first_index (splitmix64 of both values).
+/// @details Lets a generator based on std::mt19937 produce the same data no matter how many threads run it.
+inline std::uint64_t DatasetChunkSeed(std::uint64_t seed, std::uint64_t first_index) {
+  std::uint64_t z = seed + ((first_index + 1) * 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27U)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31U);
+}
+
+/// @brief Read-only dataset mapped from the cache.
+template <typename T>
+class Dataset {
+ public:
+  Dataset(const std::string &path, std::size_t count)
+      : range_(std::make_unique<MappedFileRange>(path, kDatasetHeaderSize, count * sizeof(T))), count_(count) {}
+
+  [[nodiscard]] std::span<const T> View() const {
+    return {reinterpret_cast<const T *>(range_->View().data()), count_};
+  }
+  /// @brief Copies the elements, for tests whose input type owns its data.
+  [[nodiscard]] std::vector<T> ToVector() const {
+    const auto view = View();
+    return {view.begin(), view.end()};
+  }
+
+ private:
+  std::unique_ptr<MappedFileRange> range_;
+  std::size_t count_;
+};
+
+/// @brief Fills @p data chunk by chunk on GetDatasetGeneratorThreads() threads.
+/// @param generate Called as generate(std::span<T> chunk, std::size_t first_index) for consecutive chunks of
+/// @p chunk_size elements (the last one may be shorter). Chunks run concurrently, so the generator must not
+/// throw and may only depend on the indices and the seed, e.g. through DatasetChunkSeed().
+template <typename T, typename Generator>
+void GenerateDatasetChunks(std::span<T> data, std::size_t chunk_size, Generator &generate) {
+  chunk_size = std::max<std::size_t>(chunk_size, 1);
+  const std::size_t num_chunks = (data.size() + chunk_size - 1) / chunk_size;
+  std::atomic<std::size_t> next_chunk{0};
+  auto worker = [&] {
+    for (std::size_t chunk = next_chunk++; chunk < num_chunks; chunk = next_chunk++) {
+      const std::size_t first = chunk * chunk_size;
+      generate(data.subspan(first, std::min(chunk_size, data.size() - first)), first);
+    }
+  };
+  const auto num_threads = std::min(GetDatasetGeneratorThreads(), std::max<std::size_t>(num_chunks, 1));
+  std::vector<std::jthread> threads;
+  threads.reserve(num_threads - 1);
+  for (std::size_t i = 1; i < num_threads; i++) {
+    threads.emplace_back(worker);
+  }
+  worker();
+}
+
+/// @brief Returns the dataset of @p key, generating it into the cache on the first request.
+/// @details Later requests, also from later test runs, map the cached file instead of generating the data again.
+/// @param generate See GenerateDatasetChunks().
+/// @throws std::runtime_error If the cache file cannot be written or mapped.
+template <typename T, typename Generator>
+Dataset<T> LoadOrGenerateDataset(const DatasetKey &key, Generator &&generate, std::size_t chunk_size = 1 << 16) {
+  static_assert(std::is_trivially_copyable_v<T>, "Cached datasets are stored as raw bytes");
+  const auto path = GetDatasetPath(key, sizeof(T));
+  if (!IsDatasetValid(path, key, sizeof(T))) {
+    std::vector<T> data(static_cast<std::size_t>(key.size));
+    GenerateDatasetChunks(std::span<T>(data), chunk_size, generate);
+    WriteDataset(path, key, sizeof(T), data.data(), data.size() * sizeof(T));
+  }
+  return Dataset<T>(path, static_cast<std::size_t>(key.size));
+}
+
+}  // namespace ppc::util
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "util/include/util.hpp"
+
+namespace ppc::util {
+
+/// @brief Allocator whose memory is not touched when it is allocated.
+/// @details The OS places a page on the NUMA node of the thread that first writes it. std::allocator zeroes a
+/// std::vector on the allocating thread, so the whole buffer ends up on that thread's node; with this allocator
+/// elements constructed without arguments are default-initialized (left as is for trivial types), and
+/// MakeFirstTouchVector() lets the threads that will use each part write it first. Buffers are page aligned, so
+/// the pages of different threads do not share a boundary page in the middle of a chunk.
+template <typename T>
+class FirstTouchAllocator {
+ public:
+  using value_type = T;
+
+  static constexpr std::size_t kPageSize = 4096;
+
+  FirstTouchAllocator() noexcept = default;
+  template <typename U>
+  explicit FirstTouchAllocator(const FirstTouchAllocator<U> & /*other*/) noexcept {}
+
+  [[nodiscard]] T *allocate(std::size_t n) {
+    return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t{kPageSize}));
+  }
+  void deallocate(T *p, std::size_t /*n*/) noexcept {
+    ::operator delete(p, std::align_val_t{kPageSize});
+  }
+
+  template <typename U, typename... Args>
+  void construct(U *p, Args &&...args) {
+    if constexpr (sizeof...(Args) == 0) {
+      ::new (static_cast<void *>(p)) U;
+    } else {
+      ::new (static_cast<void *>(p)) U(std::forward<Args>(args)...);
+    }
+  }
+
+  template <typename U>
+  bool operator==(const FirstTouchAllocator<U> & /*other*/) const noexcept {
+    return true;
+  }
+};
+
+template <typename T>
+using FirstTouchVector = std::vector<T, FirstTouchAllocator<T>>;
+
+/// @brief Vector of @p n copies of @p value, written by the OpenMP threads in the same contiguous chunks as a
+/// `schedule(static)` loop over its units of @p unit_size elements, e.g. the matrix rows.
+/// @details A kernel that processes the units with that schedule and the same number of threads then reads and
+/// writes memory on the NUMA node of each thread.
+template <typename T>
+FirstTouchVector<T> MakeFirstTouchVector(std::size_t n, const T &value = T{}, std::size_t unit_size = 1,
+                                         int num_threads = GetNumThreads()) {
+  static_assert(std::is_trivially_copyable_v<T>, "First touch is meant for plain numeric buffers");
+  FirstTouchVector<T> data(n);
+  const std::size_t step = std::max<std::size_t>(unit_size, 1);
+  const std::size_t units = (n + step - 1) / step;
+  T *values = data.data();
+#pragma omp parallel for default(none) shared(values, value, n, step, units) num_threads(num_threads) \
+    schedule(static)
+  for (std::size_t unit = 0; unit < units; unit++) {
+    std::fill(values + (unit * step), values + std::min(n, (unit + 1) * step), value);
+  }
+  return data;
+}
+
+}  // namespace ppc::util
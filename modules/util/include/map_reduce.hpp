@@ -0,0 +1,236 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "util/include/collectives.hpp"
+#include "util/include/partition.hpp"
+
+namespace ppc::util {
+
+/// @brief Kernel of MapReduce(): maps every element to a Value and folds the values with Combine().
+/// @details A kernel is a stateless struct with static members, e.g. the maximum of a vector of int:
+/// @code
+/// struct MaxKernel {
+///   using Value = int;
+///   static Value Identity() { return std::numeric_limits<int>::min(); }
+///   static Value Map(int x) { return x; }
+///   static Value Combine(Value a, Value b) { return std::max(a, b); }
+/// };
+/// @endcode
+/// Combine() must be associative with Identity() as its neutral element. The values are combined in several
+/// independent lanes, so a kernel that is not commutative as well must declare
+/// `static constexpr bool kCommutative = false;` and then gets a single-lane loop and rank-ordered MPI reduction.
+template <typename Kernel, typename In>
+concept MapReduceKernel = std::is_trivially_copyable_v<typename Kernel::Value> && requires(const In &x) {
+  { Kernel::Identity() } -> std::convertible_to<typename Kernel::Value>;
+  { Kernel::Map(x) } -> std::convertible_to<typename Kernel::Value>;
+  { Kernel::Combine(Kernel::Identity(), Kernel::Identity()) } -> std::convertible_to<typename Kernel::Value>;
+};
+
+/// @brief Kernel of MapReducePairs(): like MapReduceKernel, but Map() takes two neighbouring elements.
+template <typename Kernel, typename In>
+concept PairMapReduceKernel = std::is_trivially_copyable_v<typename Kernel::Value> && requires(const In &x) {
+  { Kernel::Identity() } -> std::convertible_to<typename Kernel::Value>;
+  { Kernel::Map(x, x) } -> std::convertible_to<typename Kernel::Value>;
+  { Kernel::Combine(Kernel::Identity(), Kernel::Identity()) } -> std::convertible_to<typename Kernel::Value>;
+};
+
+/// @brief Where the input of a distributed map-reduce lives.
+enum class DataPlacement : std::uint8_t {
+  /// Every rank holds the whole input and reduces its block in place; nothing is sent.
+  kReplicated,
+  /// Only the root holds the input; the blocks are scattered first.
+  kRoot,
+};
+
+namespace detail {
+
+template <typename Kernel>
+constexpr bool IsCommutative() {
+  if constexpr (requires { Kernel::kCommutative; }) {
+    return Kernel::kCommutative;
+  } else {
+    return true;
+  }
+}
+
+// Independent accumulators per loop iteration: one cache line of values, so the lane loop maps onto vector
+// registers and the combines of consecutive elements do not wait on each other
+template <typename Kernel>
+constexpr std::size_t ReduceLanes() {
+  if constexpr (!IsCommutative<Kernel>()) {
+    return 1;
+  } else {
+    constexpr std::size_t kLineBytes = 64;
+    return sizeof(typename Kernel::Value) >= kLineBytes ? 1 : kLineBytes / sizeof(typename Kernel::Value);
+  }
+}
+
+template <typename Value, std::size_t kLanes, typename Kernel>
+Value FoldLanes(const std::array<Value, kLanes> &lanes) {
+  Value result = lanes[0];
+  for (std::size_t lane = 1; lane < kLanes; lane++) {
+    result = Kernel::Combine(result, lanes[lane]);
+  }
+  return result;
+}
+
+template <typename Kernel>
+void CombineValues(void *in, void *inout, int *len, MPI_Datatype * /*type*/) {
+  using Value = typename Kernel::Value;
+  const auto *in_values = static_cast<const Value *>(in);
+  auto *inout_values = static_cast<Value *>(inout);
+  for (int i = 0; i < *len; i++) {
+    inout_values[i] = Kernel::Combine(in_values[i], inout_values[i]);
+  }
+}
+
+/// @brief MPI_Op that applies Kernel::Combine(), valid for the life of the object or until MPI_Finalize.
+template <typename Kernel>
+class KernelOp {
+ public:
+  KernelOp() {
+    MPI_Op_create(&CombineValues<Kernel>, IsCommutative<Kernel>() ? 1 : 0, &op_);
+  }
+  ~KernelOp() {
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+    if (finalized == 0) {
+      MPI_Op_free(&op_);
+    }
+  }
+
+  KernelOp(const KernelOp &) = delete;
+  KernelOp &operator=(const KernelOp &) = delete;
+  KernelOp(KernelOp &&) = delete;
+  KernelOp &operator=(KernelOp &&) = delete;
+
+  [[nodiscard]] MPI_Op Get() const {
+    return op_;
+  }
+
+ private:
+  MPI_Op op_ = MPI_OP_NULL;
+};
+
+// The op and the datatype are created on the first reduction of a kernel and kept for the rest of the run, so
+// repeated task runs do not pay for creating and freeing them
+template <typename Kernel>
+typename Kernel::Value AllreduceValue(typename Kernel::Value local, MPI_Comm comm) {
+  static const MpiDatatype<typename Kernel::Value> kType;
+  static const KernelOp<Kernel> kOp;
+  typename Kernel::Value global = Kernel::Identity();
+  MPI_Allreduce(&local, &global, 1, kType.Get(), kOp.Get(), comm);
+  return global;
+}
+
+}  // namespace detail
+
+/// @brief Combine() of Map() over the @p n elements at @p data, Identity() for n = 0.
+template <typename Kernel, typename In>
+  requires MapReduceKernel<Kernel, In>
+typename Kernel::Value MapReduceLocal(const In *data, std::size_t n) {
+  using Value = typename Kernel::Value;
+  constexpr std::size_t kLanes = detail::ReduceLanes<Kernel>();
+  std::array<Value, kLanes> lanes;
+  lanes.fill(Kernel::Identity());
+  std::size_t i = 0;
+  for (; i + kLanes <= n; i += kLanes) {
+    for (std::size_t lane = 0; lane < kLanes; lane++) {
+      lanes[lane] = Kernel::Combine(lanes[lane], Kernel::Map(data[i + lane]));
+    }
+  }
+  for (; i < n; i++) {
+    lanes[0] = Kernel::Combine(lanes[0], Kernel::Map(data[i]));
+  }
+  return detail::FoldLanes<Value, kLanes, Kernel>(lanes);
+}
+
+/// @brief Combine() of Map(data[i], data[i + 1]) over the n - 1 neighbouring pairs, Identity() for n < 2.
+template <typename Kernel, typename In>
+  requires PairMapReduceKernel<Kernel, In>
+typename Kernel::Value MapReducePairsLocal(const In *data, std::size_t n) {
+  using Value = typename Kernel::Value;
+  constexpr std::size_t kLanes = detail::ReduceLanes<Kernel>();
+  std::array<Value, kLanes> lanes;
+  lanes.fill(Kernel::Identity());
+  const std::size_t pairs = n < 2 ? 0 : n - 1;
+  std::size_t i = 0;
+  for (; i + kLanes <= pairs; i += kLanes) {
+    for (std::size_t lane = 0; lane < kLanes; lane++) {
+      lanes[lane] = Kernel::Combine(lanes[lane], Kernel::Map(data[i + lane], data[i + lane + 1]));
+    }
+  }
+  for (; i < pairs; i++) {
+    lanes[0] = Kernel::Combine(lanes[0], Kernel::Map(data[i], data[i + 1]));
+  }
+  return detail::FoldLanes<Value, kLanes, Kernel>(lanes);
+}
+
+/// @brief Distributed MapReduceLocal(): every rank of @p comm reduces a block of @p data and the partial values
+/// are combined with an MPI_Allreduce over Kernel::Combine(). Collective.
+/// @param data Whole input, on every rank for DataPlacement::kReplicated, on @p root only for DataPlacement::kRoot.
+/// @return The value of the whole input on every rank.
+template <typename Kernel, typename In>
+  requires MapReduceKernel<Kernel, In>
+typename Kernel::Value MapReduce(const std::vector<In> &data, MPI_Comm comm,
+                                 DataPlacement placement = DataPlacement::kReplicated, int root = 0) {
+  int size = 1;
+  MPI_Comm_size(comm, &size);
+  const int rank = detail::CommRank(comm);
+  typename Kernel::Value local = Kernel::Identity();
+  if (placement == DataPlacement::kReplicated) {
+    const auto block = BlockRange(static_cast<std::int64_t>(data.size()), size, rank);
+    local = MapReduceLocal<Kernel>(data.data() + block.begin, static_cast<std::size_t>(block.count));
+  } else {
+    auto n = static_cast<std::int64_t>(data.size());
+    MPI_Bcast(&n, 1, MPI_INT64_T, root, comm);
+    const auto block = ScatterPartition(data, BlockPartition(n, size), root, comm);
+    local = MapReduceLocal<Kernel>(block.data(), block.size());
+  }
+  return detail::AllreduceValue<Kernel>(local, comm);
+}
+
+/// @brief Distributed MapReducePairsLocal(). Collective.
+/// @details The n - 1 pairs are split into blocks, so the pair that crosses a block boundary is counted once: a
+/// rank reduces the pairs of its block and, for DataPlacement::kRoot, receives the element after its block with a
+/// second Scatterv alongside the block itself.
+/// @return The value of the whole input on every rank.
+template <typename Kernel, typename In>
+  requires PairMapReduceKernel<Kernel, In>
+typename Kernel::Value MapReducePairs(const std::vector<In> &data, MPI_Comm comm,
+                                      DataPlacement placement = DataPlacement::kReplicated, int root = 0) {
+  int size = 1;
+  MPI_Comm_size(comm, &size);
+  const int rank = detail::CommRank(comm);
+  typename Kernel::Value local = Kernel::Identity();
+  if (placement == DataPlacement::kReplicated) {
+    const auto n = static_cast<std::int64_t>(data.size());
+    const auto block = BlockRange(n < 2 ? 0 : n - 1, size, rank);
+    if (block.count > 0) {
+      local = MapReducePairsLocal<Kernel>(data.data() + block.begin, static_cast<std::size_t>(block.count + 1));
+    }
+  } else {
+    auto n = static_cast<std::int64_t>(data.size());
+    MPI_Bcast(&n, 1, MPI_INT64_T, root, comm);
+    const auto parts = BlockPartition(n < 2 ? 0 : n - 1, size);
+    std::vector<Range> next(parts.size());
+    for (std::size_t part = 0; part < parts.size(); part++) {
+      next[part] = {.begin = parts[part].End(), .count = parts[part].count > 0 ? 1 : 0};
+    }
+    auto block = ScatterPartition(data, parts, root, comm);
+    const auto boundary = ScatterPartition(data, next, root, comm);
+    block.insert(block.end(), boundary.begin(), boundary.end());
+    local = MapReducePairsLocal<Kernel>(block.data(), block.size());
+  }
+  return detail::AllreduceValue<Kernel>(local, comm);
+}
+
+}  // namespace ppc::util
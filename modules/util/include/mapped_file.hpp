@@ -0,0 +1,88 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace ppc::util {
+
+/// @brief File opened for reading with MappedFileRange; its size is taken once, when it is opened.
+class MappedFile {
+ public:
+  /// @throws std::runtime_error If the file cannot be opened.
+  explicit MappedFile(std::string path);
+  ~MappedFile();
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+  MappedFile(MappedFile &&) = delete;
+  MappedFile &operator=(MappedFile &&) = delete;
+
+  [[nodiscard]] const std::string &Path() const {
+    return path_;
+  }
+  [[nodiscard]] std::uint64_t Size() const {
+    return size_;
+  }
+  /// @brief Descriptor of the open file on POSIX systems, -1 elsewhere.
+  [[nodiscard]] int Descriptor() const {
+    return fd_;
+  }
+
+ private:
+  std::string path_;
+  std::uint64_t size_ = 0;
+  int fd_ = -1;
+};
+
+/// @brief Read-only view of a byte range of a file.
+/// @details On POSIX systems the range is mapped with mmap, so only the touched pages become resident.
+/// On other platforms the range is read into an owned buffer.
+class MappedFileRange {
+ public:
+  /// @brief Maps bytes [offset, offset + length) of the file.
+  /// @throws std::runtime_error If the file cannot be opened or the range lies outside of it.
+  MappedFileRange(const std::string &path, std::uint64_t offset, std::uint64_t length);
+  /// @brief Maps bytes [offset, offset + length) of an open file; the range stays valid after @p file is closed.
+  /// @throws std::runtime_error If the range lies outside of the file.
+  MappedFileRange(const MappedFile &file, std::uint64_t offset, std::uint64_t length);
+  ~MappedFileRange();
+
+  MappedFileRange(const MappedFileRange &) = delete;
+  MappedFileRange &operator=(const MappedFileRange &) = delete;
+  MappedFileRange(MappedFileRange &&) = delete;
+  MappedFileRange &operator=(MappedFileRange &&) = delete;
+
+  /// @brief Returns the mapped bytes.
+  [[nodiscard]] std::string_view View() const {
+    return view_;
+  }
+
+ private:
+  void *mapping_ = nullptr;
+  std::size_t mapping_size_ = 0;
+  std::string buffer_;
+  std::string_view view_;
+};
+
+/// @brief Returns the size of a file in bytes.
+/// @throws std::runtime_error If the file does not exist.
+std::uint64_t GetFileSize(const std::string &path);
+
+/// @brief Visits bytes [begin, end) of a file as consecutive mapped windows of at most @p window bytes.
+/// @details The file is opened once; each window is unmapped before the next one is mapped, so memory use does not
+/// depend on the range size.
+/// @param visit Callable invoked with a std::string_view for every window, in file order.
+template <typename Visitor>
+void ForEachFileWindow(const std::string &path, std::uint64_t begin, std::uint64_t end, std::uint64_t window,
+                       Visitor &&visit) {
+  const MappedFile file(path);
+  for (std::uint64_t pos = begin; pos < end; pos += window) {
+    const MappedFileRange range(file, pos, std::min(window, end - pos));
+    visit(range.View());
+  }
+}
+
+}  // namespace ppc::util
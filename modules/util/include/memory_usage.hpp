@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace ppc::util {
+
+/// @brief Number and total size of the allocations made through the global operator new.
+struct AllocationStats {
+  std::uint64_t count = 0;
+  std::uint64_t bytes = 0;
+};
+
+namespace detail {
+
+// Per thread, so that counting needs no shared cache line and the threads of a task or of concurrent tasks
+// do not show up in each other's stage numbers
+inline thread_local std::uint64_t allocation_count = 0;
+inline thread_local std::uint64_t allocation_bytes = 0;
+inline std::atomic<bool> allocation_hook_installed{false};
+
+}  // namespace detail
+
+/// @brief Counts one allocation of @p size bytes; called by the operator new replacements.
+inline void CountAllocation(std::size_t size) noexcept {
+  detail::allocation_count++;
+  detail::allocation_bytes += size;
+}
+
+/// @brief Marks that the binary replaces operator new with a counting version.
+/// @details Only ppc_perf_tests links the replacements (tasks/common/runners/alloc_hooks.cpp); everywhere else
+/// the counters stay at zero.
+inline void MarkAllocationHookInstalled() noexcept {
+  detail::allocation_hook_installed.store(true, std::memory_order_relaxed);
+}
+
+[[nodiscard]] inline bool IsAllocationHookInstalled() noexcept {
+  return detail::allocation_hook_installed.load(std::memory_order_relaxed);
+}
+
+/// @brief Allocations made by the calling thread since it started.
+/// @details The per-stage numbers of a task are differences of this value around the stage, so they cover the
+/// allocations of the thread that runs the stage only. Allocations of OpenMP, TBB or std::thread workers and of
+/// MPI progress threads are not attributed to any stage.
+[[nodiscard]] inline AllocationStats CurrentAllocations() noexcept {
+  return {.count = detail::allocation_count, .bytes = detail::allocation_bytes};
+}
+
+/// @brief Peak resident set size of the calling process in bytes.
+/// @details Reads VmHWM from /proc/self/status on Linux and falls back to getrusage(). Returns 0 where neither
+/// is available.
+std::uint64_t GetPeakResidentBytes();
+
+/// @brief Resets the peak resident set size to the current one, so the next GetPeakResidentBytes() covers only
+/// what follows.
+/// @return False if the peak cannot be reset (non-Linux systems, kernels before 4.0); the peak then covers the
+/// whole life of the process.
+bool ResetPeakResidentBytes();
+
+}  // namespace ppc::util
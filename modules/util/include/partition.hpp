@@ -0,0 +1,60 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace ppc::util {
+
+/// @brief Contiguous run [begin, begin + count) of global indices owned by one part.
+struct Range {
+  std::int64_t begin = 0;
+  std::int64_t count = 0;
+
+  [[nodiscard]] std::int64_t End() const {
+    return begin + count;
+  }
+};
+
+/// @brief Block partition of @p n items into @p parts ranges: every part gets n / parts items and the first
+/// n % parts parts one more.
+/// @throws std::runtime_error If @p n is negative or @p parts is not positive.
+std::vector<Range> BlockPartition(std::int64_t n, int parts);
+
+/// @brief Range of part @p part of BlockPartition(@p n, @p parts), computed without the others.
+Range BlockRange(std::int64_t n, int parts, int part);
+
+/// @brief Contiguous partition with part sizes proportional to @p weights, e.g. the measured speeds of the ranks.
+/// @details Items left over by rounding down go to the parts with the largest fractional shares, so the counts add
+/// up to @p n and differ from the exact shares by less than one item.
+/// @throws std::runtime_error If a weight is negative or all weights are zero.
+std::vector<Range> WeightedPartition(std::int64_t n, const std::vector<double> &weights);
+
+/// @brief Part that owns item @p index when blocks of @p block items are dealt to @p parts parts in turn.
+/// @details block = 1 gives the cyclic distribution.
+int BlockCyclicOwner(std::int64_t index, std::int64_t block, int parts);
+
+/// @brief Number of the first @p n items that part @p part owns in the block-cyclic distribution.
+/// @throws std::runtime_error If @p block is not positive.
+std::int64_t BlockCyclicCount(std::int64_t n, std::int64_t block, int parts, int part);
+
+/// @brief Runs of items that part @p part owns in the block-cyclic distribution, in increasing order.
+std::vector<Range> BlockCyclicRanges(std::int64_t n, std::int64_t block, int parts, int part);
+
+/// @brief Counts and displacements of a partition for the MPI "v" collectives.
+struct MpiCounts {
+  std::vector<int> counts;
+  std::vector<int> displs;
+};
+
+/// @brief Converts @p parts to MPI counts and displacements in units of @p scale items.
+/// @throws std::runtime_error If a count or displacement does not fit in int; pass larger units (e.g. rows instead
+/// of elements) together with a matching derived datatype in that case.
+MpiCounts ToMpiCounts(const std::vector<Range> &parts, std::int64_t scale = 1);
+
+/// @brief Collects the @p local_speed of every rank of @p comm, indexed by rank, as weights for
+/// WeightedPartition(). Collective.
+std::vector<double> GatherRankSpeeds(double local_speed, MPI_Comm comm);
+
+}  // namespace ppc::util
@@ -1,27 +1,96 @@
 #pragma once
 
 #include <gtest/gtest.h>
+#include <mpi.h>
 #include <omp.h>
 
+#include <algorithm>
+#include <array>
+#include <charconv>
 #include <chrono>
 #include <csignal>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <iomanip>
+#include <iostream>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <system_error>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
+#include "performance/include/counters.hpp"
 #include "performance/include/performance.hpp"
+#include "performance/include/result_sink.hpp"
 #include "task/include/task.hpp"
 #include "util/include/util.hpp"
 
 namespace ppc::util {
 
 double GetTimeMPI();
-int GetMPIRank();
+int GetMPIRank(MPI_Comm comm = MPI_COMM_WORLD);
+int GetMPISize(MPI_Comm comm = MPI_COMM_WORLD);
+/// @brief Name of the host the calling process runs on, as reported by MPI_Get_processor_name.
+std::string GetProcessorName();
+/// @brief Returns true on every rank if @p value is true on all ranks of MPI_COMM_WORLD.
+bool AllProcessesAgree(bool value);
+/// @brief Reduces per-stage times over MPI_COMM_WORLD into the fastest, average and slowest process.
+ppc::performance::StageBreakdown AggregateStageTimings(const ppc::task::StageTimings &timings);
+/// @brief Reduces the per-iteration times over MPI_COMM_WORLD into the fastest, average and slowest process of
+/// each iteration. Every rank must pass the same number of samples.
+ppc::performance::SampleBreakdown AggregateSampleTimes(const std::vector<double> &samples);
+/// @brief Reduces the peak RSS and per-stage allocations over MPI_COMM_WORLD into their min, average and max.
+ppc::performance::MemoryUsage AggregateMemoryUsage(const ppc::performance::MemorySample &sample);
+/// @brief Gathers the hardware counters of every rank of MPI_COMM_WORLD, indexed by rank.
+std::vector<ppc::performance::CounterValues> GatherCounterValues(const ppc::performance::CounterValues &local);
+
+/// @brief Makes @p perf_attrs time MPI tasks over MPI_COMM_WORLD: MPI wall clock, ranks that start every
+/// iteration together and samples, stage times, memory and counters reduced over the ranks.
+inline void SetMpiPerfAttributes(ppc::performance::PerfAttr &perf_attrs) {
+  const double t0 = GetTimeMPI();
+  perf_attrs.current_timer = [t0] { return GetTimeMPI() - t0; };
+  perf_attrs.all_agree = AllProcessesAgree;
+  perf_attrs.sync_start = [] { MPI_Barrier(MPI_COMM_WORLD); };
+  perf_attrs.aggregate_samples = AggregateSampleTimes;
+  perf_attrs.aggregate_stages = AggregateStageTimings;
+  perf_attrs.aggregate_memory = AggregateMemoryUsage;
+  perf_attrs.gather_counters = GatherCounterValues;
+}
+
+/// @brief Suffix that marks the input size N in the names of size-sweep test cases.
+inline constexpr std::string_view kProblemSizeTag = "_size";
+
+/// @brief Extracts N from a test name ending in "_size<N>"; 0 if there is none.
+inline std::size_t ParseProblemSize(const std::string &test_name) {
+  const auto pos = test_name.rfind(kProblemSizeTag);
+  if (pos == std::string::npos) {
+    return 0;
+  }
+  const auto suffix = std::string_view(test_name).substr(pos + kProblemSizeTag.size());
+  std::size_t size = 0;
+  const auto [end, ec] = std::from_chars(suffix.data(), suffix.data() + suffix.size(), size);
+  if (ec != std::errc() || end != suffix.data() + suffix.size()) {
+    return 0;
+  }
+  return size;
+}
+
+/// @brief Geometric series of Count input sizes: first, first * ratio, first * ratio^2, ...
+template <std::size_t Count>
+constexpr std::array<std::size_t, Count> GeometricSizes(std::size_t first, std::size_t ratio) {
+  std::array<std::size_t, Count> sizes{};
+  std::size_t size = first;
+  for (auto &value : sizes) {
+    value = size;
+    size *= ratio;
+  }
+  return sizes;
+}
 
 template <typename InType, typename OutType>
 using PerfTestParam = std::tuple<std::function<ppc::task::TaskPtr<InType, OutType>(InType)>, std::string,
@@ -41,15 +110,45 @@ class BaseRunPerfTests : public ::testing::TestWithParam<PerfTestParam<InType, O
   }
 
  protected:
+  /// @brief Samples farther than this many scaled MADs from the median are not counted.
+  static constexpr double kOutlierThreshold = 3.5;
+
+  /// @brief Input growth factor requested by a weak-scaling sweep (PPC_PERF_PROBLEM_SCALE, default 1).
+  /// @details Tests that support weak scaling multiply their problem size by it when they build the input and
+  /// override SupportsProblemScale(); the other tests keep their fixed input.
+  static int GetProblemScale() {
+    return std::max(GetPerfProblemScale(), 1);
+  }
+  /// @brief Whether the input built by this test grows with GetProblemScale().
+  [[nodiscard]] virtual bool SupportsProblemScale() const {
+    return false;
+  }
+
+  /// @brief Input size N of the current size-sweep test case (see MakeAllPerfSizeTasks).
+  /// @return The N encoded in the test name, or @p default_size for a test case outside a sweep.
+  [[nodiscard]] std::size_t GetProblemSize(std::size_t default_size) const {
+    const auto &test_name = std::get<static_cast<std::size_t>(GTestParamIndex::kNameTest)>(this->GetParam());
+    const auto size = ParseProblemSize(test_name);
+    return size == 0 ? default_size : size;
+  }
+  /// @brief Work done by one task run, used to report the throughput, e.g. {n, "elements"} or {flops / 1e9,
+  /// "GFLOP"}. Called after the measurement; the default reports no throughput.
+  [[nodiscard]] virtual ppc::performance::WorkAmount GetWorkAmount() const {
+    return {};
+  }
+
   virtual bool CheckTestOutputData(OutType &output_data) = 0;
   /// @brief Supplies input data for performance testing.
   virtual InType GetTestInputData() = 0;
 
   virtual void SetPerfAttributes(ppc::performance::PerfAttr &perf_attrs) {
+    perf_attrs.num_warmup = static_cast<uint64_t>(std::max(GetPerfWarmupRuns(), 0));
+    perf_attrs.outlier_threshold = kOutlierThreshold;
+    perf_attrs.target_relative_ci = GetPerfTargetCi();
+    perf_attrs.collect_counters = IsPerfCountersEnabled();
     if (task_->GetDynamicTypeOfTask() == ppc::task::TypeOfTask::kMPI ||
         task_->GetDynamicTypeOfTask() == ppc::task::TypeOfTask::kALL) {
-      const double t0 = GetTimeMPI();
-      perf_attrs.current_timer = [t0] { return GetTimeMPI() - t0; };
+      SetMpiPerfAttributes(perf_attrs);
     } else if (task_->GetDynamicTypeOfTask() == ppc::task::TypeOfTask::kOMP) {
       const double t0 = omp_get_wtime();
       perf_attrs.current_timer = [t0] { return omp_get_wtime() - t0; };
@@ -96,6 +195,8 @@ class BaseRunPerfTests : public ::testing::TestWithParam<PerfTestParam<InType, O
 
     if (GetMPIRank() == 0) {
       perf.PrintPerfStatistic(test_name);
+      PrintThroughput(test_name, perf.GetPerfResults());
+      WritePerfRecord(test_name, perf.GetPerfResults());
     }
 
     OutType output_data = task_->GetOutput();
@@ -104,6 +205,39 @@ class BaseRunPerfTests : public ::testing::TestWithParam<PerfTestParam<InType, O
 
  private:
   ppc::task::TaskPtr<InType, OutType> task_;
+
+  // "<test>:<mode>:throughput:<count per second> <unit>/s" for tests that report their work
+  void PrintThroughput(const std::string &test_name, const ppc::performance::PerfResults &results) const {
+    const auto work = GetWorkAmount();
+    if (work.count <= 0.0 || results.time_sec <= 0.0) {
+      return;
+    }
+    std::stringstream throughput_str;
+    throughput_str << std::scientific << std::setprecision(4) << work.count / results.time_sec << " " << work.unit
+                   << "/s";
+    std::cout << test_name << ":" << ppc::performance::GetStringParamName(results.type_of_running)
+              << ":throughput:" << throughput_str.str() << '\n';
+  }
+
+  // Appends the measurement to PPC_PERF_RESULTS_FILE when it is set
+  void WritePerfRecord(const std::string &test_name, const ppc::performance::PerfResults &results) {
+    const auto path = GetPerfResultsFile();
+    if (path.empty()) {
+      return;
+    }
+    ppc::performance::RunContext context;
+    context.impl = ppc::task::TypeOfTaskToString(task_->GetDynamicTypeOfTask());
+    // test_name is "<namespace>_<impl>_<status>", with "_size<N>" appended in a size sweep
+    context.task = test_name.substr(0, test_name.rfind("_" + context.impl + "_"));
+    context.num_proc = GetMPISize();
+    context.num_threads = GetNumThreads();
+    context.hostname = GetProcessorName();
+    context.git_sha = GetGitCommit();
+    context.problem_scale = SupportsProblemScale() ? GetProblemScale() : 1;
+    context.problem_size = ParseProblemSize(test_name);
+    context.work = GetWorkAmount();
+    ppc::performance::AppendPerfRecord(path, ppc::performance::MakePerfRecord(context, results));
+  }
 };
 
 template <typename TaskType, typename InputType>
@@ -117,6 +251,26 @@ auto MakePerfTaskTuples(const std::string &settings_path) {
                                          ppc::performance::PerfResults::TypeOfRunning::kTaskRun));
 }
 
+template <typename TaskType, typename InputType, std::size_t N, std::size_t... I>
+auto MakePerfSizeTaskTuplesImpl(const std::string &settings_path, const std::array<std::size_t, N> &sizes,
+                                std::index_sequence<I...> /*unused*/) {
+  const auto name = std::string(GetNamespace<TaskType>()) + "_" +
+                    ppc::task::GetStringTaskType(TaskType::GetStaticTypeOfTask(), settings_path);
+  return std::tuple_cat(std::make_tuple(
+      std::make_tuple(ppc::task::TaskGetter<TaskType, InputType>,
+                      name + std::string(kProblemSizeTag) + std::to_string(sizes[I]),
+                      ppc::performance::PerfResults::TypeOfRunning::kPipeline),
+      std::make_tuple(ppc::task::TaskGetter<TaskType, InputType>,
+                      name + std::string(kProblemSizeTag) + std::to_string(sizes[I]),
+                      ppc::performance::PerfResults::TypeOfRunning::kTaskRun))...);
+}
+
+/// @brief Pipeline and task_run test cases of @p TaskType for every input size in @p sizes.
+template <typename TaskType, typename InputType, std::size_t N>
+auto MakePerfSizeTaskTuples(const std::string &settings_path, const std::array<std::size_t, N> &sizes) {
+  return MakePerfSizeTaskTuplesImpl<TaskType, InputType>(settings_path, sizes, std::make_index_sequence<N>{});
+}
+
 template <typename Tuple, std::size_t... I>
 auto TupleToGTestValuesImpl(const Tuple &tup, std::index_sequence<I...> /*unused*/) {
   return ::testing::Values(std::get<I>(tup)...);
@@ -133,4 +287,12 @@ auto MakeAllPerfTasks(const std::string &settings_path) {
   return std::tuple_cat(MakePerfTaskTuples<TaskTypes, InputType>(settings_path)...);
 }
 
+/// @brief Size-sweep counterpart of MakeAllPerfTasks: test cases named "<namespace>_<impl>_<status>_size<N>".
+/// @details The test builds its input for GetProblemSize() in SetUp(), so every implementation is measured on the
+/// same series of sizes and scripts/complexity_report.py can fit time against N.
+template <typename InputType, typename... TaskTypes, std::size_t N>
+auto MakeAllPerfSizeTasks(const std::string &settings_path, const std::array<std::size_t, N> &sizes) {
+  return std::tuple_cat(MakePerfSizeTaskTuples<TaskTypes, InputType>(settings_path, sizes)...);
+}
+
 }  // namespace ppc::util
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ppc::util {
+
+/// @brief Persistent pool of worker threads with a work-stealing queue per worker.
+/// @details Workers take their own newest job first and steal the oldest job of another worker when their queue is
+/// empty. Idle workers sleep until a job arrives, so the pool costs nothing between task runs. A thread that waits in
+/// ParallelFor() or ParallelReduce() runs queued jobs itself, which makes nested calls from pool jobs safe.
+class ThreadPool {
+ public:
+  /// @param num_threads Number of workers; at least one is started.
+  explicit ThreadPool(int num_threads);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+  ThreadPool(ThreadPool &&) = delete;
+  ThreadPool &operator=(ThreadPool &&) = delete;
+
+  /// @brief Process-wide pool of GetNumThreads() workers, started on first use and kept until the process exits.
+  static ThreadPool &Instance();
+
+  [[nodiscard]] int Size() const {
+    return static_cast<int>(threads_.size());
+  }
+
+  /// @brief Queues @p job and returns a future for its result.
+  template <typename F>
+  std::future<std::invoke_result_t<F>> Submit(F &&job) {
+    auto packaged = std::make_shared<std::packaged_task<std::invoke_result_t<F>()>>(std::forward<F>(job));
+    auto future = packaged->get_future();
+    Push([packaged] { (*packaged)(); });
+    return future;
+  }
+
+  /// @brief Calls @p body(i) for every i in [first, last) and returns when all calls are done.
+  /// @param grain Indices per job; 0 splits the range into four jobs per worker.
+  /// @details The first exception thrown by @p body is rethrown after the remaining jobs have finished.
+  template <typename F>
+  void ParallelFor(std::size_t first, std::size_t last, F &&body, std::size_t grain = 0) {
+    ForEachChunk(first, last, grain, [&body](std::size_t /*chunk*/, std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; i++) {
+        body(i);
+      }
+    });
+  }
+
+  /// @brief Reduces @p map(begin, end) over the chunks of [first, last) with @p reduce, starting from @p init.
+  /// @details Chunk results are combined in index order, so the result does not depend on the number of workers
+  /// as long as @p grain is fixed.
+  template <typename T, typename Map, typename Reduce>
+  T ParallelReduce(std::size_t first, std::size_t last, T init, Map &&map, Reduce &&reduce, std::size_t grain = 0) {
+    // Optionals rather than a vector<T>, so that bool results are not packed into shared words
+    std::vector<std::optional<T>> partial(NumChunks(first, last, grain));
+    ForEachChunk(first, last, grain, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+      partial[chunk] = map(begin, end);
+    });
+    T result = std::move(init);
+    for (auto &value : partial) {
+      result = reduce(std::move(result), std::move(*value));
+    }
+    return result;
+  }
+
+ private:
+  struct WorkerQueue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> jobs;
+  };
+
+  std::vector<std::unique_ptr<WorkerQueue>> queues_;
+  std::vector<std::jthread> threads_;
+  std::atomic<std::size_t> queued_ = 0;
+  std::atomic<std::size_t> next_queue_ = 0;
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  bool stop_ = false;
+
+  void Push(std::function<void()> job);
+  /// @brief Runs one queued job, preferring the queue of the calling worker. Returns false if all queues are empty.
+  bool RunPending();
+  void WorkerLoop(std::size_t index);
+
+  [[nodiscard]] std::size_t ChunkSize(std::size_t count, std::size_t grain) const {
+    return grain > 0 ? grain : std::max<std::size_t>(1, count / (4 * threads_.size()));
+  }
+  [[nodiscard]] std::size_t NumChunks(std::size_t first, std::size_t last, std::size_t grain) const {
+    if (last <= first) {
+      return 0;
+    }
+    const std::size_t step = ChunkSize(last - first, grain);
+    return (last - first + step - 1) / step;
+  }
+
+  // Calls chunk_body(chunk index, begin, end) for each chunk on the pool and helps until all chunks are done
+  template <typename F>
+  void ForEachChunk(std::size_t first, std::size_t last, std::size_t grain, F &&chunk_body) {
+    const std::size_t chunks = NumChunks(first, last, grain);
+    if (chunks == 0) {
+      return;
+    }
+    const std::size_t step = ChunkSize(last - first, grain);
+    // The count is changed under the mutex, so the waiter cannot return while the last chunk still notifies
+    std::size_t remaining = chunks;
+    std::mutex done_mutex;
+    std::condition_variable done;
+    std::exception_ptr error;
+    for (std::size_t chunk = 0; chunk < chunks; chunk++) {
+      const std::size_t begin = first + (chunk * step);
+      const std::size_t end = std::min(last, begin + step);
+      Push([&, chunk, begin, end] {
+        std::exception_ptr chunk_error;
+        try {
+          chunk_body(chunk, begin, end);
+        } catch (...) {
+          chunk_error = std::current_exception();
+        }
+        const std::scoped_lock lock(done_mutex);
+        if (chunk_error && !error) {
+          error = chunk_error;
+        }
+        if (--remaining == 0) {
+          done.notify_all();
+        }
+      });
+    }
+    while (true) {
+      {
+        const std::scoped_lock lock(done_mutex);
+        if (remaining == 0) {
+          break;
+        }
+      }
+      if (!RunPending()) {
+        // Every chunk has been taken: sleep until the running ones finish instead of spinning
+        std::unique_lock lock(done_mutex);
+        done.wait(lock, [&remaining] { return remaining == 0; });
+        break;
+      }
+    }
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+};
+
+}  // namespace ppc::util
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace ppc::util {
+
+/// @brief One complete span of a trace. The names are not copied, so they must be string literals.
+struct TraceEvent {
+  const char *name = nullptr;
+  const char *category = nullptr;
+  double begin_us = 0.0;
+  double duration_us = 0.0;
+};
+
+/// @brief Records spans of all threads of the process for a Chrome / Perfetto timeline.
+/// @details Every thread writes into its own buffer of kEventsPerThread events, allocated once the first time the
+/// thread records, so recording takes no lock and does not allocate. A full buffer drops further events and counts
+/// them. The buffer of a finished thread is handed to the next new thread and keeps its events. The tracer is off
+/// until Start(); StartTracing() and FinishTracing() run it for a whole MPI job.
+class Tracer {
+ public:
+  static constexpr std::size_t kEventsPerThread = std::size_t{1} << 16;
+
+  static Tracer &Instance();
+
+  Tracer(const Tracer &) = delete;
+  Tracer &operator=(const Tracer &) = delete;
+  Tracer(Tracer &&) = delete;
+  Tracer &operator=(Tracer &&) = delete;
+
+  [[nodiscard]] bool Enabled() const {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+
+  /// @brief Drops the events of a previous run and starts recording.
+  /// @param pid Process id of the events in the trace, the MPI rank.
+  /// @param clock_shift_us Added to NowUs() for the timestamps, so that the processes of a job share one origin.
+  /// @details Must not be called while other threads record.
+  void Start(int pid, double clock_shift_us = 0.0);
+  /// @brief Stops recording. The events stay available to Write() until the next Start().
+  void Stop();
+
+  /// @brief Microseconds on the local steady clock.
+  static double NowUs();
+  /// @brief Stores a span from @p begin_us, taken with NowUs(), until now. Does nothing while the tracer is off.
+  void Record(const char *name, const char *category, double begin_us);
+
+  /// @brief Writes the recorded events of all threads in the Chrome trace event format.
+  void Write(std::ostream &out) const;
+  [[nodiscard]] std::size_t NumEvents() const;
+  [[nodiscard]] std::size_t NumDropped() const;
+
+ private:
+  struct ThreadBuffer {
+    std::vector<TraceEvent> events = std::vector<TraceEvent>(kEventsPerThread);
+    std::atomic<std::size_t> size = 0;
+    std::atomic<std::size_t> dropped = 0;
+    int tid = 0;
+  };
+
+  // Gives the buffer of a finished thread back to the tracer
+  class BufferLease;
+
+  Tracer() = default;
+  ThreadBuffer &LocalBuffer();
+  void Release(ThreadBuffer *buffer);
+
+  std::atomic<bool> enabled_ = false;
+  int pid_ = 0;
+  double clock_shift_us_ = 0.0;
+  mutable std::mutex buffers_mutex_;
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+  std::vector<ThreadBuffer *> free_buffers_;
+};
+
+/// @brief Records the lifetime of the object as a span of the current thread while the tracer is on.
+class TraceSpan {
+ public:
+  /// @param name Name of the span; must be a string literal.
+  /// @param category Category of the span, e.g. "task" or "mpi"; must be a string literal.
+  explicit TraceSpan(const char *name, const char *category = "user")
+      : name_(name), category_(category), begin_us_(Tracer::Instance().Enabled() ? Tracer::NowUs() : -1.0) {}
+  ~TraceSpan() {
+    if (begin_us_ >= 0.0) {
+      Tracer::Instance().Record(name_, category_, begin_us_);
+    }
+  }
+
+  TraceSpan(const TraceSpan &) = delete;
+  TraceSpan &operator=(const TraceSpan &) = delete;
+  TraceSpan(TraceSpan &&) = delete;
+  TraceSpan &operator=(TraceSpan &&) = delete;
+
+ private:
+  const char *name_;
+  const char *category_;
+  double begin_us_;
+};
+
+/// @brief Estimates in microseconds how far the NowUs() clock of rank 0 of @p comm is ahead of the local one.
+/// @details Each rank exchanges a few messages with rank 0 and keeps the round trip with the lowest latency
+/// (Cristian's algorithm). Collective over @p comm; rank 0 gets 0.
+double EstimateClockOffsetUs(MPI_Comm comm);
+
+/// @brief Starts the tracer on every rank of @p comm with the clocks aligned to rank 0. Collective.
+void StartTracing(MPI_Comm comm);
+
+/// @brief Stops the tracer and writes the events of the calling rank of @p comm to "<dir>/trace_rank<rank>.json".
+/// @throws std::runtime_error If the file cannot be written.
+void FinishTracing(const std::string &dir, MPI_Comm comm);
+
+}  // namespace ppc::util
+
+#define PPC_TRACE_CONCAT_IMPL(a, b) a##b
+#define PPC_TRACE_CONCAT(a, b) PPC_TRACE_CONCAT_IMPL(a, b)
+
+/// @brief Traces the rest of the enclosing scope as a span named @p name (a string literal).
+#define PPC_TRACE_SPAN(name) const ppc::util::TraceSpan PPC_TRACE_CONCAT(ppc_trace_span_, __LINE__)(name)
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace ppc::util {
+
+/// @brief Values of the tuning parameters of a task, by parameter name.
+using TuneConfig = std::map<std::string, std::int64_t>;
+
+/// @brief Size bucket of an input of @p size items: floor(log2(size)), 0 for sizes below 2.
+/// @details Configurations are cached per bucket, so one measured size covers every input of the same magnitude.
+int SizeBucket(std::uint64_t size);
+
+/// @brief Best configurations found by the autotuner, per task, process count and size bucket, in a JSON file.
+/// @details The file maps "<task>" -> "p<num_proc>" -> "b<bucket>" -> {"config": {...}, "time_sec": t}.
+class TuningCache {
+ public:
+  /// @brief Loads @p path if it exists, otherwise starts empty.
+  /// @throws std::runtime_error If the file cannot be read or is not a JSON object.
+  explicit TuningCache(std::filesystem::path path);
+
+  [[nodiscard]] std::optional<TuneConfig> Find(std::string_view task, std::uint64_t size, int num_proc) const;
+  /// @brief Time of the cached configuration of the bucket, if any.
+  [[nodiscard]] std::optional<double> FindTime(std::string_view task, std::uint64_t size, int num_proc) const;
+  /// @brief Replaces the configuration of the bucket of @p size.
+  void Store(std::string_view task, std::uint64_t size, int num_proc, const TuneConfig &config, double time_sec);
+  /// @brief Writes the cache back to its file through a temporary file, so readers never see a partial file.
+  /// @throws std::runtime_error If the file cannot be written.
+  void Save() const;
+
+ private:
+  std::filesystem::path path_;
+  nlohmann::json data_ = nlohmann::json::object();
+
+  [[nodiscard]] const nlohmann::json *Entry(std::string_view task, std::uint64_t size, int num_proc) const;
+};
+
+/// @brief Value of tuning parameter @p name for the calling task, or @p fallback if it has not been tuned.
+/// @details Looks at the configuration set by a ScopedTuneConfig for @p task first, then at the cache file
+/// GetTuningCacheFile(), which is read once per process. A missing or unreadable cache gives @p fallback, so tasks
+/// can call this unconditionally in PreProcessing. MPI tasks should take the value of one rank, since the cache
+/// file may differ between hosts.
+std::int64_t GetTunedValue(std::string_view task, std::string_view name, std::uint64_t size, int num_proc,
+                           std::int64_t fallback);
+
+/// @brief Drops the cache read by GetTunedValue(), so the next call reads the file again.
+void ReloadTuningCache();
+
+/// @brief Makes GetTunedValue() return @p config for @p task while the object lives; used by the autotuner to try
+/// a configuration.
+class ScopedTuneConfig {
+ public:
+  ScopedTuneConfig(std::string task, TuneConfig config);
+  ~ScopedTuneConfig();
+
+  ScopedTuneConfig(const ScopedTuneConfig &) = delete;
+  ScopedTuneConfig &operator=(const ScopedTuneConfig &) = delete;
+  ScopedTuneConfig(ScopedTuneConfig &&) = delete;
+  ScopedTuneConfig &operator=(ScopedTuneConfig &&) = delete;
+
+ private:
+  std::string task_;
+  std::optional<TuneConfig> previous_;
+};
+
+}  // namespace ppc::util
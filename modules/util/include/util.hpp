@@ -71,6 +71,19 @@ int GetNumThreads();
 int GetNumProc();
 double GetTaskMaxTime();
 double GetPerfMaxTime();
+int GetPerfWarmupRuns();
+double GetPerfTargetCi();
+std::string GetPerfResultsFile();
+bool IsPerfCountersEnabled();
+bool IsThreadReleaseEnabled();
+int GetPerfProblemScale();
+int GetMpiProfileTop();
+std::string GetGitCommit();
+std::string GetDatasetCacheDir();
+std::string GetTraceDir();
+std::string GetPinPolicy();
+std::string GetTuningCacheFile();
+bool IsAutotuneEnabled();
 
 template <typename T>
 std::string GetNamespace() {
@@ -0,0 +1,249 @@
+#include "util/include/affinity.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "util/include/partition.hpp"
+
+#ifdef __linux__
+#  include <sched.h>
+#endif
+
+namespace ppc::util {
+
+namespace {
+
+int ParseCpuNumber(std::string_view text) {
+  int value = -1;
+  const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+  if (error != std::errc{} || end != text.data() + text.size() || value < 0) {
+    throw std::runtime_error("Invalid CPU number '" + std::string(text) + "'");
+  }
+  return value;
+}
+
+// First integer in a sysfs file, or fallback if the file is missing
+int ReadSysfsInt(const std::filesystem::path &path, int fallback) {
+  std::ifstream file(path);
+  int value = fallback;
+  if (!(file >> value)) {
+    return fallback;
+  }
+  return value;
+}
+
+// Number after prefix in names like "cpu12" or "node1", -1 for other names
+int NumberedEntry(const std::string &name, std::string_view prefix) {
+  if (!name.starts_with(prefix) || name.size() == prefix.size()) {
+    return -1;
+  }
+  const std::string_view digits = std::string_view(name).substr(prefix.size());
+  if (!std::ranges::all_of(digits, [](char c) { return c >= '0' && c <= '9'; })) {
+    return -1;
+  }
+  return ParseCpuNumber(digits);
+}
+
+std::mutex placement_mutex;
+std::vector<int> placement;
+
+}  // namespace
+
+PinPolicy ParsePinPolicy(std::string_view name) {
+  if (name.empty() || name == "none") {
+    return PinPolicy::kNone;
+  }
+  if (name == "compact") {
+    return PinPolicy::kCompact;
+  }
+  if (name == "scatter") {
+    return PinPolicy::kScatter;
+  }
+  throw std::runtime_error("Unknown pinning policy '" + std::string(name) + "', expected none, compact or scatter");
+}
+
+std::vector<int> ParseCpuList(std::string_view list) {
+  std::vector<int> cpus;
+  while (!list.empty() && (list.back() == '\n' || list.back() == ' ')) {
+    list.remove_suffix(1);
+  }
+  while (!list.empty()) {
+    const std::size_t comma = list.find(',');
+    const std::string_view item = list.substr(0, comma);
+    list = comma == std::string_view::npos ? std::string_view{} : list.substr(comma + 1);
+    const std::size_t dash = item.find('-');
+    const int first = ParseCpuNumber(item.substr(0, dash));
+    const int last = dash == std::string_view::npos ? first : ParseCpuNumber(item.substr(dash + 1));
+    if (last < first) {
+      throw std::runtime_error("Invalid CPU range '" + std::string(item) + "'");
+    }
+    for (int cpu = first; cpu <= last; cpu++) {
+      cpus.push_back(cpu);
+    }
+  }
+  return cpus;
+}
+
+std::vector<CpuInfo> ReadCpuTopology(const std::filesystem::path &sysfs_root) {
+  namespace fs = std::filesystem;
+  std::error_code ec;
+  std::vector<CpuInfo> cpus;
+  for (const auto &entry : fs::directory_iterator(sysfs_root / "cpu", ec)) {
+    const int cpu = NumberedEntry(entry.path().filename().string(), "cpu");
+    // cpu0 usually has no "online" file, since it cannot be taken offline
+    if (cpu < 0 || ReadSysfsInt(entry.path() / "online", 1) == 0) {
+      continue;
+    }
+    cpus.push_back({.cpu = cpu,
+                    .core = ReadSysfsInt(entry.path() / "topology" / "core_id", cpu),
+                    .package = ReadSysfsInt(entry.path() / "topology" / "physical_package_id", 0),
+                    .node = 0});
+  }
+  std::ranges::sort(cpus, {}, &CpuInfo::cpu);
+
+  for (const auto &entry : fs::directory_iterator(sysfs_root / "node", ec)) {
+    const int node = NumberedEntry(entry.path().filename().string(), "node");
+    std::ifstream file(entry.path() / "cpulist");
+    std::string list;
+    if (node < 0 || !std::getline(file, list)) {
+      continue;
+    }
+    for (const int cpu : ParseCpuList(list)) {
+      const auto it = std::ranges::lower_bound(cpus, cpu, {}, &CpuInfo::cpu);
+      if (it != cpus.end() && it->cpu == cpu) {
+        it->node = node;
+      }
+    }
+  }
+  return cpus;
+}
+
+std::vector<int> RankCpus(std::vector<CpuInfo> cpus, PinPolicy policy, int local_rank, int local_size) {
+  if (policy == PinPolicy::kNone || cpus.empty() || local_size <= 0) {
+    return {};
+  }
+  // Compact order: hardware threads of a core, cores of a package and packages of a node are neighbours
+  std::ranges::sort(cpus, [](const CpuInfo &a, const CpuInfo &b) {
+    return std::tie(a.node, a.package, a.core, a.cpu) < std::tie(b.node, b.package, b.core, b.cpu);
+  });
+
+  // CPUs shared by the ranks of the calling one's domain, and its place among them
+  auto domain_begin = cpus.begin();
+  auto domain_end = cpus.end();
+  int slot = local_rank;
+  int domain_ranks = local_size;
+  if (policy == PinPolicy::kScatter) {
+    std::vector<std::pair<std::size_t, std::size_t>> nodes;
+    for (std::size_t i = 0; i < cpus.size(); i++) {
+      if (i == 0 || cpus[i].node != cpus[i - 1].node) {
+        nodes.emplace_back(i, i);
+      }
+      nodes.back().second = i + 1;
+    }
+    const int num_nodes = static_cast<int>(nodes.size());
+    const int node = local_rank % num_nodes;
+    domain_begin = cpus.begin() + static_cast<std::ptrdiff_t>(nodes[static_cast<std::size_t>(node)].first);
+    domain_end = cpus.begin() + static_cast<std::ptrdiff_t>(nodes[static_cast<std::size_t>(node)].second);
+    slot = local_rank / num_nodes;
+    domain_ranks = (local_size - node + num_nodes - 1) / num_nodes;
+  }
+  const auto domain_size = static_cast<std::int64_t>(domain_end - domain_begin);
+  std::vector<CpuInfo> mine;
+  if (domain_ranks <= domain_size) {
+    const auto range = BlockRange(domain_size, domain_ranks, slot);
+    mine.assign(domain_begin + range.begin, domain_begin + range.End());
+  } else {
+    mine.push_back(*(domain_begin + (slot % domain_size)));
+  }
+
+  if (policy == PinPolicy::kScatter) {
+    // The first hardware thread of every core comes before the second ones
+    std::map<std::pair<int, int>, int> seen;
+    std::vector<std::pair<int, CpuInfo>> by_sibling;
+    for (const auto &cpu : mine) {
+      by_sibling.emplace_back(seen[{cpu.package, cpu.core}]++, cpu);
+    }
+    std::ranges::stable_sort(by_sibling, {}, &std::pair<int, CpuInfo>::first);
+    for (std::size_t i = 0; i < mine.size(); i++) {
+      mine[i] = by_sibling[i].second;
+    }
+  }
+  std::vector<int> result;
+  result.reserve(mine.size());
+  for (const auto &cpu : mine) {
+    result.push_back(cpu.cpu);
+  }
+  return result;
+}
+
+std::vector<int> GetThreadAffinity() {
+  std::vector<int> cpus;
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+      if (CPU_ISSET(cpu, &set)) {
+        cpus.push_back(cpu);
+      }
+    }
+  }
+#endif
+  return cpus;
+}
+
+void SetThreadAffinity(const std::vector<int> &cpus) {
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (const int cpu : cpus) {
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+      throw std::runtime_error("CPU " + std::to_string(cpu) + " is out of the affinity mask range");
+    }
+    CPU_SET(cpu, &set);
+  }
+  if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+    throw std::runtime_error("sched_setaffinity failed: " + std::system_category().message(errno));
+  }
+#else
+  (void)cpus;
+  throw std::runtime_error("Thread affinity is not supported on this system");
+#endif
+}
+
+void SetThreadPlacement(std::vector<int> cpus) {
+  const std::scoped_lock lock(placement_mutex);
+  placement = std::move(cpus);
+}
+
+void PinThreadToSlot(int slot) {
+  int cpu = -1;
+  {
+    const std::scoped_lock lock(placement_mutex);
+    if (placement.empty() || slot < 0) {
+      return;
+    }
+    cpu = placement[static_cast<std::size_t>(slot) % placement.size()];
+  }
+  try {
+    SetThreadAffinity({cpu});
+  } catch (const std::runtime_error &) {
+    // Pinning only tunes performance, a thread that cannot be pinned keeps running where it is
+  }
+}
+
+}  // namespace ppc::util
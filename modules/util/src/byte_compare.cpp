@@ -0,0 +1,93 @@
+#include "util/include/byte_compare.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#if defined(__AVX512BW__) || defined(__AVX2__) || defined(__SSE2__)
+#  include <immintrin.h>
+#endif
+
+namespace ppc::util {
+
+namespace {
+
+#if defined(__AVX512BW__)
+constexpr std::size_t kBlockBytes = 64;
+using BlockMask = std::uint64_t;
+
+// Bit i of the result is set when a[i] != b[i].
+BlockMask MismatchMask(const char *a, const char *b) {
+  const __m512i va = _mm512_loadu_si512(a);
+  const __m512i vb = _mm512_loadu_si512(b);
+  return ~static_cast<BlockMask>(_mm512_cmpeq_epi8_mask(va, vb));
+}
+#elif defined(__AVX2__)
+constexpr std::size_t kBlockBytes = 32;
+using BlockMask = std::uint32_t;
+
+BlockMask MismatchMask(const char *a, const char *b) {
+  const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a));
+  const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b));
+  return ~static_cast<BlockMask>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb)));
+}
+#elif defined(__SSE2__)
+constexpr std::size_t kBlockBytes = 16;
+using BlockMask = std::uint32_t;
+
+BlockMask MismatchMask(const char *a, const char *b) {
+  const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a));
+  const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b));
+  return ~static_cast<BlockMask>(_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb))) & 0xFFFFU;
+}
+#else
+// Portable fallback: the same block structure with a plain loop, which compilers vectorize on their own.
+constexpr std::size_t kBlockBytes = 16;
+using BlockMask = std::uint32_t;
+
+BlockMask MismatchMask(const char *a, const char *b) {
+  BlockMask mask = 0;
+  for (std::size_t i = 0; i < kBlockBytes; ++i) {
+    mask |= static_cast<BlockMask>(a[i] != b[i]) << i;
+  }
+  return mask;
+}
+#endif
+
+}  // namespace
+
+std::size_t CountMismatches(std::string_view a, std::string_view b) {
+  const std::size_t len = std::min(a.size(), b.size());
+  const std::size_t blocks_end = len - (len % kBlockBytes);
+
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < blocks_end; i += kBlockBytes) {
+    count += static_cast<std::size_t>(std::popcount(MismatchMask(a.data() + i, b.data() + i)));
+  }
+  for (std::size_t i = blocks_end; i < len; ++i) {
+    count += static_cast<std::size_t>(a[i] != b[i]);
+  }
+  return count;
+}
+
+std::size_t FindFirstMismatch(std::string_view a, std::string_view b) {
+  const std::size_t len = std::min(a.size(), b.size());
+  const std::size_t blocks_end = len - (len % kBlockBytes);
+
+  for (std::size_t i = 0; i < blocks_end; i += kBlockBytes) {
+    const BlockMask mask = MismatchMask(a.data() + i, b.data() + i);
+    if (mask != 0) {
+      return i + static_cast<std::size_t>(std::countr_zero(mask));
+    }
+  }
+  for (std::size_t i = blocks_end; i < len; ++i) {
+    if (a[i] != b[i]) {
+      return i;
+    }
+  }
+  return len;
+}
+
+}  // namespace ppc::util
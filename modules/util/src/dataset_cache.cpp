@@ -0,0 +1,100 @@
+#include "util/include/dataset_cache.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <libenvpp/detail/get.hpp>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+
+#include "util/include/affinity.hpp"
+#include "util/include/mapped_file.hpp"
+#include "util/include/util.hpp"
+
+namespace ppc::util {
+
+namespace {
+
+constexpr std::array<char, 8> kDatasetMagic = {'P', 'P', 'C', 'D', 'S', 'E', 'T', '1'};
+
+// Magic, element size, element count and seed, zero-padded to kDatasetHeaderSize bytes
+std::array<char, kDatasetHeaderSize> MakeHeader(const DatasetKey &key, std::size_t element_size) {
+  std::array<char, kDatasetHeaderSize> header{};
+  const std::array<std::uint64_t, 3> fields = {element_size, key.size, key.seed};
+  std::memcpy(header.data(), kDatasetMagic.data(), kDatasetMagic.size());
+  std::memcpy(header.data() + kDatasetMagic.size(), fields.data(), sizeof(fields));
+  return header;
+}
+
+// Ranks the launcher starts on this node (Open MPI, MPICH/Hydra); 1 when not known
+int LocalRankCount() {
+  for (const std::string_view name : {"OMPI_COMM_WORLD_LOCAL_SIZE", "MPI_LOCALNRANKS"}) {
+    const auto local_size = env::get<int>(name);
+    if (local_size.has_value() && *local_size > 0) {
+      return *local_size;
+    }
+  }
+  return 1;
+}
+
+}  // namespace
+
+std::size_t GetDatasetGeneratorThreads() {
+  const auto hardware = static_cast<std::size_t>(std::max(std::thread::hardware_concurrency(), 1U));
+  const auto allowed = GetThreadAffinity().size();
+  const std::size_t share = hardware / static_cast<std::size_t>(LocalRankCount());
+  return std::max<std::size_t>(std::min(allowed > 0 ? allowed : hardware, share), 1);
+}
+
+std::string GetDatasetPath(const DatasetKey &key, std::size_t element_size) {
+  const auto file_name = key.task + "_n" + std::to_string(key.size) + "_s" + std::to_string(key.seed) + "_e" +
+                         std::to_string(element_size) + ".bin";
+  return (std::filesystem::path(GetDatasetCacheDir()) / file_name).string();
+}
+
+bool IsDatasetValid(const std::string &path, const DatasetKey &key, std::size_t element_size) {
+  std::error_code ec;
+  const auto file_size = std::filesystem::file_size(path, ec);
+  if (ec || file_size != kDatasetHeaderSize + (key.size * element_size)) {
+    return false;
+  }
+  const MappedFileRange header(path, 0, kDatasetHeaderSize);
+  const auto expected = MakeHeader(key, element_size);
+  return std::memcmp(header.View().data(), expected.data(), expected.size()) == 0;
+}
+
+void WriteDataset(const std::string &path, const DatasetKey &key, std::size_t element_size, const void *data,
+                  std::size_t bytes) {
+  const std::filesystem::path target(path);
+  std::filesystem::create_directories(target.parent_path());
+  // A random suffix keeps concurrent writers of the same dataset apart
+  const auto temp = target.string() + ".tmp" + std::to_string(std::random_device{}());
+  {
+    std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+      throw std::runtime_error("Failed to create dataset file " + temp);
+    }
+    const auto header = MakeHeader(key, element_size);
+    file.write(header.data(), static_cast<std::streamsize>(header.size()));
+    file.write(static_cast<const char *>(data), static_cast<std::streamsize>(bytes));
+    if (!file) {
+      throw std::runtime_error("Failed to write dataset file " + temp);
+    }
+  }
+  std::error_code ec;
+  std::filesystem::rename(temp, target, ec);
+  if (ec) {
+    std::filesystem::remove(temp, ec);
+    throw std::runtime_error("Failed to store dataset file " + path);
+  }
+}
+
+}  // namespace ppc::util
@@ -1,13 +1,128 @@
 #include <mpi.h>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <vector>
+
 #include "util/include/perf_test_util.hpp"
 
 double ppc::util::GetTimeMPI() {
   return MPI_Wtime();
 }
 
-int ppc::util::GetMPIRank() {
+int ppc::util::GetMPIRank(MPI_Comm comm) {
   int rank = -1;
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_rank(comm, &rank);
   return rank;
 }
+
+int ppc::util::GetMPISize(MPI_Comm comm) {
+  int size = 1;
+  MPI_Comm_size(comm, &size);
+  return size;
+}
+
+std::string ppc::util::GetProcessorName() {
+  std::string name(MPI_MAX_PROCESSOR_NAME, '\0');
+  int len = 0;
+  MPI_Get_processor_name(name.data(), &len);
+  name.resize(static_cast<std::size_t>(len));
+  return name;
+}
+
+bool ppc::util::AllProcessesAgree(bool value) {
+  int local = value ? 1 : 0;
+  int global = 0;
+  MPI_Allreduce(&local, &global, 1, MPI_INT, MPI_LAND, MPI_COMM_WORLD);
+  return global != 0;
+}
+
+ppc::performance::StageBreakdown ppc::util::AggregateStageTimings(const ppc::task::StageTimings &timings) {
+  ppc::performance::StageBreakdown breakdown;
+  const auto count = static_cast<int>(timings.size());
+  MPI_Allreduce(timings.data(), breakdown.min.data(), count, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+  MPI_Allreduce(timings.data(), breakdown.avg.data(), count, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(timings.data(), breakdown.max.data(), count, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+
+  const int size = GetMPISize();
+  for (std::size_t i = 0; i < breakdown.avg.size(); i++) {
+    breakdown.avg[i] /= static_cast<double>(size);
+  }
+  return breakdown;
+}
+
+ppc::performance::SampleBreakdown ppc::util::AggregateSampleTimes(const std::vector<double> &samples) {
+  ppc::performance::SampleBreakdown breakdown{
+      .min = std::vector<double>(samples.size()),
+      .avg = std::vector<double>(samples.size()),
+      .max = std::vector<double>(samples.size()),
+  };
+  const auto count = static_cast<int>(samples.size());
+  MPI_Allreduce(samples.data(), breakdown.min.data(), count, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+  MPI_Allreduce(samples.data(), breakdown.avg.data(), count, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(samples.data(), breakdown.max.data(), count, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+
+  const int size = GetMPISize();
+  for (auto &value : breakdown.avg) {
+    value /= static_cast<double>(size);
+  }
+  return breakdown;
+}
+
+ppc::performance::MemoryUsage ppc::util::AggregateMemoryUsage(const ppc::performance::MemorySample &sample) {
+  constexpr std::size_t kStages = std::tuple_size_v<ppc::task::StageTimings>;
+  // peak RSS, then the allocation counts and bytes of each stage
+  std::array<double, 1 + (2 * kStages)> local{};
+  local[0] = sample.peak_rss_bytes;
+  std::ranges::copy(sample.alloc_count, local.begin() + 1);
+  std::ranges::copy(sample.alloc_bytes, local.begin() + 1 + kStages);
+
+  std::array<double, local.size()> min{};
+  std::array<double, local.size()> sum{};
+  std::array<double, local.size()> max{};
+  const auto count = static_cast<int>(local.size());
+  MPI_Allreduce(local.data(), min.data(), count, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+  MPI_Allreduce(local.data(), sum.data(), count, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(local.data(), max.data(), count, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+
+  const auto size = static_cast<double>(GetMPISize());
+  ppc::performance::MemoryUsage memory;
+  memory.peak_rss_bytes = {.min = min[0], .avg = sum[0] / size, .max = max[0]};
+  for (std::size_t i = 0; i < kStages; i++) {
+    memory.alloc_count.min[i] = min[1 + i];
+    memory.alloc_count.avg[i] = sum[1 + i] / size;
+    memory.alloc_count.max[i] = max[1 + i];
+    memory.alloc_bytes.min[i] = min[1 + kStages + i];
+    memory.alloc_bytes.avg[i] = sum[1 + kStages + i] / size;
+    memory.alloc_bytes.max[i] = max[1 + kStages + i];
+  }
+  return memory;
+}
+
+std::vector<ppc::performance::CounterValues> ppc::util::GatherCounterValues(
+    const ppc::performance::CounterValues &local) {
+  constexpr auto kN = ppc::performance::kNumHardwareCounters;
+  // valid flags (as 0/1) followed by the values
+  std::array<double, 2 * kN> packed{};
+  for (std::size_t i = 0; i < kN; i++) {
+    packed[i] = local.valid[i] ? 1.0 : 0.0;
+    packed[kN + i] = local.values[i];
+  }
+  const int size = GetMPISize();
+  std::vector<double> all(packed.size() * static_cast<std::size_t>(size));
+  MPI_Allgather(packed.data(), static_cast<int>(packed.size()), MPI_DOUBLE, all.data(), static_cast<int>(packed.size()),
+                MPI_DOUBLE, MPI_COMM_WORLD);
+
+  std::vector<ppc::performance::CounterValues> result(static_cast<std::size_t>(size));
+  for (std::size_t rank = 0; rank < result.size(); rank++) {
+    const double *src = all.data() + (rank * packed.size());
+    for (std::size_t i = 0; i < kN; i++) {
+      result[rank].valid[i] = src[i] != 0.0;
+      result[rank].values[i] = src[kN + i];
+    }
+  }
+  return result;
+}
@@ -0,0 +1,98 @@
+#include "util/include/mapped_file.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <unistd.h>
+#  define PPC_HAS_MMAP 1
+#else
+#  include <fstream>
+#endif
+
+namespace ppc::util {
+
+std::uint64_t GetFileSize(const std::string &path) {
+  std::error_code ec;
+  const auto size = std::filesystem::file_size(path, ec);
+  if (ec) {
+    throw std::runtime_error("Failed to get size of " + path + ": " + ec.message());
+  }
+  return static_cast<std::uint64_t>(size);
+}
+
+MappedFile::MappedFile(std::string path) : path_(std::move(path)), size_(GetFileSize(path_)) {
+#ifdef PPC_HAS_MMAP
+  fd_ = open(path_.c_str(), O_RDONLY);
+  if (fd_ < 0) {
+    throw std::runtime_error("Failed to open " + path_);
+  }
+#endif
+}
+
+MappedFile::~MappedFile() {
+#ifdef PPC_HAS_MMAP
+  if (fd_ >= 0) {
+    close(fd_);
+  }
+#endif
+}
+
+MappedFileRange::MappedFileRange(const std::string &path, std::uint64_t offset, std::uint64_t length)
+    : MappedFileRange(MappedFile(path), offset, length) {}
+
+MappedFileRange::MappedFileRange(const MappedFile &file, std::uint64_t offset, std::uint64_t length) {
+  if (offset + length > file.Size()) {
+    throw std::runtime_error("Requested range is outside of " + file.Path());
+  }
+  if (length == 0) {
+    return;
+  }
+
+#ifdef PPC_HAS_MMAP
+  // mmap offsets must be page aligned: map from the enclosing page and skip the head.
+  const auto page = static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE));
+  const std::uint64_t aligned_offset = offset - (offset % page);
+  const std::uint64_t head = offset - aligned_offset;
+  mapping_size_ = static_cast<std::size_t>(head + length);
+  void *addr =
+      mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE, file.Descriptor(), static_cast<off_t>(aligned_offset));
+  if (addr == MAP_FAILED) {
+    mapping_size_ = 0;
+    throw std::runtime_error("Failed to map " + file.Path());
+  }
+  mapping_ = addr;
+  madvise(mapping_, mapping_size_, MADV_SEQUENTIAL);
+  view_ = std::string_view(static_cast<const char *>(mapping_) + head, static_cast<std::size_t>(length));
+#else
+  std::ifstream stream(file.Path(), std::ios::binary);
+  if (!stream.is_open()) {
+    throw std::runtime_error("Failed to open " + file.Path());
+  }
+  buffer_.resize(static_cast<std::size_t>(length));
+  stream.seekg(static_cast<std::streamoff>(offset));
+  stream.read(buffer_.data(), static_cast<std::streamsize>(length));
+  if (!stream) {
+    throw std::runtime_error("Failed to read " + file.Path());
+  }
+  view_ = buffer_;
+#endif
+}
+
+MappedFileRange::~MappedFileRange() {
+#ifdef PPC_HAS_MMAP
+  if (mapping_ != nullptr) {
+    munmap(mapping_, mapping_size_);
+  }
+#endif
+}
+
+}  // namespace ppc::util
@@ -0,0 +1,48 @@
+#include "util/include/memory_usage.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#if defined(__linux__) || defined(__APPLE__)
+#  include <sys/resource.h>
+#endif
+
+std::uint64_t ppc::util::GetPeakResidentBytes() {
+#ifdef __linux__
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.starts_with("VmHWM:")) {
+      std::istringstream fields(line.substr(6));
+      std::uint64_t kib = 0;
+      fields >> kib;
+      return kib * 1024;
+    }
+  }
+#endif
+#if defined(__linux__) || defined(__APPLE__)
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#  ifdef __APPLE__
+    return static_cast<std::uint64_t>(usage.ru_maxrss);
+#  else
+    return static_cast<std::uint64_t>(usage.ru_maxrss) * 1024;
+#  endif
+  }
+#endif
+  return 0;
+}
+
+bool ppc::util::ResetPeakResidentBytes() {
+#ifdef __linux__
+  // "5" resets VmHWM to the current RSS, see proc(5)
+  std::ofstream clear_refs("/proc/self/clear_refs");
+  clear_refs << "5";
+  clear_refs.flush();
+  return clear_refs.good();
+#else
+  return false;
+#endif
+}
@@ -0,0 +1,143 @@
+#include "util/include/partition.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ppc::util {
+
+namespace {
+
+void CheckPartition(std::int64_t n, int parts) {
+  if (n < 0) {
+    throw std::runtime_error("Cannot partition a negative number of items");
+  }
+  if (parts <= 0) {
+    throw std::runtime_error("Number of parts must be positive");
+  }
+}
+
+void CheckBlock(std::int64_t block) {
+  if (block <= 0) {
+    throw std::runtime_error("Block size must be positive");
+  }
+}
+
+int ToMpiInt(std::int64_t value) {
+  if (value > std::numeric_limits<int>::max()) {
+    throw std::runtime_error("MPI count " + std::to_string(value) + " does not fit in int");
+  }
+  return static_cast<int>(value);
+}
+
+}  // namespace
+
+std::vector<Range> BlockPartition(std::int64_t n, int parts) {
+  CheckPartition(n, parts);
+  std::vector<Range> ranges(static_cast<std::size_t>(parts));
+  for (int part = 0; part < parts; part++) {
+    ranges[static_cast<std::size_t>(part)] = BlockRange(n, parts, part);
+  }
+  return ranges;
+}
+
+Range BlockRange(std::int64_t n, int parts, int part) {
+  CheckPartition(n, parts);
+  const std::int64_t base = n / parts;
+  const std::int64_t extra = n % parts;
+  return {.begin = (part * base) + std::min<std::int64_t>(part, extra), .count = base + (part < extra ? 1 : 0)};
+}
+
+std::vector<Range> WeightedPartition(std::int64_t n, const std::vector<double> &weights) {
+  CheckPartition(n, static_cast<int>(weights.size()));
+  if (std::ranges::any_of(weights, [](double weight) { return !(weight >= 0.0) || std::isinf(weight); })) {
+    throw std::runtime_error("Partition weights must be finite and non-negative");
+  }
+  const double total = std::accumulate(weights.begin(), weights.end(), 0.0);
+  if (total <= 0.0) {
+    throw std::runtime_error("At least one partition weight must be positive");
+  }
+
+  // Largest remainder method: round every share down, then hand out the rest by the size of the dropped fraction
+  std::vector<std::int64_t> counts(weights.size());
+  std::vector<double> fractions(weights.size());
+  std::int64_t assigned = 0;
+  for (std::size_t i = 0; i < weights.size(); i++) {
+    const double share = static_cast<double>(n) * (weights[i] / total);
+    counts[i] = std::min(static_cast<std::int64_t>(std::floor(share)), n - assigned);
+    fractions[i] = share - static_cast<double>(counts[i]);
+    assigned += counts[i];
+  }
+  std::vector<std::size_t> order(weights.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::ranges::stable_sort(order, [&](std::size_t a, std::size_t b) { return fractions[a] > fractions[b]; });
+  for (std::size_t i = 0; assigned < n; i = (i + 1) % order.size()) {
+    if (weights[order[i]] > 0.0) {
+      counts[order[i]]++;
+      assigned++;
+    }
+  }
+
+  std::vector<Range> ranges(weights.size());
+  std::int64_t begin = 0;
+  for (std::size_t i = 0; i < ranges.size(); i++) {
+    ranges[i] = {.begin = begin, .count = counts[i]};
+    begin += counts[i];
+  }
+  return ranges;
+}
+
+int BlockCyclicOwner(std::int64_t index, std::int64_t block, int parts) {
+  return static_cast<int>((index / block) % parts);
+}
+
+std::int64_t BlockCyclicCount(std::int64_t n, std::int64_t block, int parts, int part) {
+  CheckPartition(n, parts);
+  CheckBlock(block);
+  const std::int64_t full_blocks = n / block;
+  // Whole blocks of this part, then its share of the trailing partial block
+  std::int64_t count = ((full_blocks / parts) + (part < full_blocks % parts ? 1 : 0)) * block;
+  if (BlockCyclicOwner(full_blocks * block, block, parts) == part) {
+    count += n % block;
+  }
+  return count;
+}
+
+std::vector<Range> BlockCyclicRanges(std::int64_t n, std::int64_t block, int parts, int part) {
+  CheckPartition(n, parts);
+  CheckBlock(block);
+  std::vector<Range> ranges;
+  for (std::int64_t begin = part * block; begin < n; begin += block * parts) {
+    ranges.push_back({.begin = begin, .count = std::min(block, n - begin)});
+  }
+  return ranges;
+}
+
+MpiCounts ToMpiCounts(const std::vector<Range> &parts, std::int64_t scale) {
+  MpiCounts result;
+  result.counts.reserve(parts.size());
+  result.displs.reserve(parts.size());
+  for (const auto &range : parts) {
+    result.counts.push_back(ToMpiInt(range.count * scale));
+    result.displs.push_back(ToMpiInt(range.begin * scale));
+  }
+  return result;
+}
+
+std::vector<double> GatherRankSpeeds(double local_speed, MPI_Comm comm) {
+  int size = 1;
+  MPI_Comm_size(comm, &size);
+  std::vector<double> speeds(static_cast<std::size_t>(size));
+  MPI_Allgather(&local_speed, 1, MPI_DOUBLE, speeds.data(), 1, MPI_DOUBLE, comm);
+  return speeds;
+}
+
+}  // namespace ppc::util
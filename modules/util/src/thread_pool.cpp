@@ -0,0 +1,107 @@
+#include "util/include/thread_pool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "util/include/affinity.hpp"
+#include "util/include/util.hpp"
+
+namespace ppc::util {
+
+namespace {
+
+// Pool and queue of the worker running on this thread, so that jobs it pushes stay in its own queue
+thread_local const ThreadPool *current_pool = nullptr;
+thread_local std::size_t current_queue = 0;
+
+}  // namespace
+
+ThreadPool::ThreadPool(int num_threads) {
+  const auto count = static_cast<std::size_t>(std::max(num_threads, 1));
+  queues_.reserve(count);
+  for (std::size_t i = 0; i < count; i++) {
+    queues_.push_back(std::make_unique<WorkerQueue>());
+  }
+  threads_.reserve(count);
+  for (std::size_t i = 0; i < count; i++) {
+    threads_.emplace_back([this, i] { WorkerLoop(i); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    const std::scoped_lock lock(sleep_mutex_);
+    stop_ = true;
+  }
+  wake_.notify_all();
+  threads_.clear();
+}
+
+ThreadPool &ThreadPool::Instance() {
+  static ThreadPool pool(GetNumThreads());
+  return pool;
+}
+
+void ThreadPool::Push(std::function<void()> job) {
+  const std::size_t index =
+      current_pool == this ? current_queue : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+  // Counted before the job becomes visible, so that a thief's decrement never comes first
+  queued_.fetch_add(1, std::memory_order_release);
+  {
+    const std::scoped_lock lock(queues_[index]->mutex);
+    queues_[index]->jobs.push_back(std::move(job));
+  }
+  {
+    // Taking the mutex orders the push before the check of a worker that is about to sleep
+    const std::scoped_lock lock(sleep_mutex_);
+  }
+  wake_.notify_one();
+}
+
+bool ThreadPool::RunPending() {
+  const std::size_t own = current_pool == this ? current_queue : 0;
+  std::function<void()> job;
+  for (std::size_t offset = 0; offset < queues_.size() && !job; offset++) {
+    auto &queue = *queues_[(own + offset) % queues_.size()];
+    const std::scoped_lock lock(queue.mutex);
+    if (queue.jobs.empty()) {
+      continue;
+    }
+    // Newest job of the own queue, oldest job of the others
+    if (offset == 0 && current_pool == this) {
+      job = std::move(queue.jobs.back());
+      queue.jobs.pop_back();
+    } else {
+      job = std::move(queue.jobs.front());
+      queue.jobs.pop_front();
+    }
+  }
+  if (!job) {
+    return false;
+  }
+  queued_.fetch_sub(1, std::memory_order_acq_rel);
+  job();
+  return true;
+}
+
+void ThreadPool::WorkerLoop(std::size_t index) {
+  current_pool = this;
+  current_queue = index;
+  PinThreadToSlot(static_cast<int>(index));
+  while (true) {
+    if (RunPending()) {
+      continue;
+    }
+    std::unique_lock lock(sleep_mutex_);
+    wake_.wait(lock, [this] { return stop_ || queued_.load(std::memory_order_acquire) > 0; });
+    if (stop_) {
+      return;
+    }
+  }
+}
+
+}  // namespace ppc::util
@@ -0,0 +1,212 @@
+#include "util/include/trace.hpp"
+
+#include <mpi.h>
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace ppc::util {
+
+namespace {
+
+constexpr int kClockRoundTrips = 8;
+constexpr int kClockTag = 0;
+
+}  // namespace
+
+class Tracer::BufferLease {
+ public:
+  BufferLease() = default;
+  ~BufferLease() {
+    if (buffer != nullptr) {
+      Tracer::Instance().Release(buffer);
+    }
+  }
+
+  BufferLease(const BufferLease &) = delete;
+  BufferLease &operator=(const BufferLease &) = delete;
+  BufferLease(BufferLease &&) = delete;
+  BufferLease &operator=(BufferLease &&) = delete;
+
+  ThreadBuffer *buffer = nullptr;
+};
+
+Tracer &Tracer::Instance() {
+  static Tracer instance;
+  return instance;
+}
+
+void Tracer::Start(int pid, double clock_shift_us) {
+  const std::scoped_lock lock(buffers_mutex_);
+  for (const auto &buffer : buffers_) {
+    buffer->size.store(0, std::memory_order_relaxed);
+    buffer->dropped.store(0, std::memory_order_relaxed);
+  }
+  pid_ = pid;
+  clock_shift_us_ = clock_shift_us;
+  enabled_.store(true, std::memory_order_release);
+}
+
+void Tracer::Stop() {
+  enabled_.store(false, std::memory_order_release);
+}
+
+double Tracer::NowUs() {
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Tracer::Record(const char *name, const char *category, double begin_us) {
+  if (!enabled_.load(std::memory_order_acquire)) {
+    return;
+  }
+  const double end_us = NowUs();
+  auto &buffer = LocalBuffer();
+  // Only this thread appends to the buffer; the release store publishes the event to Write()
+  const std::size_t index = buffer.size.load(std::memory_order_relaxed);
+  if (index >= buffer.events.size()) {
+    buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  buffer.events[index] = {
+      .name = name, .category = category, .begin_us = begin_us + clock_shift_us_, .duration_us = end_us - begin_us};
+  buffer.size.store(index + 1, std::memory_order_release);
+}
+
+Tracer::ThreadBuffer &Tracer::LocalBuffer() {
+  thread_local BufferLease lease;
+  if (lease.buffer == nullptr) {
+    const std::scoped_lock lock(buffers_mutex_);
+    if (!free_buffers_.empty()) {
+      lease.buffer = free_buffers_.back();
+      free_buffers_.pop_back();
+    } else {
+      buffers_.push_back(std::make_unique<ThreadBuffer>());
+      buffers_.back()->tid = static_cast<int>(buffers_.size() - 1);
+      lease.buffer = buffers_.back().get();
+    }
+  }
+  return *lease.buffer;
+}
+
+void Tracer::Release(ThreadBuffer *buffer) {
+  const std::scoped_lock lock(buffers_mutex_);
+  free_buffers_.push_back(buffer);
+}
+
+void Tracer::Write(std::ostream &out) const {
+  const std::scoped_lock lock(buffers_mutex_);
+  std::size_t dropped = 0;
+  out << std::fixed << std::setprecision(3);
+  out << R"({"displayTimeUnit":"ms","traceEvents":[)";
+  out << R"({"name":"process_name","ph":"M","pid":)" << pid_ << R"(,"tid":0,"args":{"name":"rank )" << pid_
+      << R"("}})";
+  for (const auto &buffer : buffers_) {
+    dropped += buffer->dropped.load(std::memory_order_relaxed);
+    const std::size_t size = buffer->size.load(std::memory_order_acquire);
+    if (size == 0) {
+      continue;
+    }
+    out << R"(,{"name":"thread_name","ph":"M","pid":)" << pid_ << R"(,"tid":)" << buffer->tid
+        << R"(,"args":{"name":"thread )" << buffer->tid << R"("}})";
+    for (std::size_t i = 0; i < size; i++) {
+      const auto &event = buffer->events[i];
+      out << R"(,{"name":)" << nlohmann::json(event.name).dump() << R"(,"cat":)"
+          << nlohmann::json(event.category).dump() << R"(,"ph":"X","ts":)" << event.begin_us << R"(,"dur":)"
+          << event.duration_us << R"(,"pid":)" << pid_ << R"(,"tid":)" << buffer->tid << '}';
+    }
+  }
+  out << R"(],"otherData":{"dropped_events":)" << dropped << "}}\n";
+}
+
+std::size_t Tracer::NumEvents() const {
+  const std::scoped_lock lock(buffers_mutex_);
+  std::size_t count = 0;
+  for (const auto &buffer : buffers_) {
+    count += buffer->size.load(std::memory_order_acquire);
+  }
+  return count;
+}
+
+std::size_t Tracer::NumDropped() const {
+  const std::scoped_lock lock(buffers_mutex_);
+  std::size_t count = 0;
+  for (const auto &buffer : buffers_) {
+    count += buffer->dropped.load(std::memory_order_relaxed);
+  }
+  return count;
+}
+
+double EstimateClockOffsetUs(MPI_Comm comm) {
+  // A private copy of the communicator keeps the ping-pong apart from any other traffic
+  MPI_Comm clock_comm = MPI_COMM_NULL;
+  MPI_Comm_dup(comm, &clock_comm);
+  int rank = 0;
+  int size = 1;
+  MPI_Comm_rank(clock_comm, &rank);
+  MPI_Comm_size(clock_comm, &size);
+
+  double offset_us = 0.0;
+  for (int peer = 1; peer < size; peer++) {
+    if (rank == 0) {
+      for (int i = 0; i < kClockRoundTrips; i++) {
+        MPI_Recv(nullptr, 0, MPI_BYTE, peer, kClockTag, clock_comm, MPI_STATUS_IGNORE);
+        const double root_now_us = Tracer::NowUs();
+        MPI_Send(&root_now_us, 1, MPI_DOUBLE, peer, kClockTag, clock_comm);
+      }
+    } else if (rank == peer) {
+      double best_round_trip_us = std::numeric_limits<double>::infinity();
+      for (int i = 0; i < kClockRoundTrips; i++) {
+        const double send_us = Tracer::NowUs();
+        MPI_Send(nullptr, 0, MPI_BYTE, 0, kClockTag, clock_comm);
+        double root_now_us = 0.0;
+        MPI_Recv(&root_now_us, 1, MPI_DOUBLE, 0, kClockTag, clock_comm, MPI_STATUS_IGNORE);
+        const double receive_us = Tracer::NowUs();
+        // The root read its clock about halfway through the round trip
+        if (receive_us - send_us < best_round_trip_us) {
+          best_round_trip_us = receive_us - send_us;
+          offset_us = root_now_us - ((send_us + receive_us) / 2.0);
+        }
+      }
+    }
+  }
+  MPI_Comm_free(&clock_comm);
+  return offset_us;
+}
+
+void StartTracing(MPI_Comm comm) {
+  const double offset_us = EstimateClockOffsetUs(comm);
+  int rank = 0;
+  MPI_Comm_rank(comm, &rank);
+  // Timestamps count from the moment rank 0 starts tracing
+  double origin_us = Tracer::NowUs();
+  MPI_Bcast(&origin_us, 1, MPI_DOUBLE, 0, comm);
+  Tracer::Instance().Start(rank, offset_us - origin_us);
+}
+
+void FinishTracing(const std::string &dir, MPI_Comm comm) {
+  auto &tracer = Tracer::Instance();
+  tracer.Stop();
+  int rank = 0;
+  MPI_Comm_rank(comm, &rank);
+  std::error_code ec;
+  std::filesystem::create_directories(dir, ec);
+  const auto path = std::filesystem::path(dir) / ("trace_rank" + std::to_string(rank) + ".json");
+  std::ofstream file(path);
+  if (!file.is_open()) {
+    throw std::runtime_error("Failed to open trace file " + path.string());
+  }
+  tracer.Write(file);
+}
+
+}  // namespace ppc::util
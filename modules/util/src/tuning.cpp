@@ -0,0 +1,175 @@
+#include "util/include/tuning.hpp"
+
+#include <bit>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#include "util/include/util.hpp"
+
+namespace ppc::util {
+
+namespace {
+
+std::string ProcKey(int num_proc) {
+  return "p" + std::to_string(num_proc);
+}
+
+std::string BucketKey(std::uint64_t size) {
+  return "b" + std::to_string(SizeBucket(size));
+}
+
+// Configurations tried by the autotuner, by task, and the cache file read by GetTunedValue()
+std::mutex tuning_mutex;
+std::map<std::string, TuneConfig, std::less<>> overrides;
+std::unique_ptr<TuningCache> loaded_cache;
+bool cache_load_failed = false;
+
+}  // namespace
+
+int SizeBucket(std::uint64_t size) {
+  return size < 2 ? 0 : static_cast<int>(std::bit_width(size)) - 1;
+}
+
+TuningCache::TuningCache(std::filesystem::path path) : path_(std::move(path)) {
+  std::error_code ec;
+  if (!std::filesystem::exists(path_, ec)) {
+    return;
+  }
+  std::ifstream file(path_);
+  if (!file.is_open()) {
+    throw std::runtime_error("Failed to open tuning cache " + path_.string());
+  }
+  try {
+    data_ = nlohmann::json::parse(file);
+  } catch (const nlohmann::json::parse_error &e) {
+    throw std::runtime_error("Malformed tuning cache " + path_.string() + ": " + e.what());
+  }
+  if (!data_.is_object()) {
+    throw std::runtime_error("Tuning cache " + path_.string() + " must hold a JSON object");
+  }
+}
+
+const nlohmann::json *TuningCache::Entry(std::string_view task, std::uint64_t size, int num_proc) const {
+  const nlohmann::json *node = &data_;
+  for (const std::string &key : {std::string(task), ProcKey(num_proc), BucketKey(size)}) {
+    const auto it = node->find(key);
+    if (it == node->end() || !it->is_object()) {
+      return nullptr;
+    }
+    node = &*it;
+  }
+  return node;
+}
+
+std::optional<TuneConfig> TuningCache::Find(std::string_view task, std::uint64_t size, int num_proc) const {
+  const auto *entry = Entry(task, size, num_proc);
+  if (entry == nullptr || !entry->contains("config")) {
+    return std::nullopt;
+  }
+  try {
+    return entry->at("config").get<TuneConfig>();
+  } catch (const nlohmann::json::exception &) {
+    return std::nullopt;
+  }
+}
+
+std::optional<double> TuningCache::FindTime(std::string_view task, std::uint64_t size, int num_proc) const {
+  const auto *entry = Entry(task, size, num_proc);
+  if (entry == nullptr || !entry->contains("time_sec") || !entry->at("time_sec").is_number()) {
+    return std::nullopt;
+  }
+  return entry->at("time_sec").get<double>();
+}
+
+void TuningCache::Store(std::string_view task, std::uint64_t size, int num_proc, const TuneConfig &config,
+                        double time_sec) {
+  data_[std::string(task)][ProcKey(num_proc)][BucketKey(size)] = {{"config", config}, {"time_sec", time_sec}};
+}
+
+void TuningCache::Save() const {
+  if (path_.has_parent_path()) {
+    std::filesystem::create_directories(path_.parent_path());
+  }
+  // A random suffix keeps concurrent writers apart, the rename makes the new cache appear at once
+  const auto temp = path_.string() + ".tmp" + std::to_string(std::random_device{}());
+  {
+    std::ofstream file(temp, std::ios::trunc);
+    if (!file.is_open()) {
+      throw std::runtime_error("Failed to create tuning cache " + temp);
+    }
+    file << data_.dump(2) << '\n';
+    if (!file) {
+      throw std::runtime_error("Failed to write tuning cache " + temp);
+    }
+  }
+  std::error_code ec;
+  std::filesystem::rename(temp, path_, ec);
+  if (ec) {
+    std::filesystem::remove(temp, ec);
+    throw std::runtime_error("Failed to store tuning cache " + path_.string());
+  }
+}
+
+std::int64_t GetTunedValue(std::string_view task, std::string_view name, std::uint64_t size, int num_proc,
+                           std::int64_t fallback) {
+  const std::scoped_lock lock(tuning_mutex);
+  std::optional<TuneConfig> config;
+  if (const auto it = overrides.find(task); it != overrides.end()) {
+    config = it->second;
+  } else {
+    if (!loaded_cache && !cache_load_failed) {
+      try {
+        loaded_cache = std::make_unique<TuningCache>(GetTuningCacheFile());
+      } catch (const std::exception &) {
+        // Tuning is an optimization: a broken cache leaves the tasks on their defaults
+        cache_load_failed = true;
+      }
+    }
+    if (loaded_cache) {
+      config = loaded_cache->Find(task, size, num_proc);
+    }
+  }
+  if (!config) {
+    return fallback;
+  }
+  const auto value = config->find(std::string(name));
+  return value == config->end() ? fallback : value->second;
+}
+
+void ReloadTuningCache() {
+  const std::scoped_lock lock(tuning_mutex);
+  loaded_cache.reset();
+  cache_load_failed = false;
+}
+
+ScopedTuneConfig::ScopedTuneConfig(std::string task, TuneConfig config) : task_(std::move(task)) {
+  const std::scoped_lock lock(tuning_mutex);
+  if (const auto it = overrides.find(task_); it != overrides.end()) {
+    previous_ = std::move(it->second);
+  }
+  overrides[task_] = std::move(config);
+}
+
+ScopedTuneConfig::~ScopedTuneConfig() {
+  const std::scoped_lock lock(tuning_mutex);
+  if (previous_) {
+    overrides[task_] = std::move(*previous_);
+  } else {
+    overrides.erase(task_);
+  }
+}
+
+}  // namespace ppc::util
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <array>
 #include <filesystem>
+#include <initializer_list>
 #include <libenvpp/detail/get.hpp>
 #include <string>
 
@@ -52,6 +53,103 @@ double ppc::util::GetPerfMaxTime() {
   return 10.0;
 }
 
+int ppc::util::GetPerfWarmupRuns() {
+  const auto val = env::get<int>("PPC_PERF_WARMUP");
+  if (val.has_value()) {
+    return val.value();
+  }
+  return 1;
+}
+
+double ppc::util::GetPerfTargetCi() {
+  const auto val = env::get<double>("PPC_PERF_TARGET_CI");
+  if (val.has_value()) {
+    return val.value();
+  }
+  return 0.0;
+}
+
+std::string ppc::util::GetPerfResultsFile() {
+  const auto val = env::get<std::string>("PPC_PERF_RESULTS_FILE");
+  if (val.has_value()) {
+    return val.value();
+  }
+  return {};
+}
+
+bool ppc::util::IsPerfCountersEnabled() {
+  const auto val = env::get<int>("PPC_PERF_COUNTERS");
+  return val.has_value() && val.value() != 0;
+}
+
+bool ppc::util::IsAutotuneEnabled() {
+  const auto val = env::get<int>("PPC_AUTOTUNE");
+  return val.has_value() && val.value() != 0;
+}
+
+bool ppc::util::IsThreadReleaseEnabled() {
+  const auto val = env::get<int>("PPC_RELEASE_THREADS");
+  return val.has_value() && val.value() != 0;
+}
+
+int ppc::util::GetPerfProblemScale() {
+  const auto val = env::get<int>("PPC_PERF_PROBLEM_SCALE");
+  if (val.has_value()) {
+    return val.value();
+  }
+  return 1;
+}
+
+int ppc::util::GetMpiProfileTop() {
+  const auto val = env::get<int>("PPC_MPI_PROFILE");
+  if (val.has_value()) {
+    return val.value();
+  }
+  return 0;
+}
+
+std::string ppc::util::GetGitCommit() {
+  for (const auto *name : {"PPC_GIT_SHA", "GITHUB_SHA"}) {
+    const auto val = env::get<std::string>(name);
+    if (val.has_value() && !val.value().empty()) {
+      return val.value();
+    }
+  }
+  return "unknown";
+}
+
+std::string ppc::util::GetDatasetCacheDir() {
+  const auto val = env::get<std::string>("PPC_DATASET_CACHE_DIR");
+  if (val.has_value() && !val.value().empty()) {
+    return val.value();
+  }
+  return (std::filesystem::path(PPC_PATH_TO_PROJECT) / "build" / "dataset_cache").string();
+}
+
+std::string ppc::util::GetTraceDir() {
+  const auto val = env::get<std::string>("PPC_TRACE_DIR");
+  if (val.has_value()) {
+    return val.value();
+  }
+  return {};
+}
+
+std::string ppc::util::GetTuningCacheFile() {
+  const auto val = env::get<std::string>("PPC_TUNING_CACHE");
+  if (val.has_value() && !val.value().empty()) {
+    return val.value();
+  }
+  return (std::filesystem::path(PPC_PATH_TO_PROJECT) / "build" / "tuning_cache.json").string();
+}
+
+std::string ppc::util::GetPinPolicy() {
+  const auto val = env::get<std::string>("PPC_PIN");
+  if (val.has_value()) {
+    return val.value();
+  }
+  return {};
+}
+
 // List of environment variables that signal the application is running under
 // an MPI launcher. The array size must match the number of entries to avoid
 // looking up empty environment variable names.
@@ -0,0 +1,121 @@
+#include "util/include/affinity.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "util/include/first_touch.hpp"
+
+namespace {
+
+// Two NUMA nodes with one package of two cores each, two hardware threads per core, numbered like Linux does:
+// the second hardware threads of all cores come after the first ones. cpu8 is offline.
+class FakeSysfs : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::filesystem::remove_all(root_);
+    for (int cpu = 0; cpu <= 8; cpu++) {
+      const auto dir = root_ / "cpu" / ("cpu" + std::to_string(cpu));
+      std::filesystem::create_directories(dir / "topology");
+      Write(dir / "topology" / "core_id", std::to_string(cpu % 2));
+      Write(dir / "topology" / "physical_package_id", std::to_string((cpu / 2) % 2));
+      if (cpu == 8) {
+        Write(dir / "online", "0");
+      }
+    }
+    std::filesystem::create_directories(root_ / "node" / "node0");
+    std::filesystem::create_directories(root_ / "node" / "node1");
+    Write(root_ / "node" / "node0" / "cpulist", "0-1,4-5\n");
+    Write(root_ / "node" / "node1" / "cpulist", "2-3,6-7\n");
+  }
+  void TearDown() override {
+    std::filesystem::remove_all(root_);
+  }
+
+  static void Write(const std::filesystem::path &path, const std::string &text) {
+    std::ofstream(path) << text;
+  }
+
+  std::filesystem::path root_ = std::filesystem::temp_directory_path() / "ppc_affinity_test";
+};
+
+}  // namespace
+
+TEST(Affinity, ParsesCpuListsAndPolicies) {
+  EXPECT_EQ(ppc::util::ParseCpuList("0-2,5,7-8\n"), (std::vector<int>{0, 1, 2, 5, 7, 8}));
+  EXPECT_TRUE(ppc::util::ParseCpuList("").empty());
+  EXPECT_THROW((void)ppc::util::ParseCpuList("3-1"), std::runtime_error);
+  EXPECT_THROW((void)ppc::util::ParseCpuList("a"), std::runtime_error);
+
+  EXPECT_EQ(ppc::util::ParsePinPolicy(""), ppc::util::PinPolicy::kNone);
+  EXPECT_EQ(ppc::util::ParsePinPolicy("compact"), ppc::util::PinPolicy::kCompact);
+  EXPECT_EQ(ppc::util::ParsePinPolicy("scatter"), ppc::util::PinPolicy::kScatter);
+  EXPECT_THROW((void)ppc::util::ParsePinPolicy("spread"), std::runtime_error);
+}
+
+TEST_F(FakeSysfs, TopologyComesFromSysfs) {
+  const auto cpus = ppc::util::ReadCpuTopology(root_);
+  ASSERT_EQ(cpus.size(), 8U);
+  EXPECT_EQ(cpus[6].cpu, 6);
+  EXPECT_EQ(cpus[6].core, 0);
+  EXPECT_EQ(cpus[6].package, 1);
+  EXPECT_EQ(cpus[6].node, 1);
+  EXPECT_EQ(cpus[4].node, 0);
+  EXPECT_TRUE(ppc::util::ReadCpuTopology(root_ / "missing").empty());
+}
+
+TEST_F(FakeSysfs, CompactKeepsRanksOnNeighbouringCores) {
+  const auto cpus = ppc::util::ReadCpuTopology(root_);
+  EXPECT_EQ(ppc::util::RankCpus(cpus, ppc::util::PinPolicy::kCompact, 0, 2), (std::vector<int>{0, 4, 1, 5}));
+  EXPECT_EQ(ppc::util::RankCpus(cpus, ppc::util::PinPolicy::kCompact, 1, 2), (std::vector<int>{2, 6, 3, 7}));
+  EXPECT_EQ(ppc::util::RankCpus(cpus, ppc::util::PinPolicy::kCompact, 1, 4), (std::vector<int>{1, 5}));
+  // More ranks than CPUs share them
+  EXPECT_EQ(ppc::util::RankCpus(cpus, ppc::util::PinPolicy::kCompact, 9, 10), (std::vector<int>{4}));
+  EXPECT_TRUE(ppc::util::RankCpus(cpus, ppc::util::PinPolicy::kNone, 0, 2).empty());
+}
+
+TEST_F(FakeSysfs, ScatterDealsRanksOverNodes) {
+  const auto cpus = ppc::util::ReadCpuTopology(root_);
+  EXPECT_EQ(ppc::util::RankCpus(cpus, ppc::util::PinPolicy::kScatter, 0, 2), (std::vector<int>{0, 1, 4, 5}));
+  EXPECT_EQ(ppc::util::RankCpus(cpus, ppc::util::PinPolicy::kScatter, 1, 2), (std::vector<int>{2, 3, 6, 7}));
+  EXPECT_EQ(ppc::util::RankCpus(cpus, ppc::util::PinPolicy::kScatter, 1, 4), (std::vector<int>{2, 6}));
+  EXPECT_EQ(ppc::util::RankCpus(cpus, ppc::util::PinPolicy::kScatter, 2, 4), (std::vector<int>{1, 5}));
+  EXPECT_EQ(ppc::util::RankCpus(cpus, ppc::util::PinPolicy::kScatter, 2, 3), (std::vector<int>{1, 5}));
+}
+
+#ifdef __linux__
+TEST(Affinity, PinsWorkerThreadsToTheirSlot) {
+  const auto allowed = ppc::util::GetThreadAffinity();
+  ASSERT_FALSE(allowed.empty());
+  ppc::util::SetThreadPlacement({allowed.back()});
+  std::vector<int> pinned;
+  std::jthread([&pinned] {
+    ppc::util::PinThreadToSlot(3);
+    pinned = ppc::util::GetThreadAffinity();
+  }).join();
+  ppc::util::SetThreadPlacement({});
+  EXPECT_EQ(pinned, (std::vector<int>{allowed.back()}));
+  EXPECT_EQ(ppc::util::GetThreadAffinity(), allowed);
+}
+#endif
+
+TEST(FirstTouch, VectorIsFilledAndPageAligned) {
+  const auto data = ppc::util::MakeFirstTouchVector<double>(1001, 2.5, 7, 3);
+  ASSERT_EQ(data.size(), 1001U);
+  for (const double value : data) {
+    ASSERT_EQ(value, 2.5);
+  }
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(data.data()) % ppc::util::FirstTouchAllocator<double>::kPageSize, 0U);
+  EXPECT_TRUE(ppc::util::MakeFirstTouchVector<int>(0).empty());
+
+  ppc::util::FirstTouchVector<int> grown;
+  grown.resize(5000, 1);
+  EXPECT_EQ(grown.back(), 1);
+}
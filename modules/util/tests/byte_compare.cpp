@@ -0,0 +1,59 @@
+#include "util/include/byte_compare.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+
+namespace {
+
+std::string MakePattern(std::size_t size) {
+  std::string content(size, '\0');
+  for (std::size_t i = 0; i < size; ++i) {
+    content[i] = static_cast<char>('a' + (i % 26));
+  }
+  return content;
+}
+
+}  // namespace
+
+TEST(ByteCompare, EqualStringsHaveNoMismatches) {
+  const std::string s = MakePattern(1000);
+  EXPECT_EQ(ppc::util::CountMismatches(s, s), 0U);
+  EXPECT_EQ(ppc::util::FindFirstMismatch(s, s), s.size());
+}
+
+TEST(ByteCompare, EmptyViews) {
+  EXPECT_EQ(ppc::util::CountMismatches("", "abc"), 0U);
+  EXPECT_EQ(ppc::util::FindFirstMismatch("", "abc"), 0U);
+}
+
+TEST(ByteCompare, OnlyCommonPrefixIsCompared) {
+  const std::string a = MakePattern(70);
+  std::string b = a + "tail";
+  b[3] = '#';
+  EXPECT_EQ(ppc::util::CountMismatches(a, b), 1U);
+  EXPECT_EQ(ppc::util::FindFirstMismatch(b, a), 3U);
+}
+
+TEST(ByteCompare, MatchesScalarReferenceAtEveryLength) {
+  for (std::size_t len = 0; len <= 200; ++len) {
+    const std::string a = MakePattern(len);
+    std::string b = a;
+    for (std::size_t i = len / 3; i < len; i += 7) {
+      b[i] = static_cast<char>(~b[i]);
+    }
+
+    std::size_t expected_count = 0;
+    std::size_t expected_first = len;
+    for (std::size_t i = 0; i < len; ++i) {
+      if (a[i] != b[i]) {
+        ++expected_count;
+        expected_first = std::min(expected_first, i);
+      }
+    }
+    EXPECT_EQ(ppc::util::CountMismatches(a, b), expected_count) << "len = " << len;
+    EXPECT_EQ(ppc::util::FindFirstMismatch(a, b), expected_first) << "len = " << len;
+  }
+}
@@ -0,0 +1,92 @@
+#include "util/include/dataset_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <libenvpp/detail/environment.hpp>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+class DatasetCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::filesystem::remove_all(cache_dir_);
+  }
+  void TearDown() override {
+    std::filesystem::remove_all(cache_dir_);
+  }
+
+  std::filesystem::path cache_dir_ = std::filesystem::temp_directory_path() / "ppc_dataset_cache_test";
+  env::detail::set_scoped_environment_variable scoped_dir_{"PPC_DATASET_CACHE_DIR", cache_dir_.string()};
+};
+
+}  // namespace
+
+TEST_F(DatasetCacheTest, GeneratesOnceAndMapsLater) {
+  std::atomic<int> calls{0};
+  auto generate = [&calls](std::span<std::int64_t> chunk, std::size_t first) {
+    calls++;
+    for (std::size_t i = 0; i < chunk.size(); i++) {
+      chunk[i] = static_cast<std::int64_t>((first + i) * 3);
+    }
+  };
+  const ppc::util::DatasetKey key{.task = "dataset_test", .size = 1000, .seed = 7};
+
+  const auto first = ppc::util::LoadOrGenerateDataset<std::int64_t>(key, generate, 100);
+  EXPECT_EQ(calls.load(), 10);
+  const auto second = ppc::util::LoadOrGenerateDataset<std::int64_t>(key, generate, 100);
+  EXPECT_EQ(calls.load(), 10);
+
+  const auto values = second.ToVector();
+  ASSERT_EQ(values.size(), 1000U);
+  EXPECT_EQ(values[0], 0);
+  EXPECT_EQ(values[999], 2997);
+  EXPECT_EQ(first.View()[500], 1500);
+}
+
+TEST_F(DatasetCacheTest, RegeneratesTruncatedFile) {
+  const ppc::util::DatasetKey key{.task = "dataset_test", .size = 16, .seed = 1};
+  auto fill = [](std::span<int> chunk, std::size_t first) {
+    for (std::size_t i = 0; i < chunk.size(); i++) {
+      chunk[i] = static_cast<int>(first + i);
+    }
+  };
+  static_cast<void>(ppc::util::LoadOrGenerateDataset<int>(key, fill));
+  const auto path = ppc::util::GetDatasetPath(key, sizeof(int));
+  ASSERT_TRUE(ppc::util::IsDatasetValid(path, key, sizeof(int)));
+
+  std::filesystem::resize_file(path, ppc::util::kDatasetHeaderSize + 4);
+  EXPECT_FALSE(ppc::util::IsDatasetValid(path, key, sizeof(int)));
+  EXPECT_EQ(ppc::util::LoadOrGenerateDataset<int>(key, fill).View()[15], 15);
+}
+
+TEST_F(DatasetCacheTest, KeyChangesFileName) {
+  const ppc::util::DatasetKey key{.task = "dataset_test", .size = 16, .seed = 1};
+  auto other_seed = key;
+  other_seed.seed = 2;
+  EXPECT_NE(ppc::util::GetDatasetPath(key, sizeof(int)), ppc::util::GetDatasetPath(other_seed, sizeof(int)));
+  EXPECT_NE(ppc::util::GetDatasetPath(key, sizeof(int)), ppc::util::GetDatasetPath(key, sizeof(double)));
+}
+
+TEST(DatasetGeneratorThreads, ShareTheNodeBetweenItsRanks) {
+  const auto hardware = static_cast<std::size_t>(std::max(std::thread::hardware_concurrency(), 1U));
+  EXPECT_GE(ppc::util::GetDatasetGeneratorThreads(), 1U);
+  EXPECT_LE(ppc::util::GetDatasetGeneratorThreads(), hardware);
+  const env::detail::set_scoped_environment_variable local_size("OMPI_COMM_WORLD_LOCAL_SIZE",
+                                                                std::to_string(hardware * 2));
+  EXPECT_EQ(ppc::util::GetDatasetGeneratorThreads(), 1U);
+}
+
+TEST(DatasetChunkSeed, DependsOnSeedAndIndex) {
+  EXPECT_EQ(ppc::util::DatasetChunkSeed(42, 0), ppc::util::DatasetChunkSeed(42, 0));
+  EXPECT_NE(ppc::util::DatasetChunkSeed(42, 0), ppc::util::DatasetChunkSeed(42, 65536));
+  EXPECT_NE(ppc::util::DatasetChunkSeed(42, 0), ppc::util::DatasetChunkSeed(43, 0));
+}
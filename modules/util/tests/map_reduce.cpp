@@ -0,0 +1,111 @@
+#include "util/include/map_reduce.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace {
+
+struct SumKernel {
+  using Value = std::int64_t;
+  static Value Identity() {
+    return 0;
+  }
+  static Value Map(int x) {
+    return x;
+  }
+  static Value Combine(Value a, Value b) {
+    return a + b;
+  }
+};
+
+struct MinKernel {
+  using Value = double;
+  static Value Identity() {
+    return std::numeric_limits<double>::infinity();
+  }
+  static Value Map(double x) {
+    return x;
+  }
+  static Value Combine(Value a, Value b) {
+    return std::min(a, b);
+  }
+};
+
+struct DescentKernel {
+  using Value = int;
+  static Value Identity() {
+    return 0;
+  }
+  static Value Map(int current, int next) {
+    return next < current ? 1 : 0;
+  }
+  static Value Combine(Value a, Value b) {
+    return a + b;
+  }
+};
+
+// Last non-zero element: associative, but the order of the elements matters
+struct LastNonZeroKernel {
+  using Value = int;
+  static constexpr bool kCommutative = false;
+  static Value Identity() {
+    return 0;
+  }
+  static Value Map(int x) {
+    return x;
+  }
+  static Value Combine(Value a, Value b) {
+    return b != 0 ? b : a;
+  }
+};
+
+}  // namespace
+
+TEST(MapReduce, LocalReductionCoversLanesAndTail) {
+  for (std::size_t n : {0U, 1U, 15U, 16U, 17U, 100U}) {
+    std::vector<int> data(n);
+    std::int64_t expected = 0;
+    for (std::size_t i = 0; i < n; i++) {
+      data[i] = static_cast<int>(i * 7 % 11) - 5;
+      expected += data[i];
+    }
+    EXPECT_EQ(ppc::util::MapReduceLocal<SumKernel>(data.data(), n), expected) << "n = " << n;
+  }
+}
+
+TEST(MapReduce, EmptyInputGivesTheIdentity) {
+  const std::vector<double> data;
+  EXPECT_EQ(ppc::util::MapReduceLocal<MinKernel>(data.data(), 0), MinKernel::Identity());
+  EXPECT_EQ(ppc::util::MapReducePairsLocal<DescentKernel>(data.data(), 0), 0);
+}
+
+TEST(MapReduce, LocalMinFindsTheSmallestValue) {
+  std::vector<double> data(37, 2.5);
+  data[36] = -1.0;
+  EXPECT_EQ(ppc::util::MapReduceLocal<MinKernel>(data.data(), data.size()), -1.0);
+}
+
+TEST(MapReduce, PairsSpanLaneBoundaries) {
+  std::vector<int> data(50);
+  for (std::size_t i = 0; i < data.size(); i++) {
+    data[i] = static_cast<int>(i % 3);
+  }
+  int expected = 0;
+  for (std::size_t i = 0; i + 1 < data.size(); i++) {
+    expected += data[i + 1] < data[i] ? 1 : 0;
+  }
+  EXPECT_EQ(ppc::util::MapReducePairsLocal<DescentKernel>(data.data(), data.size()), expected);
+  EXPECT_EQ(ppc::util::MapReducePairsLocal<DescentKernel>(data.data(), 1), 0);
+}
+
+TEST(MapReduce, NonCommutativeKernelKeepsTheOrder) {
+  std::vector<int> data(40);
+  data[3] = 4;
+  data[21] = 9;
+  EXPECT_EQ(ppc::util::MapReduceLocal<LastNonZeroKernel>(data.data(), data.size()), 9);
+}
@@ -0,0 +1,91 @@
+#include "util/include/mapped_file.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace {
+
+std::string WriteTempFile(const std::string &name, const std::string &content) {
+  const auto path = std::filesystem::temp_directory_path() / name;
+  std::ofstream file(path, std::ios::binary);
+  file << content;
+  return path.string();
+}
+
+std::string MakePattern(std::size_t size) {
+  std::string content(size, '\0');
+  for (std::size_t i = 0; i < size; ++i) {
+    content[i] = static_cast<char>('a' + (i % 26));
+  }
+  return content;
+}
+
+}  // namespace
+
+TEST(MappedFileRange, MapsUnalignedRange) {
+  const std::string content = MakePattern(10000);
+  const auto path = WriteTempFile("ppc_mapped_file_unaligned.txt", content);
+
+  const ppc::util::MappedFileRange range(path, 4097, 1234);
+  EXPECT_EQ(range.View(), std::string_view(content).substr(4097, 1234));
+  std::filesystem::remove(path);
+}
+
+TEST(MappedFileRange, EmptyRangeIsEmptyView) {
+  const auto path = WriteTempFile("ppc_mapped_file_empty.txt", "abc");
+
+  const ppc::util::MappedFileRange range(path, 3, 0);
+  EXPECT_TRUE(range.View().empty());
+  std::filesystem::remove(path);
+}
+
+TEST(MappedFileRange, ThrowsOnRangeOutsideFile) {
+  const auto path = WriteTempFile("ppc_mapped_file_outside.txt", "abc");
+
+  EXPECT_THROW(ppc::util::MappedFileRange(path, 2, 2), std::runtime_error);
+  std::filesystem::remove(path);
+}
+
+TEST(MappedFileRange, ThrowsOnMissingFile) {
+  EXPECT_THROW(ppc::util::MappedFileRange("ppc_no_such_file.txt", 0, 1), std::runtime_error);
+}
+
+TEST(MappedFileRange, RangesOfAnOpenFileOutliveIt) {
+  const std::string content = MakePattern(10000);
+  const auto path = WriteTempFile("ppc_mapped_file_open.txt", content);
+
+  std::optional<ppc::util::MappedFileRange> tail;
+  {
+    const ppc::util::MappedFile file(path);
+    EXPECT_EQ(file.Size(), content.size());
+    const ppc::util::MappedFileRange head(file, 0, 100);
+    EXPECT_EQ(head.View(), std::string_view(content).substr(0, 100));
+    EXPECT_THROW(ppc::util::MappedFileRange(file, 9999, 2), std::runtime_error);
+    tail.emplace(file, 5000, 5000);
+  }
+  EXPECT_EQ(tail->View(), std::string_view(content).substr(5000));
+  std::filesystem::remove(path);
+}
+
+TEST(ForEachFileWindow, VisitsRangeInOrder) {
+  const std::string content = MakePattern(20000);
+  const auto path = WriteTempFile("ppc_mapped_file_windows.txt", content);
+
+  std::string collected;
+  std::uint64_t windows = 0;
+  ppc::util::ForEachFileWindow(path, 123, 19000, 4096, [&](std::string_view chunk) {
+    EXPECT_LE(chunk.size(), 4096U);
+    collected += chunk;
+    ++windows;
+  });
+  EXPECT_EQ(collected, content.substr(123, 19000 - 123));
+  EXPECT_EQ(windows, 5U);
+  std::filesystem::remove(path);
+}
@@ -0,0 +1,39 @@
+#include "util/include/memory_usage.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+TEST(MemoryUsage, CountAllocationAddsToCurrentAllocations) {
+  const auto before = ppc::util::CurrentAllocations();
+  ppc::util::CountAllocation(100);
+  ppc::util::CountAllocation(28);
+  const auto after = ppc::util::CurrentAllocations();
+  EXPECT_EQ(after.count - before.count, 2U);
+  EXPECT_EQ(after.bytes - before.bytes, 128U);
+}
+
+TEST(MemoryUsage, AllocationsOfOtherThreadsAreNotCounted) {
+  const auto before = ppc::util::CurrentAllocations();
+  std::jthread([] { ppc::util::CountAllocation(100); }).join();
+  const auto after = ppc::util::CurrentAllocations();
+  EXPECT_EQ(after.count, before.count);
+  EXPECT_EQ(after.bytes, before.bytes);
+}
+
+#ifdef __linux__
+TEST(MemoryUsage, PeakResidentBytesCoversTouchedBuffer) {
+  constexpr std::size_t kBufferSize = std::size_t{64} * 1024 * 1024;
+  ppc::util::ResetPeakResidentBytes();
+  const std::uint64_t before = ppc::util::GetPeakResidentBytes();
+  EXPECT_GT(before, 0U);
+  {
+    std::vector<char> buffer(kBufferSize, 1);
+    EXPECT_EQ(buffer.back(), 1);
+  }
+  EXPECT_GE(ppc::util::GetPeakResidentBytes(), before + (kBufferSize / 2));
+}
+#endif
@@ -0,0 +1,67 @@
+#include "util/include/partition.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+TEST(Partition, BlockPartitionGivesTheRemainderToTheFirstParts) {
+  const auto parts = ppc::util::BlockPartition(10, 4);
+  ASSERT_EQ(parts.size(), 4U);
+  const std::vector<std::int64_t> counts = {parts[0].count, parts[1].count, parts[2].count, parts[3].count};
+  EXPECT_EQ(counts, (std::vector<std::int64_t>{3, 3, 2, 2}));
+  for (std::size_t i = 1; i < parts.size(); i++) {
+    EXPECT_EQ(parts[i].begin, parts[i - 1].End());
+  }
+  EXPECT_EQ(parts.back().End(), 10);
+}
+
+TEST(Partition, BlockRangeHandlesCountsBeyondInt) {
+  const std::int64_t n = (std::int64_t{1} << 40) + 3;
+  const auto last = ppc::util::BlockRange(n, 4, 3);
+  EXPECT_EQ(last.End(), n);
+  EXPECT_EQ(last.count, std::int64_t{1} << 38);
+}
+
+TEST(Partition, WeightedPartitionFollowsTheWeights) {
+  const auto parts = ppc::util::WeightedPartition(10, {1.0, 3.0, 0.0, 1.0});
+  EXPECT_EQ(parts[0].count, 2);
+  EXPECT_EQ(parts[1].count, 6);
+  EXPECT_EQ(parts[2].count, 0);
+  EXPECT_EQ(parts[3].count, 2);
+  EXPECT_EQ(parts.back().End(), 10);
+  EXPECT_THROW((void)ppc::util::WeightedPartition(10, {0.0, 0.0}), std::runtime_error);
+  EXPECT_THROW((void)ppc::util::WeightedPartition(10, {1.0, -1.0}), std::runtime_error);
+}
+
+TEST(Partition, BlockCyclicCountsMatchTheOwners) {
+  const std::int64_t n = 23;
+  const std::int64_t block = 3;
+  const int parts = 4;
+  std::vector<std::int64_t> owned(parts);
+  for (std::int64_t i = 0; i < n; i++) {
+    owned[static_cast<std::size_t>(ppc::util::BlockCyclicOwner(i, block, parts))]++;
+  }
+  for (int part = 0; part < parts; part++) {
+    EXPECT_EQ(ppc::util::BlockCyclicCount(n, block, parts, part), owned[static_cast<std::size_t>(part)]);
+    std::int64_t in_ranges = 0;
+    for (const auto &range : ppc::util::BlockCyclicRanges(n, block, parts, part)) {
+      EXPECT_EQ(ppc::util::BlockCyclicOwner(range.begin, block, parts), part);
+      in_ranges += range.count;
+    }
+    EXPECT_EQ(in_ranges, owned[static_cast<std::size_t>(part)]);
+  }
+  EXPECT_THROW((void)ppc::util::BlockCyclicCount(n, 0, parts, 0), std::runtime_error);
+}
+
+TEST(Partition, ToMpiCountsScalesAndRejectsOverflow) {
+  const auto counts = ppc::util::ToMpiCounts(ppc::util::BlockPartition(5, 2), 10);
+  EXPECT_EQ(counts.counts, (std::vector<int>{30, 20}));
+  EXPECT_EQ(counts.displs, (std::vector<int>{0, 30}));
+
+  const std::int64_t rows = std::numeric_limits<int>::max();
+  EXPECT_THROW((void)ppc::util::ToMpiCounts(ppc::util::BlockPartition(rows, 1), 2), std::runtime_error);
+  EXPECT_NO_THROW((void)ppc::util::ToMpiCounts(ppc::util::BlockPartition(rows, 1)));
+}
@@ -0,0 +1,72 @@
+#include "util/include/thread_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "util/include/util.hpp"
+
+TEST(ThreadPool, SubmitReturnsTheResultThroughAFuture) {
+  ppc::util::ThreadPool pool(2);
+  auto future = pool.Submit([] { return 6 * 7; });
+  EXPECT_EQ(future.get(), 42);
+}
+
+TEST(ThreadPool, ParallelForVisitsEveryIndexOnce) {
+  ppc::util::ThreadPool pool(3);
+  std::vector<std::atomic<int>> visits(1000);
+  pool.ParallelFor(0, visits.size(), [&](std::size_t i) { visits[i]++; });
+  for (const auto &count : visits) {
+    EXPECT_EQ(count.load(), 1);
+  }
+}
+
+TEST(ThreadPool, ParallelReduceDoesNotDependOnThePoolSize) {
+  const auto sum = [](std::size_t threads) {
+    ppc::util::ThreadPool pool(static_cast<int>(threads));
+    return pool.ParallelReduce(
+        0, 100001, std::uint64_t{0},
+        [](std::size_t begin, std::size_t end) {
+          std::uint64_t partial = 0;
+          for (std::size_t i = begin; i < end; i++) {
+            partial += i;
+          }
+          return partial;
+        },
+        [](std::uint64_t a, std::uint64_t b) { return a + b; }, 128);
+  };
+  EXPECT_EQ(sum(1), std::uint64_t{100000} * 100001 / 2);
+  EXPECT_EQ(sum(4), sum(1));
+}
+
+TEST(ThreadPool, NestedParallelForDoesNotDeadlock) {
+  ppc::util::ThreadPool pool(1);
+  std::atomic<int> total = 0;
+  pool.ParallelFor(0, 4, [&](std::size_t /*i*/) { pool.ParallelFor(0, 8, [&](std::size_t /*j*/) { total++; }); });
+  EXPECT_EQ(total.load(), 32);
+}
+
+TEST(ThreadPool, ParallelForRethrowsTheFirstException) {
+  ppc::util::ThreadPool pool(2);
+  EXPECT_THROW(pool.ParallelFor(0, 16,
+                                [](std::size_t i) {
+                                  if (i == 5) {
+                                    throw std::runtime_error("failed");
+                                  }
+                                }),
+               std::runtime_error);
+}
+
+TEST(ThreadPool, InstanceIsSharedAndSizedFromNumThreads) {
+  auto &pool = ppc::util::ThreadPool::Instance();
+  EXPECT_EQ(&pool, &ppc::util::ThreadPool::Instance());
+  EXPECT_EQ(pool.Size(), std::max(ppc::util::GetNumThreads(), 1));
+  EXPECT_NE(pool.Submit([] { return std::this_thread::get_id(); }).get(), std::this_thread::get_id());
+}
@@ -0,0 +1,106 @@
+#include "util/include/trace.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <nlohmann/json.hpp>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace {
+
+nlohmann::json WrittenTrace() {
+  std::stringstream out;
+  ppc::util::Tracer::Instance().Write(out);
+  return nlohmann::json::parse(out.str());
+}
+
+}  // namespace
+
+TEST(Tracer, SpansAreRecordedOnlyWhileEnabled) {
+  auto &tracer = ppc::util::Tracer::Instance();
+  tracer.Stop();
+  {
+    PPC_TRACE_SPAN("ignored");
+  }
+  tracer.Start(3);
+  {
+    PPC_TRACE_SPAN("outer");
+    const ppc::util::TraceSpan inner("inner", "mpi");
+  }
+  tracer.Stop();
+  {
+    PPC_TRACE_SPAN("ignored");
+  }
+  EXPECT_EQ(tracer.NumEvents(), 2U);
+
+  const auto trace = WrittenTrace();
+  std::size_t spans = 0;
+  for (const auto &event : trace["traceEvents"]) {
+    EXPECT_EQ(event["pid"], 3);
+    if (event["ph"] != "X") {
+      continue;
+    }
+    spans++;
+    EXPECT_NE(event["name"], "ignored");
+    EXPECT_GE(event["dur"].get<double>(), 0.0);
+    if (event["name"] == "inner") {
+      EXPECT_EQ(event["cat"], "mpi");
+    }
+  }
+  EXPECT_EQ(spans, 2U);
+}
+
+TEST(Tracer, ThreadsGetTheirOwnTrack) {
+  auto &tracer = ppc::util::Tracer::Instance();
+  tracer.Start(0);
+  {
+    PPC_TRACE_SPAN("main");
+  }
+  std::jthread([] { PPC_TRACE_SPAN("worker"); }).join();
+  tracer.Stop();
+
+  const auto trace = WrittenTrace();
+  int main_tid = -1;
+  int worker_tid = -1;
+  for (const auto &event : trace["traceEvents"]) {
+    if (event["name"] == "main") {
+      main_tid = event["tid"].get<int>();
+    } else if (event["name"] == "worker") {
+      worker_tid = event["tid"].get<int>();
+    }
+  }
+  EXPECT_GE(main_tid, 0);
+  EXPECT_GE(worker_tid, 0);
+  EXPECT_NE(main_tid, worker_tid);
+}
+
+TEST(Tracer, FullBufferDropsEvents) {
+  auto &tracer = ppc::util::Tracer::Instance();
+  tracer.Start(0);
+  for (std::size_t i = 0; i < ppc::util::Tracer::kEventsPerThread + 5; i++) {
+    PPC_TRACE_SPAN("span");
+  }
+  tracer.Stop();
+  EXPECT_EQ(tracer.NumEvents(), ppc::util::Tracer::kEventsPerThread);
+  EXPECT_EQ(tracer.NumDropped(), 5U);
+  EXPECT_EQ(WrittenTrace()["otherData"]["dropped_events"], 5);
+}
+
+TEST(Tracer, ClockShiftMovesTimestamps) {
+  auto &tracer = ppc::util::Tracer::Instance();
+  const double now_us = ppc::util::Tracer::NowUs();
+  tracer.Start(0, -now_us);
+  {
+    PPC_TRACE_SPAN("shifted");
+  }
+  tracer.Stop();
+  const auto trace = WrittenTrace();
+  for (const auto &event : trace["traceEvents"]) {
+    if (event["name"] == "shifted") {
+      EXPECT_GE(event["ts"].get<double>(), 0.0);
+      EXPECT_LT(event["ts"].get<double>(), 60e6);
+    }
+  }
+}
@@ -0,0 +1,87 @@
+#include "util/include/tuning.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <libenvpp/detail/environment.hpp>
+#include <stdexcept>
+
+namespace {
+
+class TuningCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::filesystem::remove_all(dir_);
+    ppc::util::ReloadTuningCache();
+  }
+  void TearDown() override {
+    std::filesystem::remove_all(dir_);
+    ppc::util::ReloadTuningCache();
+  }
+
+  std::filesystem::path dir_ = std::filesystem::temp_directory_path() / "ppc_tuning_cache_test";
+  std::filesystem::path file_ = dir_ / "tuning_cache.json";
+  env::detail::set_scoped_environment_variable scoped_file_{"PPC_TUNING_CACHE", file_.string()};
+};
+
+}  // namespace
+
+TEST(Tuning, SizeBucketIsTheFloorOfLog2) {
+  EXPECT_EQ(ppc::util::SizeBucket(0), 0);
+  EXPECT_EQ(ppc::util::SizeBucket(1), 0);
+  EXPECT_EQ(ppc::util::SizeBucket(2), 1);
+  EXPECT_EQ(ppc::util::SizeBucket(1023), 9);
+  EXPECT_EQ(ppc::util::SizeBucket(1024), 10);
+}
+
+TEST_F(TuningCacheTest, StoredConfigsSurviveSaveAndLoad) {
+  {
+    ppc::util::TuningCache cache(file_);
+    EXPECT_FALSE(cache.Find("task", 1000, 4).has_value());
+    cache.Store("task", 1000, 4, {{"chunks", 8}, {"variant", 1}}, 0.5);
+    cache.Save();
+  }
+  const ppc::util::TuningCache cache(file_);
+  // Sizes of the same power-of-two bucket share the entry, other process counts do not
+  const auto config = cache.Find("task", 600, 4);
+  ASSERT_TRUE(config.has_value());
+  EXPECT_EQ(config->at("chunks"), 8);
+  EXPECT_EQ(cache.FindTime("task", 1000, 4), 0.5);
+  EXPECT_FALSE(cache.Find("task", 2000, 4).has_value());
+  EXPECT_FALSE(cache.Find("task", 1000, 2).has_value());
+  EXPECT_FALSE(cache.Find("other", 1000, 4).has_value());
+}
+
+TEST_F(TuningCacheTest, MalformedCacheIsRejected) {
+  std::filesystem::create_directories(dir_);
+  std::ofstream(file_) << "[1, 2";
+  EXPECT_THROW(ppc::util::TuningCache{file_}, std::runtime_error);
+  // Tasks keep their defaults instead
+  EXPECT_EQ(ppc::util::GetTunedValue("task", "chunks", 1000, 4, 3), 3);
+}
+
+TEST_F(TuningCacheTest, TunedValueComesFromOverrideThenCacheThenFallback) {
+  EXPECT_EQ(ppc::util::GetTunedValue("task", "chunks", 1000, 4, 3), 3);
+
+  ppc::util::TuningCache cache(file_);
+  cache.Store("task", 1000, 4, {{"chunks", 8}}, 0.5);
+  cache.Save();
+  // The cache is read once per process until it is reloaded
+  EXPECT_EQ(ppc::util::GetTunedValue("task", "chunks", 1000, 4, 3), 3);
+  ppc::util::ReloadTuningCache();
+  EXPECT_EQ(ppc::util::GetTunedValue("task", "chunks", 1000, 4, 3), 8);
+  EXPECT_EQ(ppc::util::GetTunedValue("task", "missing", 1000, 4, 3), 3);
+
+  {
+    const ppc::util::ScopedTuneConfig outer("task", {{"chunks", 16}});
+    EXPECT_EQ(ppc::util::GetTunedValue("task", "chunks", 1000, 4, 3), 16);
+    {
+      const ppc::util::ScopedTuneConfig inner("task", {{"chunks", 32}});
+      EXPECT_EQ(ppc::util::GetTunedValue("task", "chunks", 1000, 4, 3), 32);
+    }
+    EXPECT_EQ(ppc::util::GetTunedValue("task", "chunks", 1000, 4, 3), 16);
+    EXPECT_EQ(ppc::util::GetTunedValue("other", "chunks", 1000, 4, 3), 3);
+  }
+  EXPECT_EQ(ppc::util::GetTunedValue("task", "chunks", 1000, 4, 3), 8);
+}
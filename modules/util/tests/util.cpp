@@ -109,6 +109,41 @@ TEST(GetPerfMaxTime, ReadsFromEnvironment) {
   EXPECT_DOUBLE_EQ(ppc::util::GetPerfMaxTime(), 12.5);
 }
 
+TEST(GetPerfWarmupRuns, ReadsFromEnvironment) {
+  env::detail::set_scoped_environment_variable scoped("PPC_PERF_WARMUP", "3");
+  EXPECT_EQ(ppc::util::GetPerfWarmupRuns(), 3);
+}
+
+TEST(GetPerfTargetCi, ReadsFromEnvironment) {
+  env::detail::set_scoped_environment_variable scoped("PPC_PERF_TARGET_CI", "0.05");
+  EXPECT_DOUBLE_EQ(ppc::util::GetPerfTargetCi(), 0.05);
+}
+
+TEST(GetPerfResultsFile, ReadsFromEnvironment) {
+  env::detail::set_scoped_environment_variable scoped("PPC_PERF_RESULTS_FILE", "perf_results.jsonl");
+  EXPECT_EQ(ppc::util::GetPerfResultsFile(), "perf_results.jsonl");
+}
+
+TEST(IsPerfCountersEnabled, ReadsFromEnvironment) {
+  env::detail::set_scoped_environment_variable scoped("PPC_PERF_COUNTERS", "1");
+  EXPECT_TRUE(ppc::util::IsPerfCountersEnabled());
+}
+
+TEST(GetPerfProblemScale, ReadsFromEnvironment) {
+  env::detail::set_scoped_environment_variable scoped("PPC_PERF_PROBLEM_SCALE", "4");
+  EXPECT_EQ(ppc::util::GetPerfProblemScale(), 4);
+}
+
+TEST(GetMpiProfileTop, ReadsFromEnvironment) {
+  env::detail::set_scoped_environment_variable scoped("PPC_MPI_PROFILE", "15");
+  EXPECT_EQ(ppc::util::GetMpiProfileTop(), 15);
+}
+
+TEST(GetGitCommit, PrefersExplicitSha) {
+  env::detail::set_scoped_environment_variable scoped("PPC_GIT_SHA", "0123abc");
+  EXPECT_EQ(ppc::util::GetGitCommit(), "0123abc");
+}
+
 TEST(GetNumProc, ReturnsDefaultWhenUnset) {
   const auto old = env::get<int>("PPC_NUM_PROC");
   if (old.has_value()) {
@@ -242,6 +242,40 @@ def load_performance_data_processes(perf_stat_file_path: Path) -> dict:
     return perf_stats
 
 
+def load_performance_records(perf_results_path: Path) -> tuple[dict, dict]:
+    """Load task_run times from the JSON Lines file written by the perf tests.
+
+    The file is the one named by PPC_PERF_RESULTS_FILE: one JSON object per measurement.
+    Returns (threads, processes) mappings shaped like the CSV loaders: task -> {impl: time}.
+    Later records overwrite earlier ones.
+    """
+    perf_threads: dict[str, dict] = {}
+    perf_processes: dict[str, dict] = {}
+    if not perf_results_path.exists():
+        logger.warning("Perf results file not found at %s", perf_results_path)
+        return perf_threads, perf_processes
+
+    with open(perf_results_path, "r") as records_file:
+        for line in records_file:
+            line = line.strip()
+            if not line:
+                continue
+            record = json.loads(line)
+            if record.get("mode") != "task_run":
+                continue
+            task_name = record["task"]
+            if "threads" in task_name:
+                entry = perf_threads.setdefault(
+                    task_name, {t: "?" for t in task_types_threads}
+                )
+            else:
+                entry = perf_processes.setdefault(
+                    task_name, {t: "?" for t in task_types_processes}
+                )
+            entry[record["impl"]] = str(record["time_sec"])
+    return perf_threads, perf_processes
+
+
 def calculate_performance_metrics(perf_val, eff_num_proc, task_type, seq_val=None):
     """Calculate acceleration and efficiency.
 
@@ -807,9 +841,21 @@ def main():
         (p for p in candidates_processes if p.exists()), candidates_processes[0]
     )
 
+    # Structured records of the perf tests take precedence over the CSV tables
+    candidates_records = [
+        script_dir.parent / "build" / "perf_stat_dir" / "perf_results.jsonl",
+        script_dir.parent / "perf_stat_dir" / "perf_results.jsonl",
+    ]
+    records_path = next((p for p in candidates_records if p.exists()), None)
+
     # Read and merge performance statistics CSVs (keys = CSV Task column)
-    perf_stats_threads = load_performance_data_threads(threads_csv)
-    perf_stats_processes = load_performance_data_processes(processes_csv)
+    if records_path is not None:
+        perf_stats_threads, perf_stats_processes = load_performance_records(
+            records_path
+        )
+    else:
+        perf_stats_threads = load_performance_data_threads(threads_csv)
+        perf_stats_processes = load_performance_data_processes(processes_csv)
 
     def _aggregate_process_csv(
         perf_stat_file_path: Path, base: dict[str, dict]
@@ -854,7 +900,10 @@ def main():
                         entry["mpi"] = mpi_val
         return perf_stats_local
 
-    perf_stats_processes = _aggregate_process_csv(processes_csv, perf_stats_processes)
+    if records_path is None:
+        perf_stats_processes = _aggregate_process_csv(
+            processes_csv, perf_stats_processes
+        )
 
     # Generic aliasing for example process tasks: normalize any *test_task_processes* keys
     def _normalize_example_proc_name(name: str) -> str:
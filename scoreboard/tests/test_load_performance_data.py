@@ -3,7 +3,8 @@ Tests for the load_performance_data function.
 """
 
 import csv
-from main import load_performance_data
+import json
+from main import load_performance_data, load_performance_records
 
 
 class TestLoadPerformanceData:
@@ -142,3 +143,42 @@ class TestLoadPerformanceData:
         assert task_data["tbb"] == ""
         assert task_data["all"] == "N/A"
         assert task_data["mpi"] == "N/A"
+
+
+class TestLoadPerformanceRecords:
+    """Test cases for load_performance_records function."""
+
+    def test_splits_threads_and_processes(self, temp_dir):
+        """Task_run records are grouped by category; pipeline records are ignored."""
+        records_file = temp_dir / "perf_results.jsonl"
+        records = [
+            {"task": "example_threads", "impl": "seq", "mode": "task_run", "time_sec": 1.0},
+            {"task": "example_threads", "impl": "omp", "mode": "task_run", "time_sec": 0.5},
+            {"task": "example_threads", "impl": "omp", "mode": "pipeline", "time_sec": 9.0},
+            {"task": "example_processes", "impl": "mpi", "mode": "task_run", "time_sec": 0.25},
+        ]
+        records_file.write_text("\n".join(json.dumps(r) for r in records) + "\n")
+
+        threads, processes = load_performance_records(records_file)
+
+        assert threads["example_threads"]["seq"] == "1.0"
+        assert threads["example_threads"]["omp"] == "0.5"
+        assert threads["example_threads"]["tbb"] == "?"
+        assert processes["example_processes"] == {"mpi": "0.25", "seq": "?"}
+
+    def test_later_records_win(self, temp_dir):
+        """A file appended over several runs yields the latest time."""
+        records_file = temp_dir / "perf_results.jsonl"
+        records = [
+            {"task": "example_threads", "impl": "seq", "mode": "task_run", "time_sec": 2.0},
+            {"task": "example_threads", "impl": "seq", "mode": "task_run", "time_sec": 1.5},
+        ]
+        records_file.write_text("\n".join(json.dumps(r) for r in records) + "\n")
+
+        threads, _ = load_performance_records(records_file)
+
+        assert threads["example_threads"]["seq"] == "1.5"
+
+    def test_missing_file(self, temp_dir):
+        """A missing file gives empty mappings."""
+        assert load_performance_records(temp_dir / "missing.jsonl") == ({}, {})
@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+"""Time-vs-N report and complexity fit for size-sweep perf tests.
+
+Input is the JSON Lines file written by the perf tests (PPC_PERF_RESULTS_FILE). Only records with a
+`problem_size` (test cases made by `ppc::util::MakeAllPerfSizeTasks`) are used; repeated points are
+averaged.
+
+For every (task, impl, mode, processes, threads) series the script
+  * fits t = a * N^b by least squares on log t / log N and reports the exponent b;
+  * picks the closest of the models N, N log N, N^2 and N^3 (least relative squared error of the
+    best scale factor of each model);
+  * reports the throughput at every N (from the `work` the test declares, or N elements otherwise)
+    and flags a cache cliff where the throughput drops by more than CLIFF_DROP between neighbouring sizes.
+"""
+
+import argparse
+import csv
+import json
+import math
+import os
+import statistics
+from collections import defaultdict
+
+# Relative throughput drop between neighbouring sizes reported as a cache cliff
+CLIFF_DROP = 0.3
+
+MODELS = {
+    "N": lambda n: n,
+    "N log N": lambda n: n * math.log2(n),
+    "N^2": lambda n: n**2,
+    "N^3": lambda n: n**3,
+}
+
+
+def load_series(path: str) -> dict:
+    """Group records by (task, impl, mode, procs, threads) -> N -> {times, work, unit}."""
+    series = defaultdict(dict)
+    with open(path, "r") as records_file:
+        for line in records_file:
+            line = line.strip()
+            if not line:
+                continue
+            record = json.loads(line)
+            size = int(record.get("problem_size", 0))
+            if size <= 0 or record.get("time_sec", -1.0) <= 0.0:
+                continue
+            key = (
+                record["task"],
+                record["impl"],
+                record["mode"],
+                int(record.get("num_proc", 1)),
+                int(record.get("num_threads", 1)),
+            )
+            point = series[key].setdefault(
+                size, {"times": [], "work": float(size), "unit": "elements"}
+            )
+            point["times"].append(float(record["time_sec"]))
+            if "work" in record:
+                point["work"] = float(record["work"]["count"])
+                point["unit"] = record["work"]["unit"]
+    return series
+
+
+def fit_exponent(sizes: list[int], times: list[float]):
+    """Least-squares slope of log t over log N, or None for fewer than two sizes."""
+    if len(sizes) < 2:
+        return None
+    xs = [math.log(n) for n in sizes]
+    ys = [math.log(t) for t in times]
+    x_mean, y_mean = statistics.fmean(xs), statistics.fmean(ys)
+    denominator = sum((x - x_mean) ** 2 for x in xs)
+    if denominator == 0.0:
+        return None
+    return sum((x - x_mean) * (y - y_mean) for x, y in zip(xs, ys)) / denominator
+
+
+def best_model(sizes: list[int], times: list[float]):
+    """Name of the model whose best scaled fit has the least relative squared error."""
+    if len(sizes) < 2:
+        return None
+    errors = {}
+    for name, model in MODELS.items():
+        values = [model(n) for n in sizes]
+        # t ~ c * f(N); minimize sum((c * f / t - 1)^2) over c
+        ratios = [v / t for v, t in zip(values, times)]
+        scale = sum(ratios) / sum(r * r for r in ratios)
+        errors[name] = sum((scale * r - 1.0) ** 2 for r in ratios)
+    return min(errors, key=errors.get)
+
+
+def build_rows(series: dict) -> list[dict]:
+    rows = []
+    for (task, impl, mode, procs, threads), points in sorted(series.items()):
+        sizes = sorted(points)
+        times = [statistics.fmean(points[n]["times"]) for n in sizes]
+        exponent = fit_exponent(sizes, times)
+        model = best_model(sizes, times)
+        previous = None
+        for n, t in zip(sizes, times):
+            throughput = points[n]["work"] / t
+            cliff = previous is not None and throughput < (1.0 - CLIFF_DROP) * previous
+            rows.append(
+                {
+                    "task": task,
+                    "impl": impl,
+                    "mode": mode,
+                    "procs": procs,
+                    "threads": threads,
+                    "n": n,
+                    "time_mean": t,
+                    "throughput": throughput,
+                    "unit": points[n]["unit"] + "/s",
+                    "cache_cliff": "yes" if cliff else "",
+                    "fit_exponent": "?" if exponent is None else round(exponent, 3),
+                    "best_model": model or "?",
+                }
+            )
+            previous = throughput
+    return rows
+
+
+def write_report(records_path: str, output_dir: str) -> str:
+    rows = build_rows(load_series(records_path))
+    os.makedirs(output_dir, exist_ok=True)
+    csv_path = os.path.join(output_dir, "complexity.csv")
+    fields = [
+        "task",
+        "impl",
+        "mode",
+        "procs",
+        "threads",
+        "n",
+        "time_mean",
+        "throughput",
+        "unit",
+        "cache_cliff",
+        "fit_exponent",
+        "best_model",
+    ]
+    with open(csv_path, "w", newline="") as csvfile:
+        writer = csv.DictWriter(csvfile, fieldnames=fields)
+        writer.writeheader()
+        writer.writerows(rows)
+
+    summary = {}
+    for row in rows:
+        key = f"{row['task']}:{row['impl']}:{row['mode']}"
+        summary.setdefault(key, row)
+        if row["cache_cliff"]:
+            print(f"{key}: throughput drops at N={row['n']}")
+    for key, row in summary.items():
+        print(f"{key}: t ~ N^{row['fit_exponent']}, closest model {row['best_model']}")
+    return csv_path
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument(
+        "-i", "--input", required=True, help="Perf records of a size sweep (.jsonl)"
+    )
+    parser.add_argument(
+        "-o", "--output", required=True, help="Directory for complexity.csv"
+    )
+    args = parser.parse_args()
+    print("Complexity report:", write_report(args.input, args.output))
@@ -1,4 +1,5 @@
 import argparse
+import json
 import os
 import re
 import xlsxwriter
@@ -128,9 +129,32 @@ def _write_csv(path: str, header: list[str], tasks_list: list[str], table: dict)
             writer.writerow(row)
 
 
+def _load_json_records(path: str, result_tables: dict, tasks_by_category: dict):
+    """Read records written by the perf tests to PPC_PERF_RESULTS_FILE (one JSON object per line).
+
+    Later records overwrite earlier ones, so a file appended over several runs yields the latest times.
+    """
+    with open(path, "r") as records_file:
+        for line in records_file:
+            line = line.strip()
+            if not line:
+                continue
+            record = json.loads(line)
+            task_name = record["task"]
+            perf_type = record["mode"]
+            _ensure_task_tables(result_tables, perf_type, task_name)
+            result_tables[perf_type][task_name][record["impl"]] = float(
+                record["time_sec"]
+            )
+            tasks_by_category[_infer_category(task_name)].add(task_name)
+
+
 parser = argparse.ArgumentParser()
 parser.add_argument(
-    "-i", "--input", help="Input file path (logs of perf tests, .txt)", required=True
+    "-i",
+    "--input",
+    help="Input file path (PPC_PERF_RESULTS_FILE records, .jsonl, or logs of perf tests, .txt)",
+    required=True,
 )
 parser.add_argument(
     "-o", "--output", help="Output file path (path to .xlsx table)", required=True
@@ -146,8 +170,12 @@ task_categories = {}
 # Track tasks per category to split output
 tasks_by_category = {"threads": set(), "processes": set()}
 
-with open(logs_path, "r") as logs_file:
-    logs_lines = logs_file.readlines()
+if logs_path.endswith(".jsonl"):
+    _load_json_records(logs_path, result_tables, tasks_by_category)
+    logs_lines = []
+else:
+    with open(logs_path, "r") as logs_file:
+        logs_lines = logs_file.readlines()
 for line in logs_lines:
     # Handle both old format: tasks/task_type/task_name:perf_type:time
     # and new format: namespace_task_type_enabled:perf_type:time
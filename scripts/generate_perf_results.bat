@@ -1,4 +1,6 @@
 @echo off
 mkdir build\perf_stat_dir
+set PPC_PERF_RESULTS_FILE=%cd%\build\perf_stat_dir\perf_results.jsonl
+if exist "%PPC_PERF_RESULTS_FILE%" del "%PPC_PERF_RESULTS_FILE%"
 scripts/run_tests.py --running-type="performance" > build\perf_stat_dir\perf_log.txt
-python scripts\create_perf_table.py --input build\perf_stat_dir\perf_log.txt --output build\perf_stat_dir
+python scripts\create_perf_table.py --input "%PPC_PERF_RESULTS_FILE%" --output build\perf_stat_dir
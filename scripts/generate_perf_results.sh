@@ -2,5 +2,9 @@
 set -euo pipefail
 
 mkdir -p build/perf_stat_dir
+export PPC_PERF_RESULTS_FILE="$PWD/build/perf_stat_dir/perf_results.jsonl"
+PPC_GIT_SHA="${PPC_GIT_SHA:-$(git rev-parse HEAD 2>/dev/null || echo unknown)}"
+export PPC_GIT_SHA
+rm -f "$PPC_PERF_RESULTS_FILE"
 scripts/run_tests.py --running-type="performance" | tee build/perf_stat_dir/perf_log.txt
-python3 scripts/create_perf_table.py --input build/perf_stat_dir/perf_log.txt --output build/perf_stat_dir
+python3 scripts/create_perf_table.py --input "$PPC_PERF_RESULTS_FILE" --output build/perf_stat_dir
@@ -0,0 +1,46 @@
+#!/usr/bin/env python3
+"""Join the per-rank timelines of a test run into a single Chrome trace.
+
+Every rank writes `trace_rank<r>.json` to PPC_TRACE_DIR. The events already carry the rank as
+their process id and share the clock of rank 0, so merging is a concatenation of the event
+lists. Open the result in chrome://tracing or https://ui.perfetto.dev.
+"""
+
+import argparse
+import glob
+import json
+import os
+
+
+def merge_traces(trace_dir: str) -> dict:
+    events = []
+    dropped = 0
+    paths = sorted(glob.glob(os.path.join(trace_dir, "trace_rank*.json")))
+    if not paths:
+        raise FileNotFoundError(f"No trace_rank*.json files in {trace_dir}")
+    for path in paths:
+        with open(path, "r") as trace_file:
+            trace = json.load(trace_file)
+        events.extend(trace["traceEvents"])
+        dropped += int(trace.get("otherData", {}).get("dropped_events", 0))
+    return {
+        "displayTimeUnit": "ms",
+        "traceEvents": events,
+        "otherData": {"dropped_events": dropped, "ranks": len(paths)},
+    }
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument(
+        "-i", "--input", required=True, help="Directory with trace_rank*.json (PPC_TRACE_DIR)"
+    )
+    parser.add_argument("-o", "--output", required=True, help="Merged trace (.json)")
+    args = parser.parse_args()
+    merged = merge_traces(args.input)
+    with open(args.output, "w") as output_file:
+        json.dump(merged, output_file)
+    print(
+        f"Merged {merged['otherData']['ranks']} ranks into {args.output}, "
+        f"{merged['otherData']['dropped_events']} events dropped"
+    )
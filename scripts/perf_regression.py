@@ -0,0 +1,265 @@
+#!/usr/bin/env python3
+"""Performance regression gate against a stored baseline.
+
+A baseline is a JSON file per machine profile (e.g. `perf_baselines/<host>.json`) built from the
+JSON Lines records of the perf tests (PPC_PERF_RESULTS_FILE). Every measurement is identified by
+task, implementation, mode (pipeline/task_run), process and thread counts, problem scale and size.
+
+A measurement regresses when its median is more than `--threshold` slower than the baseline median
+and the slowdown is significant:
+  * with at least MIN_SAMPLES raw samples on both sides, a one-sided Mann-Whitney U test
+    (normal approximation with tie correction) must reject "not slower" at level `--alpha`;
+  * otherwise the 95% confidence intervals of the means must not overlap.
+The exit code is 1 if any measurement regressed.
+"""
+
+import argparse
+import json
+import math
+import os
+import statistics
+import sys
+
+# Fewer samples make the normal approximation of the U statistic unreliable
+MIN_SAMPLES = 5
+
+
+def measurement_key(record: dict) -> str:
+    return ":".join(
+        str(part)
+        for part in (
+            record["task"],
+            record["impl"],
+            record["mode"],
+            record.get("num_proc", 1),
+            record.get("num_threads", 1),
+            record.get("problem_scale", 1),
+            record.get("problem_size", 0),
+        )
+    )
+
+
+def load_measurements(path: str) -> tuple[dict, str]:
+    """Reads perf records into key -> {median, ci_low, ci_high, samples} and the host they ran on.
+
+    Repeated measurements of the same key are pooled: their samples are concatenated and the
+    median and CI bounds are averaged.
+    """
+    grouped = {}
+    hostname = ""
+    with open(path, "r") as records_file:
+        for line in records_file:
+            line = line.strip()
+            if not line:
+                continue
+            record = json.loads(line)
+            if record.get("time_sec", -1.0) < 0.0:
+                continue
+            hostname = record.get("hostname", hostname)
+            stats = record.get("statistics", {})
+            entry = grouped.setdefault(
+                measurement_key(record),
+                {"medians": [], "ci_low": [], "ci_high": [], "samples": []},
+            )
+            entry["medians"].append(float(stats.get("median", record["time_sec"])))
+            entry["ci_low"].append(float(stats.get("ci_low", record["time_sec"])))
+            entry["ci_high"].append(float(stats.get("ci_high", record["time_sec"])))
+            entry["samples"].extend(float(s) for s in record.get("samples", []))
+
+    measurements = {
+        key: {
+            "median": statistics.fmean(entry["medians"]),
+            "ci_low": statistics.fmean(entry["ci_low"]),
+            "ci_high": statistics.fmean(entry["ci_high"]),
+            "samples": entry["samples"],
+        }
+        for key, entry in grouped.items()
+    }
+    return measurements, hostname
+
+
+def mann_whitney_greater(current: list[float], baseline: list[float]) -> float:
+    """One-sided p-value of the hypothesis that `current` tends to be larger than `baseline`."""
+    n1, n2 = len(current), len(baseline)
+    ranked = sorted(
+        [(value, 0) for value in current] + [(value, 1) for value in baseline]
+    )
+    ranks = [0.0] * len(ranked)
+    tie_term = 0.0
+    i = 0
+    while i < len(ranked):
+        j = i
+        while j + 1 < len(ranked) and ranked[j + 1][0] == ranked[i][0]:
+            j += 1
+        # Tied values share the average of their ranks
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2.0 + 1.0
+        ties = j - i + 1
+        tie_term += ties**3 - ties
+        i = j + 1
+    rank_sum = sum(rank for rank, (_, group) in zip(ranks, ranked) if group == 0)
+    u_statistic = rank_sum - n1 * (n1 + 1) / 2.0
+    n = n1 + n2
+    variance = n1 * n2 / 12.0 * ((n + 1) - tie_term / (n * (n - 1)))
+    if variance <= 0.0:
+        return 1.0
+    # Continuity correction
+    z = (u_statistic - n1 * n2 / 2.0 - 0.5) / math.sqrt(variance)
+    return 0.5 * math.erfc(z / math.sqrt(2.0))
+
+
+def compare(current: dict, baseline: dict, threshold: float, alpha: float) -> list[dict]:
+    rows = []
+    for key in sorted(set(current) | set(baseline)):
+        row = {
+            "key": key,
+            "baseline": None,
+            "current": None,
+            "change": None,
+            "test": None,
+        }
+        if key not in baseline:
+            row.update(current=current[key]["median"], status="new")
+            rows.append(row)
+            continue
+        if key not in current:
+            row.update(baseline=baseline[key]["median"], status="missing")
+            rows.append(row)
+            continue
+        cur, base = current[key], baseline[key]
+        row["baseline"] = base["median"]
+        row["current"] = cur["median"]
+        row["change"] = (
+            cur["median"] / base["median"] - 1.0 if base["median"] > 0.0 else 0.0
+        )
+        if len(cur["samples"]) >= MIN_SAMPLES and len(base["samples"]) >= MIN_SAMPLES:
+            p_value = mann_whitney_greater(cur["samples"], base["samples"])
+            significant = p_value < alpha
+            row["test"] = f"U p={p_value:.3g}"
+        else:
+            significant = cur["ci_low"] > base["ci_high"]
+            row["test"] = "CI disjoint" if significant else "CI overlap"
+        if row["change"] > threshold and significant:
+            row["status"] = "REGRESSION"
+        elif row["change"] < -threshold:
+            row["status"] = "faster"
+        else:
+            row["status"] = "ok"
+        rows.append(row)
+    return rows
+
+
+def format_table(rows: list[dict]) -> str:
+    def fmt_time(value):
+        return "-" if value is None else f"{value:.6f}"
+
+    header = ("measurement", "baseline(s)", "current(s)", "change", "test", "status")
+    lines = [header]
+    for row in rows:
+        change = "-" if row["change"] is None else f"{row['change'] * 100.0:+.1f}%"
+        lines.append(
+            (
+                row["key"],
+                fmt_time(row["baseline"]),
+                fmt_time(row["current"]),
+                change,
+                row["test"] or "-",
+                row["status"],
+            )
+        )
+    widths = [max(len(line[i]) for line in lines) for i in range(len(header))]
+    return "\n".join(
+        "  ".join(cell.ljust(width) for cell, width in zip(line, widths)).rstrip()
+        for line in lines
+    )
+
+
+def write_baseline(path: str, measurements: dict, profile: str) -> None:
+    directory = os.path.dirname(path)
+    if directory:
+        os.makedirs(directory, exist_ok=True)
+    with open(path, "w") as baseline_file:
+        json.dump(
+            {
+                "profile": profile,
+                "git_sha": os.environ.get("PPC_GIT_SHA", "unknown"),
+                "measurements": measurements,
+            },
+            baseline_file,
+            indent=1,
+            sort_keys=True,
+        )
+        baseline_file.write("\n")
+
+
+def read_baseline(path: str) -> tuple[dict, str]:
+    with open(path, "r") as baseline_file:
+        data = json.load(baseline_file)
+    return data["measurements"], data.get("profile", "")
+
+
+def run_gate(
+    records_path: str,
+    baseline_path: str,
+    update: bool = False,
+    threshold: float = 0.05,
+    alpha: float = 0.05,
+) -> int:
+    """Compares the records with the baseline, or stores them as the new baseline; returns the exit code."""
+    current, hostname = load_measurements(records_path)
+    if update:
+        write_baseline(baseline_path, current, hostname)
+        print(f"Baseline with {len(current)} measurements written to {baseline_path}")
+        return 0
+    if not os.path.exists(baseline_path):
+        print(f"No baseline at {baseline_path}; create it with --update-baseline")
+        return 1
+    baseline, profile = read_baseline(baseline_path)
+    if profile and hostname and profile != hostname:
+        print(
+            f"Warning: the baseline was recorded on '{profile}', this run is on '{hostname}'"
+        )
+    rows = compare(current, baseline, threshold, alpha)
+    print(format_table(rows))
+    regressions = [row for row in rows if row["status"] == "REGRESSION"]
+    if regressions:
+        print(
+            f"{len(regressions)} measurement(s) slower than the baseline by more than "
+            f"{threshold * 100.0:.1f}%"
+        )
+        return 1
+    print("No performance regressions")
+    return 0
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument(
+        "-i", "--input", required=True, help="Perf records of this run (.jsonl)"
+    )
+    parser.add_argument(
+        "-b",
+        "--baseline",
+        required=True,
+        help="Baseline file of this machine profile, e.g. perf_baselines/<host>.json",
+    )
+    parser.add_argument(
+        "--update-baseline",
+        action="store_true",
+        help="Store this run as the baseline instead of comparing against it",
+    )
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.05,
+        help="Relative slowdown of the median tolerated before a measurement regresses",
+    )
+    parser.add_argument(
+        "--alpha", type=float, default=0.05, help="Significance level of the test"
+    )
+    args = parser.parse_args()
+    sys.exit(
+        run_gate(
+            args.input, args.baseline, args.update_baseline, args.threshold, args.alpha
+        )
+    )
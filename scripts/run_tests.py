@@ -3,6 +3,7 @@
 import os
 import shlex
 import subprocess
+import sys
 import platform
 from pathlib import Path
 
@@ -29,6 +30,41 @@ def init_cmd_args():
         type=int,
         help="List of process/thread counts to run sequentially",
     )
+    parser.add_argument(
+        "--scaling",
+        choices=["strong", "weak"],
+        help="With --running-type=performance: sweep the --counts process counts (and --thread-counts for "
+        "hybrid tasks) and report speedup, efficiency and the Karp-Flatt serial fraction. "
+        "'weak' grows the input with the worker count through PPC_PERF_PROBLEM_SCALE.",
+    )
+    parser.add_argument(
+        "--thread-counts",
+        nargs="+",
+        type=int,
+        help="Thread counts swept for hybrid (all) tasks in a scaling sweep",
+    )
+    parser.add_argument(
+        "--repeats",
+        type=int,
+        default=1,
+        help="Number of times each point of a scaling sweep is measured",
+    )
+    parser.add_argument(
+        "--baseline",
+        help="With --running-type=performance: compare the run against this baseline file "
+        "(one per machine profile) and fail on significant regressions",
+    )
+    parser.add_argument(
+        "--update-baseline",
+        action="store_true",
+        help="Store the run as the --baseline instead of comparing against it",
+    )
+    parser.add_argument(
+        "--regression-threshold",
+        type=float,
+        default=0.05,
+        help="Relative slowdown of a median tolerated by the --baseline comparison",
+    )
     parser.add_argument(
         "--verbose", action="store_true", help="Print commands executed by the script"
     )
@@ -131,41 +167,35 @@ class PPCRunner:
             return "mpich", "-n"
         return "unknown", "-np"
 
+    def __forwarded_env(self):
+        names = ["PPC_NUM_THREADS", "OMP_NUM_THREADS"]
+        # Every rank builds the input, so all of them need the weak-scaling factor
+        if "PPC_PERF_PROBLEM_SCALE" in self.__ppc_env:
+            names.append("PPC_PERF_PROBLEM_SCALE")
+        return names
+
     def __build_mpi_cmd(self, ppc_num_proc, additional_mpi_args):
         base = [self.mpi_exec] + shlex.split(additional_mpi_args)
 
         if self.platform == "Windows":
             # MS-MPI style
-            env_args = [
-                "-env",
-                "PPC_NUM_THREADS",
-                self.__ppc_env["PPC_NUM_THREADS"],
-                "-env",
-                "OMP_NUM_THREADS",
-                self.__ppc_env["OMP_NUM_THREADS"],
-            ]
+            env_args = []
+            for name in self.__forwarded_env():
+                env_args += ["-env", name, self.__ppc_env[name]]
             np_args = ["-n", ppc_num_proc]
             return base + env_args + np_args
 
         # Non-Windows
         if self.mpi_env_mode == "openmpi":
-            env_args = [
-                "-x",
-                "PPC_NUM_THREADS",
-                "-x",
-                "OMP_NUM_THREADS",
-            ]
+            env_args = []
+            for name in self.__forwarded_env():
+                env_args += ["-x", name]
             np_flag = "-np"
         elif self.mpi_env_mode == "mpich":
             # Explicitly set env variables for all ranks
-            env_args = [
-                "-env",
-                "PPC_NUM_THREADS",
-                self.__ppc_env["PPC_NUM_THREADS"],
-                "-env",
-                "OMP_NUM_THREADS",
-                self.__ppc_env["OMP_NUM_THREADS"],
-            ]
+            env_args = []
+            for name in self.__forwarded_env():
+                env_args += ["-env", name, self.__ppc_env[name]]
             np_flag = "-n"
         else:
             # Unknown MPI flavor: rely on environment inheritance and default to -np
@@ -245,6 +275,82 @@ class PPCRunner:
                 + self.__get_gtest_settings(1, "_" + task_type + "_")
             )
 
+    def run_performance_point(self, task_type):
+        """Runs the perf tests of one implementation type under mpirun with PPC_NUM_PROC processes."""
+        mpi_running = self.__build_mpi_cmd(self.__ppc_num_proc, "")
+        self.__run_exec(
+            mpi_running
+            + [str(self.work_dir / "ppc_perf_tests")]
+            + self.__get_gtest_settings(1, "_" + task_type + "_")
+        )
+
+
+def _run_scaling(args_dict, env):
+    """Runs the perf tests at every point of the sweep and writes the scaling report."""
+    mode = args_dict["scaling"]
+    proc_counts = sorted(set(args_dict.get("counts") or [1]) | {1})
+    thread_counts = sorted(set(args_dict.get("thread_counts") or [1]))
+    project_path = Path(__file__).resolve().parent.parent
+    output_dir = project_path / "build" / "perf_stat_dir" / "scaling"
+    output_dir.mkdir(parents=True, exist_ok=True)
+    records_path = output_dir / f"{mode}_perf_results.jsonl"
+    records_path.unlink(missing_ok=True)
+
+    def run_point(procs, threads, task_type):
+        workers = procs * threads if task_type == "all" else procs
+        env_copy = dict(env)
+        env_copy["PPC_NUM_PROC"] = str(procs)
+        env_copy["PPC_NUM_THREADS"] = str(threads)
+        env_copy["PPC_PERF_RESULTS_FILE"] = str(records_path)
+        env_copy["PPC_PERF_PROBLEM_SCALE"] = str(workers if mode == "weak" else 1)
+        print(
+            f"Scaling point: {task_type}, processes={procs}, threads={threads}",
+            flush=True,
+        )
+        runner = PPCRunner(verbose=args_dict.get("verbose", False))
+        runner.setup_env(env_copy)
+        runner.run_performance_point(task_type)
+
+    for _ in range(max(args_dict.get("repeats", 1), 1)):
+        run_point(1, 1, "seq")
+        for procs in proc_counts:
+            run_point(procs, 1, "mpi")
+            for threads in thread_counts:
+                run_point(procs, threads, "all")
+
+    from scaling_report import write_report
+
+    csv_path = write_report(str(records_path), mode, str(output_dir))
+    print(f"Scaling report: {csv_path}")
+
+
+def _run_with_baseline(args_dict, env):
+    """Runs the perf tests and compares their records with the baseline, or stores them as it."""
+    # The tests append to the records file, so this run gets a fresh one: records of earlier runs must not be
+    # pooled with its samples. A file set by the user still receives a copy of them afterwards.
+    user_records = env.get("PPC_PERF_RESULTS_FILE")
+    project_path = Path(__file__).resolve().parent.parent
+    output_dir = project_path / "build" / "perf_stat_dir"
+    output_dir.mkdir(parents=True, exist_ok=True)
+    records_path = str(output_dir / "baseline_run.jsonl")
+    Path(records_path).unlink(missing_ok=True)
+    env = dict(env)
+    env["PPC_PERF_RESULTS_FILE"] = records_path
+    _execute(args_dict, env)
+    if user_records and Path(records_path).exists():
+        Path(user_records).parent.mkdir(parents=True, exist_ok=True)
+        with open(user_records, "a", encoding="utf-8") as target:
+            target.write(Path(records_path).read_text(encoding="utf-8"))
+
+    from perf_regression import run_gate
+
+    return run_gate(
+        records_path,
+        args_dict["baseline"],
+        update=args_dict.get("update_baseline", False),
+        threshold=args_dict.get("regression_threshold", 0.05),
+    )
+
 
 def _execute(args_dict, env):
     runner = PPCRunner(verbose=args_dict.get("verbose", False))
@@ -267,7 +373,15 @@ if __name__ == "__main__":
     args_dict = init_cmd_args()
     counts = args_dict.get("counts")
 
-    if counts:
+    if args_dict.get("scaling"):
+        if args_dict["running_type"] != "performance":
+            raise Exception("--scaling requires --running-type=performance")
+        _run_scaling(args_dict, os.environ.copy())
+    elif args_dict.get("baseline"):
+        if args_dict["running_type"] != "performance":
+            raise Exception("--baseline requires --running-type=performance")
+        sys.exit(_run_with_baseline(args_dict, os.environ.copy()))
+    elif counts:
         for count in counts:
             env_copy = os.environ.copy()
 
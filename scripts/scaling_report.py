@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+"""Speedup, efficiency and Karp-Flatt reports from a scaling sweep.
+
+Input is the JSON Lines file written by the perf tests (PPC_PERF_RESULTS_FILE) during
+`scripts/run_tests.py --running-type=performance --scaling=strong|weak`.
+Only `task_run` records are used. Repeated points are averaged.
+
+Strong scaling (fixed input):
+    S(P) = T_seq / T(P), E(P) = S(P) / P
+Weak scaling (input grown P times, see PPC_PERF_PROBLEM_SCALE):
+    S(P) = P * T(1) / T(P), E(P) = T(1) / T(P)
+Karp-Flatt experimentally determined serial fraction:
+    e(P) = (1 / S - 1 / P) / (1 - 1 / P)
+A steadily growing e(P) means overhead grows with P; a flat e(P) points to a fixed serial part.
+"""
+
+import argparse
+import csv
+import json
+import os
+import statistics
+from collections import defaultdict
+
+# A task is reported as no longer scaling once its efficiency falls below this value
+EFFICIENCY_THRESHOLD = 0.5
+
+
+def load_points(path: str) -> dict:
+    """Group task_run times by (task, impl) -> (workers, procs, threads, problem_scale) -> [times]."""
+    points = defaultdict(lambda: defaultdict(list))
+    with open(path, "r") as records_file:
+        for line in records_file:
+            line = line.strip()
+            if not line:
+                continue
+            record = json.loads(line)
+            if record.get("mode") != "task_run":
+                continue
+            procs = int(record.get("num_proc", 1))
+            # Only hybrid and thread implementations use the threads of a process
+            threads = (
+                int(record.get("num_threads", 1))
+                if record["impl"] in ("all", "omp", "stl", "tbb")
+                else 1
+            )
+            key = (procs * threads, procs, threads, int(record.get("problem_scale", 1)))
+            # Every size of a size sweep scales on its own
+            task = record["task"]
+            if int(record.get("problem_size", 0)) > 0:
+                task += f"_size{record['problem_size']}"
+            points[(task, record["impl"])][key].append(
+                float(record["time_sec"])
+            )
+    return points
+
+
+def karp_flatt(speedup: float, workers: int):
+    if workers <= 1 or speedup <= 0.0:
+        return None
+    return (1.0 / speedup - 1.0 / workers) / (1.0 - 1.0 / workers)
+
+
+def build_rows(points: dict, mode: str) -> list[dict]:
+    rows = []
+    for (task, impl), by_point in sorted(points.items()):
+        if impl == "seq":
+            continue
+        seq_times = points.get((task, "seq"), {})
+        seq_base = [t for key, ts in seq_times.items() if key[3] == 1 for t in ts]
+        own_base = [t for key, ts in by_point.items() if key[0] == 1 and key[3] == 1 for t in ts]
+        for workers, procs, threads, scale in sorted(by_point):
+            times = by_point[(workers, procs, threads, scale)]
+            mean = statistics.fmean(times)
+            row = {
+                "task": task,
+                "impl": impl,
+                "workers": workers,
+                "procs": procs,
+                "threads": threads,
+                "problem_scale": scale,
+                "repeats": len(times),
+                "time_mean": mean,
+                "time_stddev": statistics.stdev(times) if len(times) > 1 else 0.0,
+                "speedup": None,
+                "efficiency": None,
+                "karp_flatt": None,
+            }
+            if mode == "strong":
+                base = seq_base or own_base
+                if base and scale == 1 and mean > 0.0:
+                    row["speedup"] = statistics.fmean(base) / mean
+                    row["efficiency"] = row["speedup"] / workers
+            elif own_base and scale == workers and mean > 0.0:
+                row["efficiency"] = statistics.fmean(own_base) / mean
+                row["speedup"] = row["efficiency"] * workers
+            if row["speedup"] is not None:
+                row["karp_flatt"] = karp_flatt(row["speedup"], workers)
+            rows.append(row)
+    return rows
+
+
+def scaling_limits(rows: list[dict]) -> dict:
+    """First worker count at which each (task, impl) drops below EFFICIENCY_THRESHOLD or slows down."""
+    limits = {}
+    by_task = defaultdict(list)
+    for row in rows:
+        if row["speedup"] is not None:
+            by_task[(row["task"], row["impl"])].append(row)
+    for key, task_rows in by_task.items():
+        task_rows.sort(key=lambda r: r["workers"])
+        limits[key] = None
+        best_speedup = 0.0
+        for row in task_rows:
+            if row["workers"] > 1 and (
+                row["efficiency"] < EFFICIENCY_THRESHOLD or row["speedup"] < best_speedup
+            ):
+                limits[key] = row["workers"]
+                break
+            best_speedup = max(best_speedup, row["speedup"])
+    return limits
+
+
+def write_report(records_path: str, mode: str, output_dir: str) -> str:
+    rows = build_rows(load_points(records_path), mode)
+    os.makedirs(output_dir, exist_ok=True)
+    csv_path = os.path.join(output_dir, f"{mode}_scaling.csv")
+    fields = [
+        "task",
+        "impl",
+        "workers",
+        "procs",
+        "threads",
+        "problem_scale",
+        "repeats",
+        "time_mean",
+        "time_stddev",
+        "speedup",
+        "efficiency",
+        "karp_flatt",
+    ]
+    with open(csv_path, "w", newline="") as csvfile:
+        writer = csv.DictWriter(csvfile, fieldnames=fields)
+        writer.writeheader()
+        for row in rows:
+            writer.writerow({k: ("?" if v is None else v) for k, v in row.items()})
+
+    for (task, impl), limit in sorted(scaling_limits(rows).items()):
+        status = (
+            f"stops scaling at P={limit}"
+            if limit is not None
+            else "scales over the whole sweep"
+        )
+        print(f"{task}:{impl}: {status}")
+    return csv_path
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument(
+        "-i", "--input", required=True, help="Perf records of the sweep (.jsonl)"
+    )
+    parser.add_argument(
+        "-o", "--output", required=True, help="Directory for <mode>_scaling.csv"
+    )
+    parser.add_argument("--mode", choices=["strong", "weak"], default="strong")
+    args = parser.parse_args()
+    print("Scaling report:", write_report(args.input, args.mode, args.output))
@@ -4,15 +4,16 @@
 
 #include <cstdint>
 #include <numeric>
+#include <utility>
 #include <vector>
 
 #include "afanasyev_a_elem_vec_avg/common/include/common.hpp"
 
 namespace afanasyev_a_elem_vec_avg {
 
-AfanasyevAElemVecAvgMPI::AfanasyevAElemVecAvgMPI(const InType &in) {
+AfanasyevAElemVecAvgMPI::AfanasyevAElemVecAvgMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0.0;
 }
 
@@ -2,15 +2,16 @@
 
 #include <cstdint>
 #include <numeric>
+#include <utility>
 #include <vector>
 
 #include "afanasyev_a_elem_vec_avg/common/include/common.hpp"
 
 namespace afanasyev_a_elem_vec_avg {
 
-AfanasyevAElemVecAvgSEQ::AfanasyevAElemVecAvgSEQ(const InType &in) {
+AfanasyevAElemVecAvgSEQ::AfanasyevAElemVecAvgSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0.0;
 }
 
@@ -1,14 +1,17 @@
 #include <gtest/gtest.h>
-#include <mpi.h>
 
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <numeric>
 #include <random>
+#include <span>
+#include <utility>
 
 #include "afanasyev_a_elem_vec_avg/common/include/common.hpp"
 #include "afanasyev_a_elem_vec_avg/mpi/include/ops_mpi.hpp"
 #include "afanasyev_a_elem_vec_avg/seq/include/ops_seq.hpp"
+#include "util/include/dataset_cache.hpp"
 #include "util/include/perf_test_util.hpp"
 
 namespace afanasyev_a_elem_vec_avg {
@@ -16,6 +19,7 @@ namespace afanasyev_a_elem_vec_avg {
 class AfanasyevAElemVecAvgPerfTests : public ppc::util::BaseRunPerfTests<InType, OutType> {
  public:
   static constexpr int kVectorSize = 100000000;
+  static constexpr std::uint64_t kSeed = 42;
 
  protected:
   void SetUp() override {
@@ -23,30 +27,15 @@ class AfanasyevAElemVecAvgPerfTests : public ppc::util::BaseRunPerfTests<InType,
       input_data_ = {};
       expected_output_ = 0.0;
     } else {
-      input_data_.resize(kVectorSize);
-
-      unsigned int seed = 42;
-      int is_mpi_init = 0;
-      MPI_Initialized(&is_mpi_init);
-      if (is_mpi_init != 0) {
-        int rank = 0;
-        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-        if (rank == 0) {
-          std::random_device rd;
-          seed = rd();
+      // вектор из 10^8 элементов генерируется один раз в кэш и дальше отображается из файла
+      const ppc::util::DatasetKey key{.task = "afanasyev_a_elem_vec_avg", .size = kVectorSize, .seed = kSeed};
+      input_data_ = ppc::util::LoadOrGenerateDataset<int>(key, [](std::span<int> chunk, std::size_t first) {
+        std::mt19937 gen(static_cast<std::mt19937::result_type>(ppc::util::DatasetChunkSeed(kSeed, first)));
+        std::uniform_int_distribution<> distrib(-10, 10);
+        for (auto &value : chunk) {
+          value = distrib(gen);
         }
-        MPI_Bcast(&seed, 1, MPI_UNSIGNED, 0, MPI_COMM_WORLD);
-      } else {
-        std::random_device rd;
-        seed = rd();
-      }
-
-      std::mt19937 gen(seed);
-      std::uniform_int_distribution<> distrib(-10, 10);
-
-      for (int i = 0; i < kVectorSize; ++i) {
-        input_data_[i] = distrib(gen);
-      }
+      }).ToVector();
 
       int64_t sum = std::accumulate(input_data_.begin(), input_data_.end(), static_cast<int64_t>(0));
       expected_output_ = static_cast<double>(sum) / kVectorSize;
@@ -59,7 +48,7 @@ class AfanasyevAElemVecAvgPerfTests : public ppc::util::BaseRunPerfTests<InType,
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 
  private:
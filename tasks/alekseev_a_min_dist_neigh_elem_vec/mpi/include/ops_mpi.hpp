@@ -10,7 +10,7 @@ class AlekseevAMinDistNeighElemVecMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit AlekseevAMinDistNeighElemVecMPI(const InType &in);
+  explicit AlekseevAMinDistNeighElemVecMPI(InType in);
 
  private:
   bool ValidationImpl() override;
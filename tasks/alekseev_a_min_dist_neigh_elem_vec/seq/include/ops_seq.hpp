@@ -10,7 +10,7 @@ class AlekseevAMinDistNeighElemVecSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit AlekseevAMinDistNeighElemVecSEQ(const InType &in);
+  explicit AlekseevAMinDistNeighElemVecSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
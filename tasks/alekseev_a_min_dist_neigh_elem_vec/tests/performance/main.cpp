@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <cstddef>
 #include <utility>
 #include <vector>
 
@@ -12,6 +13,7 @@ namespace alekseev_a_min_dist_neigh_elem_vec {
 
 class AlekseevAMinDistNeighElemVecRunPerfTestProcesses : public ppc::util::BaseRunPerfTests<InType, OutType> {
   InType input_data_;
+  std::size_t input_size_ = 0;
 
   void SetUp() override {
     const int vector_size = 100000000;
@@ -19,16 +21,17 @@ class AlekseevAMinDistNeighElemVecRunPerfTestProcesses : public ppc::util::BaseR
     for (int i = 0; i < vector_size; i++) {
       vec[i] = (i % 1000 + 7) * 3;
     }
-    input_data_ = vec;
+    input_data_ = std::move(vec);
   }
 
   bool CheckTestOutputData(OutType &output_data) final {
     auto [first, second] = output_data;
-    return (second == first + 1) && (first >= 0) && (std::cmp_less(second, input_data_.size()));
+    return (second == first + 1) && (first >= 0) && (std::cmp_less(second, input_size_));
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    input_size_ = input_data_.size();
+    return std::move(input_data_);
   }
 };
 
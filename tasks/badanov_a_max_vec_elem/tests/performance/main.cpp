@@ -3,6 +3,7 @@
 #include <climits>
 #include <cstddef>
 #include <random>
+#include <utility>
 
 #include "badanov_a_max_vec_elem/common/include/common.hpp"
 #include "badanov_a_max_vec_elem/mpi/include/ops_mpi.hpp"
@@ -39,7 +40,7 @@ class BadanovAMaxVecElemPerfTests : public ppc::util::BaseRunPerfTests<InType, O
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 };
 
@@ -1,14 +1,15 @@
 #include "balchunayte_z_dot_product/seq/include/ops_seq.hpp"
 
 #include <cstddef>
+#include <utility>
 
 #include "balchunayte_z_dot_product/common/include/common.hpp"
 
 namespace balchunayte_z_dot_product {
 
-BalchunayteZDotProductSEQ::BalchunayteZDotProductSEQ(const InType &in) {
+BalchunayteZDotProductSEQ::BalchunayteZDotProductSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0.0;
 }
 
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <utility>
 #include <vector>
 
 #include "balchunayte_z_dot_product/common/include/common.hpp"
@@ -41,7 +42,7 @@ class DotProductRunPerfTestProcesses : public ppc::util::BaseRunPerfTests<InType
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 
  private:
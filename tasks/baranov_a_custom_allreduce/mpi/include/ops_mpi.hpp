@@ -14,7 +14,7 @@ class BaranovACustomAllreduceMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit BaranovACustomAllreduceMPI(const InType &in);
+  explicit BaranovACustomAllreduceMPI(InType in);
 
   static void CustomAllreduce(void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm,
                               int root = 0);
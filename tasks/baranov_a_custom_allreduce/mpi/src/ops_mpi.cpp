@@ -8,6 +8,7 @@
 #include <cstring>
 #include <exception>
 #include <stdexcept>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -167,19 +168,19 @@ std::vector<T> BaranovACustomAllreduceMPI::GetVectorFromVariant(const InTypeVari
 
 template std::vector<double> BaranovACustomAllreduceMPI::GetVectorFromVariant<double>(const InTypeVariant &variant);
 
-BaranovACustomAllreduceMPI::BaranovACustomAllreduceMPI(const InType &in) {
+BaranovACustomAllreduceMPI::BaranovACustomAllreduceMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
   if (std::holds_alternative<std::vector<int>>(in)) {
-    auto vec = std::get<std::vector<int>>(in);
+    const auto &vec = std::get<std::vector<int>>(in);
     GetOutput() = InTypeVariant{std::vector<int>(vec.size(), 0)};
   } else if (std::holds_alternative<std::vector<float>>(in)) {
-    auto vec = std::get<std::vector<float>>(in);
+    const auto &vec = std::get<std::vector<float>>(in);
     GetOutput() = InTypeVariant{std::vector<float>(vec.size(), 0.0F)};
   } else {
-    auto vec = std::get<std::vector<double>>(in);
+    const auto &vec = std::get<std::vector<double>>(in);
     GetOutput() = InTypeVariant{std::vector<double>(vec.size(), 0.0)};
   }
+  GetInput() = std::move(in);
 }
 
 bool BaranovACustomAllreduceMPI::ValidationImpl() {
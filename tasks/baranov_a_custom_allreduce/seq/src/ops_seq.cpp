@@ -2,16 +2,17 @@
 
 #include <cmath>
 #include <exception>
+#include <utility>
 #include <variant>
 
 #include "baranov_a_custom_allreduce/common/include/common.hpp"
 
 namespace baranov_a_custom_allreduce {
 
-BaranovACustomAllreduceSEQ::BaranovACustomAllreduceSEQ(const InType &in) {
+BaranovACustomAllreduceSEQ::BaranovACustomAllreduceSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
   GetOutput() = in;
+  GetInput() = std::move(in);
 }
 
 bool BaranovACustomAllreduceSEQ::ValidationImpl() {
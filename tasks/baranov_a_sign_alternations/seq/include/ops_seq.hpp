@@ -10,7 +10,7 @@ class BaranovASignAlternationsSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit BaranovASignAlternationsSEQ(const InType &in);
+  explicit BaranovASignAlternationsSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -1,15 +1,16 @@
 #include "baranov_a_sign_alternations/seq/include/ops_seq.hpp"
 
 #include <cstddef>
+#include <utility>
 #include <vector>
 
 #include "baranov_a_sign_alternations/common/include/common.hpp"
 
 namespace baranov_a_sign_alternations {
 
-BaranovASignAlternationsSEQ::BaranovASignAlternationsSEQ(const InType &in) {
+BaranovASignAlternationsSEQ::BaranovASignAlternationsSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0;
 }
 
@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <random>
+#include <utility>
 
 #include "baranov_a_sign_alternations/common/include/common.hpp"
 #include "baranov_a_sign_alternations/mpi/include/ops_mpi.hpp"
@@ -35,7 +36,7 @@ class BaranovASignAlternationsPerfTests : public ppc::util::BaseRunPerfTests<InT
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 
  private:
@@ -4,13 +4,14 @@
 
 #include <cstddef>
 #include <limits>
+#include <utility>
 #include <vector>
 
 #include "batkov_f_vector_sum/common/include/common.hpp"
 
 namespace batkov_f_vector_sum {
 
-BatkovFVectorSumMPI::BatkovFVectorSumMPI(const InType &in) {
+BatkovFVectorSumMPI::BatkovFVectorSumMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
 
   int rank = 0;
@@ -22,7 +23,7 @@ BatkovFVectorSumMPI::BatkovFVectorSumMPI(const InType &in) {
   m_mpi_size_ = static_cast<size_t>(mpi_size);
 
   if (m_rank_ == 0) {
-    GetInput() = in;
+    GetInput() = std::move(in);
   } else {
     GetInput() = std::vector<int>();
   }
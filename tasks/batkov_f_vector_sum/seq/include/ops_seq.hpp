@@ -10,7 +10,7 @@ class BatkovFVectorSumSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit BatkovFVectorSumSEQ(const InType &in);
+  explicit BatkovFVectorSumSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -4,6 +4,7 @@
 #include <fstream>
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 #include "batkov_f_vector_sum/common/include/common.hpp"
 #include "batkov_f_vector_sum/mpi/include/ops_mpi.hpp"
@@ -46,7 +47,7 @@ class BatkovFRunPerfTestProcesses : public ppc::util::BaseRunPerfTests<InType, O
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 };
 
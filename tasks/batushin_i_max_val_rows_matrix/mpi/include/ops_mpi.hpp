@@ -10,7 +10,7 @@ class BatushinIMaxValRowsMatrixMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit BatushinIMaxValRowsMatrixMPI(const InType &in);
+  explicit BatushinIMaxValRowsMatrixMPI(InType in);
 
  private:
   bool ValidationImpl() override;
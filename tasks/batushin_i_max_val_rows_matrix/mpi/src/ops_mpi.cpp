@@ -11,9 +11,9 @@
 
 namespace batushin_i_max_val_rows_matrix {
 
-BatushinIMaxValRowsMatrixMPI::BatushinIMaxValRowsMatrixMPI(const InType &in) {
+BatushinIMaxValRowsMatrixMPI::BatushinIMaxValRowsMatrixMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = std::vector<double>();
 }
 
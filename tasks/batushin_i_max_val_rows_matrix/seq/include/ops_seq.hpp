@@ -10,7 +10,7 @@ class BatushinIMaxValRowsMatrixSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit BatushinIMaxValRowsMatrixSEQ(const InType &in);
+  explicit BatushinIMaxValRowsMatrixSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "batushin_i_max_val_rows_matrix/common/include/common.hpp"
@@ -39,7 +40,7 @@ class BatushinIMaxValRowsMatrixPerfTests : public ppc::util::BaseRunPerfTests<In
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 };
 
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace belov_e_lexico_order_two_strings {
+
+// Words of a space-separated string stored back to back in one buffer: word i is chars[offsets[i], offsets[i + 1]).
+// Every space ends a word, so consecutive spaces produce empty words; a trailing space does not start a new one.
+struct PackedWords {
+  std::string chars;
+  std::vector<int> offsets{0};
+
+  [[nodiscard]] int Size() const {
+    return static_cast<int>(offsets.size()) - 1;
+  }
+
+  [[nodiscard]] int WordLength(int i) const {
+    return offsets[static_cast<std::size_t>(i) + 1] - offsets[static_cast<std::size_t>(i)];
+  }
+
+  [[nodiscard]] std::string_view Word(int i) const {
+    return std::string_view(chars).substr(static_cast<std::size_t>(offsets[static_cast<std::size_t>(i)]),
+                                          static_cast<std::size_t>(WordLength(i)));
+  }
+};
+
+inline PackedWords PackWords(const std::string &str) {
+  PackedWords packed;
+  packed.chars.reserve(str.size());
+  std::size_t pos = 0;
+  for (std::size_t space = str.find(' '); space != std::string::npos; space = str.find(' ', pos)) {
+    packed.chars.append(str, pos, space - pos);
+    packed.offsets.push_back(static_cast<int>(packed.chars.size()));
+    pos = space + 1;
+  }
+  if (pos < str.size()) {
+    packed.chars.append(str, pos);
+    packed.offsets.push_back(static_cast<int>(packed.chars.size()));
+  }
+  return packed;
+}
+
+struct ChunkAns {
+  int index;
+  int cmp_flag;
+};
+
+// Finds the first word in [begin, end) that differs between the two lists.
+// Returns its index and -1/1 when the word of `first` is smaller/greater, or index -1 if the range is equal.
+inline ChunkAns ChunkCheck(const PackedWords &first, const PackedWords &second, int begin, int end) {
+  for (int i = begin; i < end; i++) {
+    const int cmp = first.Word(i).compare(second.Word(i));
+    if (cmp != 0) {
+      return {.index = i, .cmp_flag = cmp < 0 ? -1 : 1};
+    }
+  }
+  return {.index = -1, .cmp_flag = 0};
+}
+
+}  // namespace belov_e_lexico_order_two_strings
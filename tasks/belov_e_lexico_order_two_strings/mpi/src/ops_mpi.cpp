@@ -3,165 +3,196 @@
 #include <mpi.h>
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "belov_e_lexico_order_two_strings/common/include/common.hpp"
+#include "belov_e_lexico_order_two_strings/common/include/packed_words.hpp"
 
 namespace belov_e_lexico_order_two_strings {
-BelovELexicoOrderTwoStringsMPI::BelovELexicoOrderTwoStringsMPI(const InType &in) {
-  SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
-  GetOutput() = false;
-}
 
-bool BelovELexicoOrderTwoStringsMPI::ValidationImpl() {
-  return !std::get<0>(GetInput()).empty() && !std::get<1>(GetInput()).empty();
+namespace {
+
+// Words compared between two progress checks. Small enough that ranks stop soon after a lower-indexed rank
+// finds a difference, large enough that the checks stay cheap compared to the scan.
+constexpr int kProbeWords = 1 << 14;
+
+// A found difference is reduced as 2 * index + (first word greater ? 1 : 0), so a single MPI_MIN yields both the
+// lowest differing index across ranks and the comparison result at that index.
+constexpr std::int64_t kNoDifference = std::numeric_limits<std::int64_t>::max();
+
+std::int64_t EncodeDifference(int index, int cmp_flag) {
+  return (2 * static_cast<std::int64_t>(index)) + (cmp_flag < 0 ? 0 : 1);
 }
 
-bool BelovELexicoOrderTwoStringsMPI::PreProcessingImpl() {
-  std::vector<std::string> temp;
-  std::string current;
-  for (auto &ch : std::get<0>(GetInput())) {
-    if (ch == ' ') {
-      temp.push_back(current);
-      current = "";
-    } else {
-      current += ch;
-    }
-  }
-  if (!current.empty()) {
-    temp.push_back(current);
-  }
-  std::get<0>(GetProccesedInput()) = temp;
-
-  std::vector<std::string>().swap(temp);
-  current = "";
-  for (auto &ch : std::get<1>(GetInput())) {
-    if (ch == ' ') {
-      temp.push_back(current);
-      current = "";
-    } else {
-      current += ch;
-    }
-  }
-  if (!current.empty()) {
-    temp.push_back(current);
+struct WordBlocks {
+  int chunk;
+  int n;
+
+  [[nodiscard]] int Begin(int proc) const {
+    return std::min(n, proc * chunk);
   }
-  std::get<1>(GetProccesedInput()) = temp;
 
-  return !std::get<0>(GetProccesedInput()).empty() && !std::get<1>(GetProccesedInput()).empty();
-}
+  [[nodiscard]] int End(int proc) const {
+    return std::min(n, Begin(proc) + chunk);
+  }
+};
 
-ChunkAns ChunkCheck(const std::vector<std::string> &first, const std::vector<std::string> &second, int begin, int end) {
-  ChunkAns ans{.index = -1, .cmp_flag = 0};
+void AppendBlock(const PackedWords &words, int begin, int end, std::vector<int> &lengths, std::string &chars) {
   for (int i = begin; i < end; i++) {
-    if (first[i] < second[i]) {
-      ans = {.index = i, .cmp_flag = -1};
-      return ans;
-    }
-    if (first[i] > second[i]) {
-      ans = {.index = i, .cmp_flag = 1};
-      return ans;
-    }
+    lengths.push_back(words.WordLength(i));
   }
-  return ans;
+  const auto first_char = static_cast<std::size_t>(words.offsets[static_cast<std::size_t>(begin)]);
+  const auto last_char = static_cast<std::size_t>(words.offsets[static_cast<std::size_t>(end)]);
+  chars.append(words.chars, first_char, last_char - first_char);
 }
 
-int CeilDiv(int a, int b) {
-  return (a + b - 1) / b;
+PackedWords UnpackBlock(const std::string &chars, std::size_t &char_pos, const int *lengths, int count) {
+  PackedWords words;
+  words.offsets.reserve(static_cast<std::size_t>(count) + 1);
+  for (int i = 0; i < count; i++) {
+    words.offsets.push_back(words.offsets.back() + lengths[i]);
+  }
+  const auto block_chars = static_cast<std::size_t>(words.offsets.back());
+  words.chars.assign(chars, char_pos, block_chars);
+  char_pos += block_chars;
+  return words;
 }
 
-void BcastVectorOfStrings(std::vector<std::string> &vec, int n, MPI_Comm comm) {
-  int rank = 0;
-  MPI_Comm_rank(comm, &rank);
-
-  if (rank != 0) {
-    vec.resize(n);
-  }
+// Sends every rank its block of words of both lists: one MPI_Scatterv for the word lengths and one for the
+// characters, instead of a pair of broadcasts per word.
+std::tuple<PackedWords, PackedWords> ScatterWordBlocks(const PackedWords &first, const PackedWords &second,
+                                                       const WordBlocks &blocks, int rank, int mpi_size) {
+  std::vector<int> send_lengths;
+  std::string send_chars;
+  std::vector<int> length_counts(static_cast<std::size_t>(mpi_size));
+  std::vector<int> length_displs(static_cast<std::size_t>(mpi_size));
+  std::vector<int> char_counts(static_cast<std::size_t>(mpi_size));
+  std::vector<int> char_displs(static_cast<std::size_t>(mpi_size));
 
-  for (int i = 0; i < n; i++) {
-    int len = 0;
-    if (rank == 0) {
-      len = static_cast<int>(vec[i].size());
+  if (rank == 0) {
+    send_lengths.reserve(2 * static_cast<std::size_t>(blocks.n));
+    send_chars.reserve(first.chars.size() + second.chars.size());
+    for (int proc = 0; proc < mpi_size; proc++) {
+      const auto proc_z = static_cast<std::size_t>(proc);
+      length_displs[proc_z] = static_cast<int>(send_lengths.size());
+      char_displs[proc_z] = static_cast<int>(send_chars.size());
+      AppendBlock(first, blocks.Begin(proc), blocks.End(proc), send_lengths, send_chars);
+      AppendBlock(second, blocks.Begin(proc), blocks.End(proc), send_lengths, send_chars);
+      length_counts[proc_z] = static_cast<int>(send_lengths.size()) - length_displs[proc_z];
+      char_counts[proc_z] = static_cast<int>(send_chars.size()) - char_displs[proc_z];
     }
+  }
 
-    MPI_Bcast(&len, 1, MPI_INT, 0, comm);
-
-    if (rank != 0) {
-      vec[i].resize(len);
-    }
+  const int local_n = blocks.End(rank) - blocks.Begin(rank);
+  std::vector<int> lengths(2 * static_cast<std::size_t>(local_n));
+  MPI_Scatterv(send_lengths.data(), length_counts.data(), length_displs.data(), MPI_INT, lengths.data(),
+               static_cast<int>(lengths.size()), MPI_INT, 0, MPI_COMM_WORLD);
 
-    MPI_Bcast(vec[i].data(), len, MPI_CHAR, 0, comm);
+  int local_chars = 0;
+  for (int len : lengths) {
+    local_chars += len;
   }
+  std::string chars(static_cast<std::size_t>(local_chars), '\0');
+  MPI_Scatterv(send_chars.data(), char_counts.data(), char_displs.data(), MPI_CHAR, chars.data(), local_chars,
+               MPI_CHAR, 0, MPI_COMM_WORLD);
+
+  std::size_t char_pos = 0;
+  PackedWords local_first = UnpackBlock(chars, char_pos, lengths.data(), local_n);
+  PackedWords local_second = UnpackBlock(chars, char_pos, lengths.data() + local_n, local_n);
+  return {std::move(local_first), std::move(local_second)};
 }
 
-bool BelovELexicoOrderTwoStringsMPI::RunImpl() {
-  int mpi_size = 0;
-  int rank = 0;
-
-  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+// Scans the local block in slices of kProbeWords words. After every slice the ranks agree on the lowest difference
+// found so far; a rank stops as soon as that difference lies before its next unscanned word, because nothing it
+// could still find would come first. Returns the encoded lowest difference, or kNoDifference.
+std::int64_t FindFirstDifference(const PackedWords &first, const PackedWords &second, int global_begin) {
+  const int local_n = first.Size();
+  int pos = 0;
+  bool active = local_n > 0;
+  std::int64_t local_best = kNoDifference;
+  std::array<std::int64_t, 2> global_state{kNoDifference, 0};
+
+  do {
+    if (active) {
+      const ChunkAns ans = ChunkCheck(first, second, pos, std::min(local_n, pos + kProbeWords));
+      if (ans.index >= 0) {
+        local_best = EncodeDifference(global_begin + ans.index, ans.cmp_flag);
+        active = false;
+      } else {
+        pos = std::min(local_n, pos + kProbeWords);
+        active = pos < local_n;
+      }
+    }
 
-  std::vector<std::string> first;
-  std::vector<std::string> second;
+    const std::array<std::int64_t, 2> local_state{local_best, active ? 0 : 1};
+    MPI_Allreduce(local_state.data(), global_state.data(), 2, MPI_INT64_T, MPI_MIN, MPI_COMM_WORLD);
 
-  int n1 = 0;
-  int n2 = 0;
-  int n = 0;
+    if (active && global_state[0] != kNoDifference && global_state[0] / 2 < global_begin + pos) {
+      active = false;
+    }
+  } while (global_state[1] == 0);
 
-  if (rank == 0) {
-    first = std::get<0>(GetProccesedInput());
-    second = std::get<1>(GetProccesedInput());
+  return global_state[0];
+}
 
-    n1 = static_cast<int>(first.size());
-    n2 = static_cast<int>(second.size());
-  }
+}  // namespace
 
-  MPI_Bcast(&n1, 1, MPI_INT, 0, MPI_COMM_WORLD);
-  MPI_Bcast(&n2, 1, MPI_INT, 0, MPI_COMM_WORLD);
+BelovELexicoOrderTwoStringsMPI::BelovELexicoOrderTwoStringsMPI(InType in) {
+  SetTypeOfTask(GetStaticTypeOfTask());
+  GetInput() = std::move(in);
+  GetOutput() = false;
+}
 
-  n = std::min(n1, n2);
+bool BelovELexicoOrderTwoStringsMPI::ValidationImpl() {
+  return !std::get<0>(GetInput()).empty() && !std::get<1>(GetInput()).empty();
+}
 
-  BcastVectorOfStrings(first, n, MPI_COMM_WORLD);
-  BcastVectorOfStrings(second, n, MPI_COMM_WORLD);
+bool BelovELexicoOrderTwoStringsMPI::PreProcessingImpl() {
+  std::get<0>(GetProccesedInput()) = PackWords(std::get<0>(GetInput()));
+  std::get<1>(GetProccesedInput()) = PackWords(std::get<1>(GetInput()));
 
-  int chunk = CeilDiv(n, mpi_size);
-  int begin = rank * chunk;
-  int end = std::min(n, begin + chunk);
+  return std::get<0>(GetProccesedInput()).Size() > 0 && std::get<1>(GetProccesedInput()).Size() > 0;
+}
 
-  ChunkAns local_ans = {.index = -1, .cmp_flag = 0};
+int CeilDiv(int a, int b) {
+  return (a + b - 1) / b;
+}
 
-  local_ans = ChunkCheck(first, second, begin, end);
+bool BelovELexicoOrderTwoStringsMPI::RunImpl() {
+  int mpi_size = 0;
+  int rank = 0;
 
-  std::vector<ChunkAns> results(mpi_size);
-  MPI_Gather(&local_ans, sizeof(ChunkAns), MPI_BYTE, results.data(), sizeof(ChunkAns), MPI_BYTE, 0, MPI_COMM_WORLD);
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 
-  bool result = false;
+  const PackedWords &first = std::get<0>(GetProccesedInput());
+  const PackedWords &second = std::get<1>(GetProccesedInput());
 
+  std::array<int, 2> sizes{};
   if (rank == 0) {
-    int best_index = std::numeric_limits<int>::max();
-    int cmp_ans = 0;
-
-    for (auto &p : results) {
-      if (p.index >= 0 && p.index < best_index) {
-        best_index = p.index;
-        cmp_ans = p.cmp_flag;
-      }
-    }
-    if (best_index != std::numeric_limits<int>::max()) {
-      result = (cmp_ans < 0);
-    } else {
-      result = (n1 < n2);
-    }
+    sizes = {first.Size(), second.Size()};
   }
+  MPI_Bcast(sizes.data(), 2, MPI_INT, 0, MPI_COMM_WORLD);
+
+  const int n = std::min(sizes[0], sizes[1]);
+  const WordBlocks blocks{.chunk = CeilDiv(n, mpi_size), .n = n};
 
-  MPI_Bcast(&result, 1, MPI_C_BOOL, 0, MPI_COMM_WORLD);
+  const auto [local_first, local_second] = ScatterWordBlocks(first, second, blocks, rank, mpi_size);
+  const std::int64_t difference = FindFirstDifference(local_first, local_second, blocks.Begin(rank));
 
-  GetOutput() = result;
+  if (difference != kNoDifference) {
+    GetOutput() = (difference % 2) == 0;
+  } else {
+    GetOutput() = sizes[0] < sizes[1];
+  }
 
-  MPI_Barrier(MPI_COMM_WORLD);
   return true;
 }
 
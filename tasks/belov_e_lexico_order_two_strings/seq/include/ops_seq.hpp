@@ -1,10 +1,9 @@
 #pragma once
 
-#include <string>
 #include <tuple>
-#include <vector>
 
 #include "belov_e_lexico_order_two_strings/common/include/common.hpp"
+#include "belov_e_lexico_order_two_strings/common/include/packed_words.hpp"
 #include "task/include/task.hpp"
 
 namespace belov_e_lexico_order_two_strings {
@@ -13,11 +12,11 @@ class BelovELexicoOrderTwoStringsSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit BelovELexicoOrderTwoStringsSEQ(const InType &in);
+  explicit BelovELexicoOrderTwoStringsSEQ(InType in);
 
  private:
-  std::tuple<std::vector<std::string>, std::vector<std::string>> proccesed_input_;
-  std::tuple<std::vector<std::string>, std::vector<std::string>> &GetProccesedInput() {
+  std::tuple<PackedWords, PackedWords> proccesed_input_;
+  std::tuple<PackedWords, PackedWords> &GetProccesedInput() {
     return proccesed_input_;
   }
 
@@ -1,15 +1,17 @@
 #include "belov_e_lexico_order_two_strings/seq/include/ops_seq.hpp"
 
-#include <string>
-#include <vector>
+#include <algorithm>
+#include <tuple>
+#include <utility>
 
 #include "belov_e_lexico_order_two_strings/common/include/common.hpp"
+#include "belov_e_lexico_order_two_strings/common/include/packed_words.hpp"
 
 namespace belov_e_lexico_order_two_strings {
 
-BelovELexicoOrderTwoStringsSEQ::BelovELexicoOrderTwoStringsSEQ(const InType &in) {
+BelovELexicoOrderTwoStringsSEQ::BelovELexicoOrderTwoStringsSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = false;
 }
 
@@ -17,63 +19,21 @@ bool BelovELexicoOrderTwoStringsSEQ::ValidationImpl() {
   return !std::get<0>(GetInput()).empty() && !std::get<1>(GetInput()).empty();
 }
 bool BelovELexicoOrderTwoStringsSEQ::PreProcessingImpl() {
-  std::vector<std::string> temp;
-  std::string current;
-  for (auto &ch : std::get<0>(GetInput())) {
-    if (ch == ' ') {
-      temp.push_back(current);
-      current = "";
-    } else {
-      current += ch;
-    }
-  }
-  if (!current.empty()) {
-    temp.push_back(current);
-  }
-  std::get<0>(GetProccesedInput()) = temp;
-
-  std::vector<std::string>().swap(temp);
-  current = "";
-  for (auto &ch : std::get<1>(GetInput())) {
-    if (ch == ' ') {
-      temp.push_back(current);
-      current = "";
-    } else {
-      current += ch;
-    }
-  }
-  if (!current.empty()) {
-    temp.push_back(current);
-  }
-  std::get<1>(GetProccesedInput()) = temp;
+  std::get<0>(GetProccesedInput()) = PackWords(std::get<0>(GetInput()));
+  std::get<1>(GetProccesedInput()) = PackWords(std::get<1>(GetInput()));
 
-  return !std::get<0>(GetProccesedInput()).empty() && !std::get<1>(GetProccesedInput()).empty();
+  return std::get<0>(GetProccesedInput()).Size() > 0 && std::get<1>(GetProccesedInput()).Size() > 0;
 }
 
 bool BelovELexicoOrderTwoStringsSEQ::RunImpl() {
-  const std::vector<std::string> &first = std::get<0>(GetProccesedInput());
-  const std::vector<std::string> &second = std::get<1>(GetProccesedInput());
+  const PackedWords &first = std::get<0>(GetProccesedInput());
+  const PackedWords &second = std::get<1>(GetProccesedInput());
 
-  bool flag = false;
-  bool ans = false;
-  auto iter1 = first.begin();
-  auto iter2 = second.begin();
-  for (; iter1 != first.end() && iter2 != second.end(); iter1++, iter2++) {
-    if (*iter1 < *iter2) {
-      ans = true;
-      flag = true;
-      break;
-    }
-    if (*iter1 != *iter2) {
-      ans = false;
-      flag = true;
-      break;
-    }
-  }
-  if (flag) {
-    GetOutput() = ans;
+  const ChunkAns ans = ChunkCheck(first, second, 0, std::min(first.Size(), second.Size()));
+  if (ans.index >= 0) {
+    GetOutput() = ans.cmp_flag < 0;
   } else {
-    GetOutput() = (iter1 == first.end()) && (iter2 != second.end());
+    GetOutput() = first.Size() < second.Size();
   }
 
   return true;
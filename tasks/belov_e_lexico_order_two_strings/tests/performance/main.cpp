@@ -3,6 +3,7 @@
 #include <ctime>
 #include <string>
 #include <tuple>
+#include <utility>
 
 #include "belov_e_lexico_order_two_strings/common/include/common.hpp"
 #include "belov_e_lexico_order_two_strings/mpi/include/ops_mpi.hpp"
@@ -27,7 +28,7 @@ class BelovERunPerfTestsProcesses : public ppc::util::BaseRunPerfTests<InType, O
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 
   static std::tuple<std::string, std::string, int> GenerateDataForPerf(size_t size) {
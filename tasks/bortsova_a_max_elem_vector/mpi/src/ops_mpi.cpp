@@ -5,15 +5,16 @@
 #include <algorithm>
 #include <cstddef>
 #include <limits>
+#include <utility>
 #include <vector>
 
 #include "bortsova_a_max_elem_vector/common/include/common.hpp"
 
 namespace bortsova_a_max_elem_vector {
 
-BortsovaAMaxElemVectorMpi::BortsovaAMaxElemVectorMpi(const InType &in) {
+BortsovaAMaxElemVectorMpi::BortsovaAMaxElemVectorMpi(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = std::numeric_limits<int>::min();
 }
 
@@ -54,7 +54,7 @@ class BortsovaAMaxElemVectorPerfTests : public ppc::util::BaseRunPerfTests<InTyp
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 };
 
@@ -13,7 +13,7 @@ class BorunovVCntWordsMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit BorunovVCntWordsMPI(const InType &in);
+  explicit BorunovVCntWordsMPI(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -5,15 +5,16 @@
 #include <cctype>
 #include <cstdint>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "borunov_v_cnt_words/common/include/common.hpp"
 
 namespace borunov_v_cnt_words {
 
-BorunovVCntWordsMPI::BorunovVCntWordsMPI(const InType &in) {
+BorunovVCntWordsMPI::BorunovVCntWordsMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0;
 }
 
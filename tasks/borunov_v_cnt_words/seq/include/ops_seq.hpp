@@ -10,7 +10,7 @@ class BorunovVCntWordsSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit BorunovVCntWordsSEQ(const InType &in);
+  explicit BorunovVCntWordsSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
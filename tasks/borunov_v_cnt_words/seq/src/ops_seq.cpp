@@ -7,9 +7,9 @@
 
 namespace borunov_v_cnt_words {
 
-BorunovVCntWordsSEQ::BorunovVCntWordsSEQ(const InType &in) {
+BorunovVCntWordsSEQ::BorunovVCntWordsSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0;
 }
 
@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <string>
+#include <utility>
 
 #include "borunov_v_cnt_words/common/include/common.hpp"
 #include "borunov_v_cnt_words/mpi/include/ops_mpi.hpp"
@@ -30,7 +31,7 @@ class BorunovVCntWordsPerfTests : public ppc::util::BaseRunPerfTests<InType, Out
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 
  private:
@@ -10,7 +10,7 @@ class BuzulukskiyDMaxValueMatrixElementsMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit BuzulukskiyDMaxValueMatrixElementsMPI(const InType &in);
+  explicit BuzulukskiyDMaxValueMatrixElementsMPI(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -10,7 +10,7 @@ class BuzulukskiyDMaxValueMatrixElementsSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit BuzulukskiyDMaxValueMatrixElementsSEQ(const InType &in);
+  explicit BuzulukskiyDMaxValueMatrixElementsSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <utility>
 #include <vector>
 
 #include "buzulukskiy_d_max_value_matrix_elements/common/include/common.hpp"
@@ -35,7 +36,7 @@ class BuzulukskiyDMaxValueMatrixElementsPerfTests : public ppc::util::BaseRunPer
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 
  private:
@@ -13,7 +13,7 @@ class ChernovTMaxMatrixColumnsMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit ChernovTMaxMatrixColumnsMPI(const InType &in);
+  explicit ChernovTMaxMatrixColumnsMPI(InType in);
 
  private:
   bool ValidationImpl() override;
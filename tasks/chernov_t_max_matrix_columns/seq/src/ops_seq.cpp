@@ -2,15 +2,16 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <utility>
 #include <vector>
 
 #include "chernov_t_max_matrix_columns/common/include/common.hpp"
 
 namespace chernov_t_max_matrix_columns {
 
-ChernovTMaxMatrixColumnsSEQ::ChernovTMaxMatrixColumnsSEQ(const InType &in) {
+ChernovTMaxMatrixColumnsSEQ::ChernovTMaxMatrixColumnsSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = std::vector<int>();
 }
 
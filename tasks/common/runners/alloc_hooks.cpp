@@ -0,0 +1,88 @@
+// Counting replacements of the global operator new for ppc_perf_tests. Array and nothrow forms forward to these
+// in the standard libraries, so every allocation made through new is seen by ppc::util::CountAllocation.
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#  include <malloc.h>
+#endif
+
+#include "util/include/memory_usage.hpp"
+
+namespace {
+
+void *Allocate(std::size_t size) {
+  ppc::util::CountAllocation(size);
+  if (size == 0) {
+    size = 1;
+  }
+  while (true) {
+    void *ptr = std::malloc(size);
+    if (ptr != nullptr) {
+      return ptr;
+    }
+    auto *handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+void *AllocateAligned(std::size_t size, std::align_val_t alignment) {
+  ppc::util::CountAllocation(size);
+  const auto align = static_cast<std::size_t>(alignment);
+  // aligned_alloc requires the size to be a multiple of the alignment
+  const std::size_t padded = size == 0 ? align : (size + align - 1) / align * align;
+  while (true) {
+#ifdef _WIN32
+    void *ptr = _aligned_malloc(padded, align);
+#else
+    void *ptr = std::aligned_alloc(align, padded);
+#endif
+    if (ptr != nullptr) {
+      return ptr;
+    }
+    auto *handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+const bool kHookInstalled = [] {
+  ppc::util::MarkAllocationHookInstalled();
+  return true;
+}();
+
+}  // namespace
+
+void *operator new(std::size_t size) {
+  return Allocate(size);
+}
+
+void operator delete(void *ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t /*size*/) noexcept {
+  std::free(ptr);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment) {
+  return AllocateAligned(size, alignment);
+}
+
+void operator delete(void *ptr, std::align_val_t /*alignment*/) noexcept {
+#ifdef _WIN32
+  _aligned_free(ptr);
+#else
+  std::free(ptr);
+#endif
+}
+
+void operator delete(void *ptr, std::size_t /*size*/, std::align_val_t alignment) noexcept {
+  operator delete(ptr, alignment);
+}
@@ -0,0 +1,133 @@
+// PMPI interposition for ppc_perf_tests: each wrapper forwards to the PMPI_ entry point and, while the profiler
+// is active, records the call site, the buffer size and the time spent in the call. While the tracer is on, every
+// call also becomes a span of the timeline.
+#include <mpi.h>
+
+#include <cstdint>
+
+#include "runners/include/mpi_profiler.hpp"
+#include "util/include/trace.hpp"
+
+#ifdef _MSC_VER
+#  include <intrin.h>
+#  define PPC_CALL_SITE() _ReturnAddress()
+#else
+#  define PPC_CALL_SITE() __builtin_return_address(0)
+#endif
+
+namespace {
+
+using ppc::runners::MpiOp;
+using ppc::runners::MpiProfiler;
+
+uint64_t Bytes(int count, MPI_Datatype datatype) {
+  int type_size = 0;
+  PMPI_Type_size(datatype, &type_size);
+  return static_cast<uint64_t>(count) * static_cast<uint64_t>(type_size);
+}
+
+uint64_t Bytes(const int *counts, MPI_Datatype datatype, MPI_Comm comm) {
+  int size = 0;
+  PMPI_Comm_size(comm, &size);
+  uint64_t total = 0;
+  for (int i = 0; i < size; i++) {
+    total += Bytes(counts[i], datatype);
+  }
+  return total;
+}
+
+bool IsRoot(int root, MPI_Comm comm) {
+  int rank = 0;
+  PMPI_Comm_rank(comm, &rank);
+  return rank == root;
+}
+
+// Runs call() and records it unless the profiler is off
+template <typename Call, typename CountBytes>
+int Profile(MpiOp op, const void *call_site, Call call, CountBytes count_bytes) {
+  const ppc::util::TraceSpan span(GetStringMpiOp(op), "mpi");
+  auto &profiler = MpiProfiler::Instance();
+  if (!profiler.Active()) {
+    return call();
+  }
+  const double begin = PMPI_Wtime();
+  const int result = call();
+  const double seconds = PMPI_Wtime() - begin;
+  profiler.Record(op, call_site, count_bytes(), seconds);
+  return result;
+}
+
+}  // namespace
+
+int MPI_Send(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm) {
+  return Profile(MpiOp::kSend, PPC_CALL_SITE(), [&] { return PMPI_Send(buf, count, datatype, dest, tag, comm); },
+                 [&] { return Bytes(count, datatype); });
+}
+
+int MPI_Recv(void *buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Status *status) {
+  MPI_Status local_status;
+  MPI_Status *used_status = status == MPI_STATUS_IGNORE ? &local_status : status;
+  return Profile(
+      MpiOp::kRecv, PPC_CALL_SITE(), [&] { return PMPI_Recv(buf, count, datatype, source, tag, comm, used_status); },
+      [&] {
+        int received = 0;
+        PMPI_Get_count(used_status, datatype, &received);
+        return received == MPI_UNDEFINED ? Bytes(count, datatype) : Bytes(received, datatype);
+      });
+}
+
+int MPI_Bcast(void *buffer, int count, MPI_Datatype datatype, int root, MPI_Comm comm) {
+  return Profile(MpiOp::kBcast, PPC_CALL_SITE(), [&] { return PMPI_Bcast(buffer, count, datatype, root, comm); },
+                 [&] { return Bytes(count, datatype); });
+}
+
+int MPI_Scatterv(const void *sendbuf, const int *sendcounts, const int *displs, MPI_Datatype sendtype, void *recvbuf,
+                 int recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm) {
+  return Profile(
+      MpiOp::kScatterv, PPC_CALL_SITE(),
+      [&] { return PMPI_Scatterv(sendbuf, sendcounts, displs, sendtype, recvbuf, recvcount, recvtype, root, comm); },
+      [&] { return IsRoot(root, comm) ? Bytes(sendcounts, sendtype, comm) : Bytes(recvcount, recvtype); });
+}
+
+int MPI_Gatherv(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, const int *recvcounts,
+                const int *displs, MPI_Datatype recvtype, int root, MPI_Comm comm) {
+  return Profile(
+      MpiOp::kGatherv, PPC_CALL_SITE(),
+      [&] { return PMPI_Gatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, root, comm); },
+      [&] { return IsRoot(root, comm) ? Bytes(recvcounts, recvtype, comm) : Bytes(sendcount, sendtype); });
+}
+
+int MPI_Allgatherv(const void *sendbuf, int sendcount, MPI_Datatype sendtype, void *recvbuf, const int *recvcounts,
+                   const int *displs, MPI_Datatype recvtype, MPI_Comm comm) {
+  return Profile(
+      MpiOp::kAllgatherv, PPC_CALL_SITE(),
+      [&] { return PMPI_Allgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm); },
+      [&] { return Bytes(recvcounts, recvtype, comm); });
+}
+
+int MPI_Allreduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm) {
+  return Profile(MpiOp::kAllreduce, PPC_CALL_SITE(),
+                 [&] { return PMPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm); },
+                 [&] { return Bytes(count, datatype); });
+}
+
+int MPI_Reduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, int root,
+               MPI_Comm comm) {
+  return Profile(MpiOp::kReduce, PPC_CALL_SITE(),
+                 [&] { return PMPI_Reduce(sendbuf, recvbuf, count, datatype, op, root, comm); },
+                 [&] { return Bytes(count, datatype); });
+}
+
+int MPI_Alltoallv(const void *sendbuf, const int *sendcounts, const int *sdispls, MPI_Datatype sendtype, void *recvbuf,
+                  const int *recvcounts, const int *rdispls, MPI_Datatype recvtype, MPI_Comm comm) {
+  return Profile(MpiOp::kAlltoallv, PPC_CALL_SITE(),
+                 [&] {
+                   return PMPI_Alltoallv(sendbuf, sendcounts, sdispls, sendtype, recvbuf, recvcounts, rdispls,
+                                         recvtype, comm);
+                 },
+                 [&] { return Bytes(sendcounts, sendtype, comm); });
+}
+
+int MPI_Barrier(MPI_Comm comm) {
+  return Profile(MpiOp::kBarrier, PPC_CALL_SITE(), [&] { return PMPI_Barrier(comm); }, [] { return uint64_t{0}; });
+}
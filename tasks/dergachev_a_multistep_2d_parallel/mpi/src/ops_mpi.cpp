@@ -10,25 +10,13 @@
 #include <vector>
 
 #include "dergachev_a_multistep_2d_parallel/common/include/common.hpp"
+#include "util/include/collectives.hpp"
+#include "util/include/partition.hpp"
 
 namespace dergachev_a_multistep_2d_parallel {
 
 namespace {
 
-void ComputeDistribution(int num_intervals, int world_size, std::vector<int> &counts, std::vector<int> &displs) {
-  counts.resize(static_cast<std::size_t>(world_size));
-  displs.resize(static_cast<std::size_t>(world_size));
-
-  int base_count = num_intervals / world_size;
-  int remainder = num_intervals % world_size;
-
-  for (int i = 0; i < world_size; ++i) {
-    auto idx = static_cast<std::size_t>(i);
-    counts[idx] = base_count + ((i < remainder) ? 1 : 0);
-    displs[idx] = (i == 0) ? 0 : (displs[idx - 1] + counts[idx - 1]);
-  }
-}
-
 void PrepareIntervalData(const std::vector<double> &t_values, const std::vector<TrialPoint> &trials, int num_intervals,
                          std::vector<double> &interval_data) {
   interval_data.resize(static_cast<std::size_t>(num_intervals) * 4);
@@ -57,41 +45,11 @@ void ComputeLocalCharacteristics(const std::vector<double> &local_interval_data,
   }
 }
 
-void GatherResultsToRoot(const std::vector<double> &local_chars, const std::vector<int> &counts,
-                         const std::vector<int> &displs, int world_rank, int world_size,
-                         std::vector<double> &characteristics) {
-  int local_count = counts[static_cast<std::size_t>(world_rank)];
-
-  if (world_rank == 0) {
-    for (int i = 0; i < counts[0]; ++i) {
-      characteristics[static_cast<std::size_t>(i)] = local_chars[static_cast<std::size_t>(i)];
-    }
-
-    for (int proc = 1; proc < world_size; ++proc) {
-      auto proc_idx = static_cast<std::size_t>(proc);
-      int proc_count = counts[proc_idx];
-      if (proc_count > 0) {
-        std::vector<double> recv_chars(static_cast<std::size_t>(proc_count));
-        MPI_Recv(recv_chars.data(), proc_count, MPI_DOUBLE, proc, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-        int disp = displs[proc_idx];
-        for (int i = 0; i < proc_count; ++i) {
-          characteristics[static_cast<std::size_t>(disp) + static_cast<std::size_t>(i)] =
-              recv_chars[static_cast<std::size_t>(i)];
-        }
-      }
-    }
-  } else {
-    if (local_count > 0) {
-      MPI_Send(local_chars.data(), local_count, MPI_DOUBLE, 0, 0, MPI_COMM_WORLD);
-    }
-  }
-}
-
 }  // namespace
 
-DergachevAMultistep2dParallelMPI::DergachevAMultistep2dParallelMPI(const InType &in) {
+DergachevAMultistep2dParallelMPI::DergachevAMultistep2dParallelMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = OutType();
 
   MPI_Comm_rank(MPI_COMM_WORLD, &world_rank_);
@@ -278,37 +236,20 @@ void DergachevAMultistep2dParallelMPI::ComputeCharacteristicsParallel(double m_v
     return;
   }
 
-  std::vector<int> counts;
-  std::vector<int> displs;
-  ComputeDistribution(num_intervals, world_size_, counts, displs);
+  const auto parts = ppc::util::BlockPartition(num_intervals, world_size_);
 
   std::vector<double> interval_data;
   if (world_rank_ == 0) {
     PrepareIntervalData(t_values_, trials_, num_intervals, interval_data);
-  } else {
-    interval_data.resize(static_cast<std::size_t>(num_intervals) * 4);
   }
 
-  std::vector<int> send_counts(static_cast<std::size_t>(world_size_));
-  std::vector<int> send_displs(static_cast<std::size_t>(world_size_));
-  for (int i = 0; i < world_size_; ++i) {
-    auto idx = static_cast<std::size_t>(i);
-    send_counts[idx] = counts[idx] * 4;
-    send_displs[idx] = displs[idx] * 4;
-  }
-
-  int local_count = counts[static_cast<std::size_t>(world_rank_)];
-  std::vector<double> local_interval_data(static_cast<std::size_t>(local_count) * 4);
-  MPI_Scatterv(interval_data.data(), send_counts.data(), send_displs.data(), MPI_DOUBLE, local_interval_data.data(),
-               local_count * 4, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+  const auto local_interval_data = ppc::util::ScatterPartition(interval_data, parts, 0, MPI_COMM_WORLD, 4);
+  const auto local_count = static_cast<int>(parts[static_cast<std::size_t>(world_rank_)].count);
 
   std::vector<double> local_chars;
   ComputeLocalCharacteristics(local_interval_data, local_count, m_val, local_chars);
 
-  characteristics.resize(static_cast<std::size_t>(num_intervals));
-  GatherResultsToRoot(local_chars, counts, displs, world_rank_, world_size_, characteristics);
-
-  MPI_Bcast(characteristics.data(), num_intervals, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+  characteristics = ppc::util::AllgatherPartition(local_chars, parts, MPI_COMM_WORLD);
 }
 
 int DergachevAMultistep2dParallelMPI::SelectBestInterval(const std::vector<double> &characteristics) {
@@ -11,9 +11,9 @@
 
 namespace dergachev_a_multistep_2d_parallel {
 
-DergachevAMultistep2dParallelSEQ::DergachevAMultistep2dParallelSEQ(const InType &in) {
+DergachevAMultistep2dParallelSEQ::DergachevAMultistep2dParallelSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = OutType();
 }
 
@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <functional>
+#include <utility>
 
 #include "dergachev_a_multistep_2d_parallel/common/include/common.hpp"
 #include "dergachev_a_multistep_2d_parallel/mpi/include/ops_mpi.hpp"
@@ -38,7 +39,7 @@ class DergachevAMultistep2dParallelPerfTests : public ppc::util::BaseRunPerfTest
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 };
 
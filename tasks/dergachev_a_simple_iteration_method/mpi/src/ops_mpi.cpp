@@ -4,33 +4,17 @@
 
 #include <cmath>
 #include <cstddef>
+#include <utility>
 #include <vector>
 
 #include "dergachev_a_simple_iteration_method/common/include/common.hpp"
+#include "util/include/collectives.hpp"
+#include "util/include/partition.hpp"
 
 namespace dergachev_a_simple_iteration_method {
 
 namespace {
 
-void ComputeRowDistribution(int n, int size, std::vector<int> &row_counts, std::vector<int> &row_displs,
-                            std::vector<int> &matrix_counts, std::vector<int> &matrix_displs) {
-  int row_offset = 0;
-  int matrix_offset = 0;
-  for (int proc = 0; proc < size; proc++) {
-    int base_rows = n / size;
-    int extra = (proc < (n % size)) ? 1 : 0;
-    int proc_rows = base_rows + extra;
-
-    row_counts[proc] = proc_rows;
-    row_displs[proc] = row_offset;
-    matrix_counts[proc] = proc_rows * n;
-    matrix_displs[proc] = matrix_offset;
-
-    row_offset += proc_rows;
-    matrix_offset += proc_rows * n;
-  }
-}
-
 int ComputeFinalResult(const std::vector<double> &x, int n) {
   double sum = 0.0;
   for (int i = 0; i < n; i++) {
@@ -59,22 +43,6 @@ void ComputeLocalProduct(const std::vector<double> &local_matrix, const std::vec
   }
 }
 
-void GatherResults(const std::vector<double> &local_x_new, std::vector<double> &x_new,
-                   const std::vector<int> &row_counts, const std::vector<int> &row_displs, int rank, int size,
-                   int local_rows, int start_row) {
-  if (rank == 0) {
-    for (int i = 0; i < local_rows; i++) {
-      x_new[start_row + i] = local_x_new[i];
-    }
-    for (int proc = 1; proc < size; proc++) {
-      MPI_Recv(x_new.data() + row_displs[proc], row_counts[proc], MPI_DOUBLE, proc, 0, MPI_COMM_WORLD,
-               MPI_STATUS_IGNORE);
-    }
-  } else {
-    MPI_Send(local_x_new.data(), local_rows, MPI_DOUBLE, 0, 0, MPI_COMM_WORLD);
-  }
-}
-
 double ComputeLocalDiff(const std::vector<double> &x_new, const std::vector<double> &x, int local_rows, int start_row) {
   double local_diff = 0.0;
   for (int i = 0; i < local_rows; i++) {
@@ -145,14 +113,9 @@ bool DergachevASimpleIterationMethodMPI::RunImpl() {
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
   MPI_Comm_size(MPI_COMM_WORLD, &size);
 
-  std::vector<int> row_counts(size);
-  std::vector<int> row_displs(size);
-  std::vector<int> matrix_counts(size);
-  std::vector<int> matrix_displs(size);
-  ComputeRowDistribution(n, size, row_counts, row_displs, matrix_counts, matrix_displs);
-
-  int local_rows = row_counts[rank];
-  int start_row = row_displs[rank];
+  const auto rows = ppc::util::BlockPartition(n, size);
+  const auto local_rows = static_cast<int>(rows[rank].count);
+  const auto start_row = static_cast<int>(rows[rank].begin);
 
   std::vector<double> flat_matrix;
   std::vector<double> b;
@@ -162,13 +125,8 @@ bool DergachevASimpleIterationMethodMPI::RunImpl() {
     InitializeMatrixAndVector(flat_matrix, b, n);
   }
 
-  std::vector<double> local_matrix(static_cast<std::size_t>(local_rows) * n, 0.0);
-  MPI_Scatterv(flat_matrix.data(), matrix_counts.data(), matrix_displs.data(), MPI_DOUBLE, local_matrix.data(),
-               local_rows * n, MPI_DOUBLE, 0, MPI_COMM_WORLD);
-
-  std::vector<double> local_b(local_rows, 0.0);
-  MPI_Scatterv(b.data(), row_counts.data(), row_displs.data(), MPI_DOUBLE, local_b.data(), local_rows, MPI_DOUBLE, 0,
-               MPI_COMM_WORLD);
+  const auto local_matrix = ppc::util::ScatterPartition(flat_matrix, rows, 0, MPI_COMM_WORLD, n);
+  const auto local_b = ppc::util::ScatterPartition(b, rows, 0, MPI_COMM_WORLD);
 
   const double tau = 0.5;
   const double epsilon = 1e-6;
@@ -176,16 +134,17 @@ bool DergachevASimpleIterationMethodMPI::RunImpl() {
 
   std::vector<double> local_x_new(local_rows, 0.0);
   std::vector<double> x_new(n, 0.0);
+  const auto row_counts = ppc::util::ToMpiCounts(rows);
 
   for (int iteration = 0; iteration < max_iterations; iteration++) {
     ComputeLocalProduct(local_matrix, x, local_b, local_x_new, local_rows, start_row, n, tau);
-    GatherResults(local_x_new, x_new, row_counts, row_displs, rank, size, local_rows, start_row);
-    MPI_Bcast(x_new.data(), n, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+    MPI_Allgatherv(local_x_new.data(), local_rows, MPI_DOUBLE, x_new.data(), row_counts.counts.data(),
+                   row_counts.displs.data(), MPI_DOUBLE, MPI_COMM_WORLD);
 
     double local_diff = ComputeLocalDiff(x_new, x, local_rows, start_row);
     int converged = CheckConvergence(local_diff, epsilon, rank);
 
-    x = x_new;
+    std::swap(x, x_new);
 
     if (converged != 0) {
       break;
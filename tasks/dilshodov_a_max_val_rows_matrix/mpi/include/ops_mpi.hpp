@@ -12,7 +12,7 @@ class MaxValRowsMatrixTaskMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit MaxValRowsMatrixTaskMPI(const InType &in);
+  explicit MaxValRowsMatrixTaskMPI(InType in);
 
  private:
   bool ValidationImpl() override;
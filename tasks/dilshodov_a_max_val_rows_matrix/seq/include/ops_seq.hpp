@@ -10,7 +10,7 @@ class MaxValRowsMatrixTaskSequential : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit MaxValRowsMatrixTaskSequential(const InType &in);
+  explicit MaxValRowsMatrixTaskSequential(InType in);
 
  private:
   bool ValidationImpl() override;
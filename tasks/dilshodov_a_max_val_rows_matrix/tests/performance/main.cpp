@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <random>
+#include <utility>
 
 #include "dilshodov_a_max_val_rows_matrix/common/include/common.hpp"
 #include "dilshodov_a_max_val_rows_matrix/mpi/include/ops_mpi.hpp"
@@ -51,7 +52,7 @@ class DilshodovMaxValRowsMatrixPerfTest : public ppc::util::BaseRunPerfTests<InT
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 };
 
@@ -10,7 +10,7 @@ class ErmakovANumbViolElemVecSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit ErmakovANumbViolElemVecSEQ(const InType &in);
+  explicit ErmakovANumbViolElemVecSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
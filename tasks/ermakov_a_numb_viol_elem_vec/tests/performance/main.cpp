@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <random>
+#include <utility>
 
 #include "ermakov_a_numb_viol_elem_vec/common/include/common.hpp"
 #include "ermakov_a_numb_viol_elem_vec/mpi/include/ops_mpi.hpp"
@@ -42,7 +43,7 @@ class ErmakovANumbViolElemVecPerfTests : public ppc::util::BaseRunPerfTests<InTy
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 
  private:
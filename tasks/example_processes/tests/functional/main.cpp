@@ -1,10 +1,14 @@
 #include <gtest/gtest.h>
+#include <mpi.h>
 #include <stb/stb_image.h>
 
 #include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
 #include <numeric>
 #include <stdexcept>
 #include <string>
@@ -15,7 +19,16 @@
 #include "example_processes/common/include/common.hpp"
 #include "example_processes/mpi/include/ops_mpi.hpp"
 #include "example_processes/seq/include/ops_seq.hpp"
+#include "performance/include/autotune.hpp"
+#include "performance/include/performance.hpp"
+#include "task/include/batch.hpp"
+#include "task/include/comm_groups.hpp"
+#include "task/include/task.hpp"
+#include "util/include/collectives.hpp"
 #include "util/include/func_test_util.hpp"
+#include "util/include/map_reduce.hpp"
+#include "util/include/partition.hpp"
+#include "util/include/perf_test_util.hpp"
 #include "util/include/util.hpp"
 
 namespace nesterov_a_test_task_processes {
@@ -69,6 +82,181 @@ TEST_P(NesterovARunFuncTestsProcesses, MatmulFromPic) {
   ExecuteTest(GetParam());
 }
 
+TEST(NesterovATestTaskProcessesGroups, RunsIndependentInstancesOnRankGroups) {
+  ppc::task::CommGroups groups(std::min(2, ppc::util::GetMPISize()));
+  const InType input = 3 + groups.GroupIndex();
+  NesterovATestTaskMPI task(input);
+  task.SetComm(groups.Group());
+  ASSERT_TRUE(task.Validation());
+  ASSERT_TRUE(task.PreProcessing());
+  ASSERT_TRUE(task.Run());
+  ASSERT_TRUE(task.PostProcessing());
+  EXPECT_EQ(task.GetOutput(), input);
+}
+
+TEST(NesterovATestTaskProcessesGroups, BatchOverRanksCollectsEveryOutput) {
+  const std::vector<InType> inputs = {3, 4, 5, 6, 7};
+  ppc::task::BatchExecutor<InType, OutType> executor(ppc::task::TaskGetter<NesterovATestTaskMPI, InType>, inputs);
+  const auto outputs = executor.Run(ppc::task::BatchMode::kRanks);
+  if (ppc::util::GetMPIRank() == 0) {
+    EXPECT_EQ(outputs, inputs);
+    EXPECT_EQ(executor.GetStats().latencies.size(), inputs.size());
+  } else {
+    EXPECT_TRUE(outputs.empty());
+  }
+}
+
+TEST(NesterovATestTaskProcessesGroups, BatchOverRanksThrowsOnEveryRankIfATaskFails) {
+  // A zero input fails validation; the farm has to stop instead of waiting for its result
+  const std::vector<InType> inputs = {3, 0, 5, 6, 7, 8};
+  ppc::task::BatchExecutor<InType, OutType> executor(ppc::task::TaskGetter<NesterovATestTaskMPI, InType>, inputs);
+  EXPECT_THROW(executor.Run(ppc::task::BatchMode::kRanks), std::runtime_error);
+  ppc::util::DestructorFailureFlag::Unset();
+}
+
+TEST(NesterovATestTaskProcessesGroups, BatchOnThreadsRejectsMpiTasks) {
+  const std::vector<InType> inputs = {3, 4};
+  ppc::task::BatchExecutor<InType, OutType> executor(ppc::task::TaskGetter<NesterovATestTaskMPI, InType>, inputs);
+  EXPECT_THROW(executor.Run(ppc::task::BatchMode::kThreads, 2), std::runtime_error);
+  ppc::util::DestructorFailureFlag::Unset();
+}
+
+TEST(NesterovATestTaskProcessesGroups, AutotuneThrowsOnEveryRankIfTheCacheCannotBeSaved) {
+  // The cache would go into a "directory" that is a regular file, so rank 0 cannot write it
+  const auto blocker = std::filesystem::temp_directory_path() / "ppc_autotune_blocked_cache_dir";
+  if (ppc::util::GetMPIRank() == 0) {
+    std::ofstream(blocker) << "not a directory";
+  }
+  const ppc::performance::TuneTarget target{.task = "autotune_blocked",
+                                            .size = 4,
+                                            .num_proc = ppc::util::GetMPISize(),
+                                            .cache_file = (blocker / "tuning_cache.json").string()};
+  ppc::performance::PerfAttr perf_attr;
+  perf_attr.num_running = 1;
+  ppc::util::SetMpiPerfAttributes(perf_attr);
+  const std::vector<ppc::performance::TuneParam> space = {{.name = "unused", .values = {1}}};
+  const auto make_task = [] { return std::make_shared<NesterovATestTaskMPI>(4); };
+  EXPECT_THROW((ppc::performance::Autotune<InType, OutType>(target, space, make_task, perf_attr)), std::runtime_error);
+  if (ppc::util::GetMPIRank() == 0) {
+    std::filesystem::remove(blocker);
+  }
+}
+
+TEST(NesterovATestTaskProcessesGroups, PartitionCollectivesRoundTripMatrixRows) {
+  const int size = ppc::util::GetMPISize();
+  const int rank = ppc::util::GetMPIRank();
+  constexpr std::int64_t kRows = 7;
+  constexpr std::int64_t kCols = 3;
+  std::vector<double> matrix(static_cast<std::size_t>(kRows * kCols));
+  std::iota(matrix.begin(), matrix.end(), 0.0);
+  const auto parts = ppc::util::BlockPartition(kRows, size);
+
+  const auto local = ppc::util::ScatterPartition(rank == 0 ? matrix : std::vector<double>{}, parts, 0,
+                                                 MPI_COMM_WORLD, kCols);
+  const auto &mine = parts[static_cast<std::size_t>(rank)];
+  ASSERT_EQ(local.size(), static_cast<std::size_t>(mine.count * kCols));
+  if (!local.empty()) {
+    EXPECT_EQ(local.front(), static_cast<double>(mine.begin * kCols));
+  }
+  EXPECT_EQ(ppc::util::AllgatherPartition(local, parts, MPI_COMM_WORLD, kCols), matrix);
+  const auto gathered = ppc::util::GatherPartition(local, parts, 0, MPI_COMM_WORLD, kCols);
+  EXPECT_EQ(gathered, rank == 0 ? matrix : std::vector<double>{});
+}
+
+TEST(NesterovATestTaskProcessesGroups, GatherPartitionAcceptsPartsInAnyOrder) {
+  const int size = ppc::util::GetMPISize();
+  const int rank = ppc::util::GetMPIRank();
+  // Rank 0 owns the last values, so the last part does not end the data
+  std::vector<ppc::util::Range> parts(static_cast<std::size_t>(size));
+  for (int part = 0; part < size; part++) {
+    parts[static_cast<std::size_t>(part)] = {.begin = static_cast<std::int64_t>(size - 1 - part) * 2, .count = 2};
+  }
+  std::vector<int> data(static_cast<std::size_t>(size) * 2);
+  for (std::size_t i = 0; i < data.size(); i++) {
+    data[i] = static_cast<int>(i);
+  }
+
+  const auto local = ppc::util::ScatterPartition(data, parts, 0, MPI_COMM_WORLD);
+  EXPECT_EQ(ppc::util::AllgatherPartition(local, parts, MPI_COMM_WORLD), data);
+  const auto gathered = ppc::util::GatherPartition(local, parts, 0, MPI_COMM_WORLD);
+  EXPECT_EQ(gathered, rank == 0 ? data : std::vector<int>{});
+}
+
+TEST(NesterovATestTaskProcessesGroups, BlockCyclicScatterKeepsGlobalOrder) {
+  const int size = ppc::util::GetMPISize();
+  const int rank = ppc::util::GetMPIRank();
+  constexpr std::int64_t kN = 11;
+  constexpr std::int64_t kBlock = 2;
+  std::vector<std::array<int, 2>> data(static_cast<std::size_t>(kN));
+  for (std::size_t i = 0; i < data.size(); i++) {
+    data[i] = {static_cast<int>(i), -static_cast<int>(i)};
+  }
+
+  const auto local = ppc::util::ScatterBlockCyclic(data, kN, kBlock, 0, MPI_COMM_WORLD);
+  ASSERT_EQ(local.size(), static_cast<std::size_t>(ppc::util::BlockCyclicCount(kN, kBlock, size, rank)));
+  for (const auto &value : local) {
+    EXPECT_EQ(ppc::util::BlockCyclicOwner(value[0], kBlock, size), rank);
+  }
+  const auto gathered = ppc::util::GatherBlockCyclic(local, kN, kBlock, 0, MPI_COMM_WORLD);
+  EXPECT_EQ(gathered, rank == 0 ? data : decltype(data){});
+}
+
+struct DescentKernel {
+  using Value = int;
+  static Value Identity() {
+    return 0;
+  }
+  static Value Map(int current, int next) {
+    return next < current ? 1 : 0;
+  }
+  static Value Combine(Value a, Value b) {
+    return a + b;
+  }
+};
+
+struct LastNonZeroKernel {
+  using Value = int;
+  static constexpr bool kCommutative = false;
+  static Value Identity() {
+    return 0;
+  }
+  static Value Map(int x) {
+    return x;
+  }
+  static Value Combine(Value a, Value b) {
+    return b != 0 ? b : a;
+  }
+};
+
+TEST(NesterovATestTaskProcessesGroups, MapReducePairsCountsBoundaryPairsOnce) {
+  const int rank = ppc::util::GetMPIRank();
+  for (std::size_t n : {0U, 1U, 2U, 3U, 10U, 41U}) {
+    std::vector<int> data(n);
+    for (std::size_t i = 0; i < n; i++) {
+      data[i] = static_cast<int>(i * i % 5);
+    }
+    int expected = 0;
+    for (std::size_t i = 0; i + 1 < n; i++) {
+      expected += data[i + 1] < data[i] ? 1 : 0;
+    }
+    EXPECT_EQ(ppc::util::MapReducePairs<DescentKernel>(data, MPI_COMM_WORLD), expected) << "n = " << n;
+    const auto on_root = rank == 0 ? data : std::vector<int>{};
+    EXPECT_EQ(ppc::util::MapReducePairs<DescentKernel>(on_root, MPI_COMM_WORLD, ppc::util::DataPlacement::kRoot),
+              expected)
+        << "n = " << n;
+  }
+}
+
+TEST(NesterovATestTaskProcessesGroups, MapReduceCombinesRanksInOrder) {
+  const int rank = ppc::util::GetMPIRank();
+  std::vector<int> data(23);
+  data[2] = 5;
+  data[20] = 8;
+  EXPECT_EQ(ppc::util::MapReduce<LastNonZeroKernel>(data, MPI_COMM_WORLD), 8);
+  const auto on_root = rank == 0 ? data : std::vector<int>{};
+  EXPECT_EQ(ppc::util::MapReduce<LastNonZeroKernel>(on_root, MPI_COMM_WORLD, ppc::util::DataPlacement::kRoot), 8);
+}
+
 const std::array<TestType, 3> kTestParam = {std::make_tuple(3, "3"), std::make_tuple(5, "5"), std::make_tuple(7, "7")};
 
 const auto kTestTasksList =
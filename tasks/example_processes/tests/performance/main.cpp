@@ -1,9 +1,16 @@
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <vector>
+
 #include "example_processes/common/include/common.hpp"
 #include "example_processes/mpi/include/ops_mpi.hpp"
 #include "example_processes/seq/include/ops_seq.hpp"
+#include "performance/include/performance.hpp"
+#include "task/include/batch.hpp"
+#include "task/include/task.hpp"
 #include "util/include/perf_test_util.hpp"
+#include "util/include/util.hpp"
 
 namespace nesterov_a_test_task_processes {
 
@@ -37,4 +44,18 @@ const auto kPerfTestName = ExampleRunPerfTestProcesses::CustomPerfTestName;
 
 INSTANTIATE_TEST_SUITE_P(RunModeTests, ExampleRunPerfTestProcesses, kGtestValues, kPerfTestName);
 
+// Throughput of many small instances handed out over the ranks; "_mpi_" in the name runs it with the MPI tasks
+TEST(ExampleBatchPerfTestProcesses, RunBatch_mpi_ranks) {
+  constexpr std::size_t kBatchSize = 200;
+  const std::vector<InType> inputs(kBatchSize, 10);
+  ppc::task::BatchExecutor<InType, OutType> executor(ppc::task::TaskGetter<NesterovATestTaskMPI, InType>, inputs);
+  const auto outputs = executor.Run(ppc::task::BatchMode::kRanks);
+  if (ppc::util::GetMPIRank() == 0) {
+    ASSERT_EQ(outputs, inputs);
+    const auto results = ppc::performance::MakeBatchPerfResults(executor.GetStats());
+    ppc::performance::PrintBatchStatistic("example_processes_mpi_enabled", results);
+    EXPECT_EQ(results.batch.num_tasks, kBatchSize);
+  }
+}
+
 }  // namespace nesterov_a_test_task_processes
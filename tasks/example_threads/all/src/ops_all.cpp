@@ -3,12 +3,13 @@
 #include <mpi.h>
 
 #include <atomic>
+#include <cstddef>
 #include <numeric>
-#include <thread>
 #include <vector>
 
 #include "example_threads/common/include/common.hpp"
 #include "oneapi/tbb/parallel_for.h"
+#include "util/include/thread_pool.hpp"
 #include "util/include/util.hpp"
 
 namespace nesterov_a_test_task_threads {
@@ -44,7 +45,7 @@ bool NesterovATestTaskALL::RunImpl() {
     GetOutput() *= num_threads;
 
     int rank = -1;
-    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_rank(GetComm(), &rank);
     if (rank == 0) {
       std::atomic<int> counter(0);
 #pragma omp parallel default(none) shared(counter) num_threads(ppc::util::GetNumThreads())
@@ -58,12 +59,8 @@ bool NesterovATestTaskALL::RunImpl() {
 
   {
     GetOutput() *= num_threads;
-    std::vector<std::thread> threads(num_threads);
     std::atomic<int> counter(0);
-    for (int i = 0; i < num_threads; i++) {
-      threads[i] = std::thread([&]() { counter++; });
-      threads[i].join();
-    }
+    ppc::util::ThreadPool::Instance().ParallelFor(0, num_threads, [&](std::size_t /*i*/) { counter++; }, 1);
     GetOutput() /= counter;
   }
 
@@ -73,7 +70,7 @@ bool NesterovATestTaskALL::RunImpl() {
     tbb::parallel_for(0, ppc::util::GetNumThreads(), [&](int /*i*/) { counter++; });
     GetOutput() /= counter;
   }
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(GetComm());
   return GetOutput() > 0;
 }
 
@@ -1,11 +1,12 @@
 #include "example_threads/stl/include/ops_stl.hpp"
 
 #include <atomic>
+#include <cstddef>
 #include <numeric>
-#include <thread>
 #include <vector>
 
 #include "example_threads/common/include/common.hpp"
+#include "util/include/thread_pool.hpp"
 #include "util/include/util.hpp"
 
 namespace nesterov_a_test_task_threads {
@@ -37,14 +38,10 @@ bool NesterovATestTaskSTL::RunImpl() {
   }
 
   const int num_threads = ppc::util::GetNumThreads();
-  std::vector<std::thread> threads(num_threads);
   GetOutput() *= num_threads;
 
   std::atomic<int> counter(0);
-  for (int i = 0; i < num_threads; i++) {
-    threads[i] = std::thread([&]() { counter++; });
-    threads[i].join();
-  }
+  ppc::util::ThreadPool::Instance().ParallelFor(0, num_threads, [&](std::size_t /*i*/) { counter++; }, 1);
 
   GetOutput() /= counter;
   return GetOutput() > 0;
@@ -13,7 +13,7 @@ class GaivoronskiyMAverageVecSumMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit GaivoronskiyMAverageVecSumMPI(const InType &in);
+  explicit GaivoronskiyMAverageVecSumMPI(InType in);
 
  private:
   bool ValidationImpl() override;
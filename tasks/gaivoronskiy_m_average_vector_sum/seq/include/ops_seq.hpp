@@ -10,7 +10,7 @@ class GaivoronskiyMAverageVecSumSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit GaivoronskiyMAverageVecSumSEQ(const InType &in);
+  explicit GaivoronskiyMAverageVecSumSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -10,7 +10,7 @@ class GalkinDTrapezoidMethodMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit GalkinDTrapezoidMethodMPI(const InType &in);
+  explicit GalkinDTrapezoidMethodMPI(InType in);
 
  private:
   bool ValidationImpl() override;
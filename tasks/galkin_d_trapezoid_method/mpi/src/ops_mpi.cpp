@@ -3,14 +3,15 @@
 #include <mpi.h>
 
 #include <algorithm>
+#include <utility>
 
 #include "galkin_d_trapezoid_method/common/include/common.hpp"
 
 namespace galkin_d_trapezoid_method {
 
-GalkinDTrapezoidMethodMPI::GalkinDTrapezoidMethodMPI(const InType &in) {
+GalkinDTrapezoidMethodMPI::GalkinDTrapezoidMethodMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0.0;
 }
 
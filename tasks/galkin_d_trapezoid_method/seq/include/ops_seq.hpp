@@ -10,7 +10,7 @@ class GalkinDTrapezoidMethodSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit GalkinDTrapezoidMethodSEQ(const InType &in);
+  explicit GalkinDTrapezoidMethodSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -1,12 +1,14 @@
 #include "galkin_d_trapezoid_method/seq/include/ops_seq.hpp"
 
+#include <utility>
+
 #include "galkin_d_trapezoid_method/common/include/common.hpp"
 
 namespace galkin_d_trapezoid_method {
 
-GalkinDTrapezoidMethodSEQ::GalkinDTrapezoidMethodSEQ(const InType &in) {
+GalkinDTrapezoidMethodSEQ::GalkinDTrapezoidMethodSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0.0;
 }
 
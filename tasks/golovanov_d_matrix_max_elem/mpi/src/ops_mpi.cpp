@@ -3,15 +3,16 @@
 #include <mpi.h>
 
 #include <algorithm>
+#include <utility>
 #include <vector>
 
 #include "golovanov_d_matrix_max_elem//common/include/common.hpp"
 
 namespace golovanov_d_matrix_max_elem {
 
-GolovanovDMatrixMaxElemMPI::GolovanovDMatrixMaxElemMPI(const InType &in) {
+GolovanovDMatrixMaxElemMPI::GolovanovDMatrixMaxElemMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 1234;
 }
 
@@ -10,7 +10,7 @@ class GolovanovDMatrixMaxElemSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit GolovanovDMatrixMaxElemSEQ(const InType &in);
+  explicit GolovanovDMatrixMaxElemSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
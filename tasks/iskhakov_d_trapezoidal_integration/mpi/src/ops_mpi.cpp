@@ -5,15 +5,16 @@
 #include <cmath>
 #include <cstddef>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "iskhakov_d_trapezoidal_integration/common/include/common.hpp"
 
 namespace iskhakov_d_trapezoidal_integration {
 
-IskhakovDTrapezoidalIntegrationMPI::IskhakovDTrapezoidalIntegrationMPI(const InType &in) {
+IskhakovDTrapezoidalIntegrationMPI::IskhakovDTrapezoidalIntegrationMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0;
 }
 
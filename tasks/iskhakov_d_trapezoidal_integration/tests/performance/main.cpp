@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <tuple>
+#include <utility>
 
 #include "iskhakov_d_trapezoidal_integration/common/include/common.hpp"
 #include "iskhakov_d_trapezoidal_integration/mpi/include/ops_mpi.hpp"
@@ -25,7 +26,7 @@ class IskhakovDTrapezoidalIntegrationPerfTests : public ppc::util::BaseRunPerfTe
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 
  private:
@@ -10,7 +10,7 @@ class IvanovaPMaxMatrixSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit IvanovaPMaxMatrixSEQ(const InType &in);
+  explicit IvanovaPMaxMatrixSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -3,6 +3,7 @@
 #include <algorithm>  // для std::max
 #include <iostream>   // для std::cout
 #include <limits>     // для std::numeric_limits
+#include <utility>
 
 #include "ivanova_p_max_matrix/common/include/common.hpp"
 #include "ivanova_p_max_matrix/data/matrix_generator.hpp"
@@ -39,7 +40,7 @@ class IvanovaPMaxMatrixPerfTests : public ppc::util::BaseRunPerfTests<InType, Ou
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 
  private:
@@ -10,7 +10,7 @@ class KlimenkoVMaxMatrixElemsValMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit KlimenkoVMaxMatrixElemsValMPI(const InType &in);
+  explicit KlimenkoVMaxMatrixElemsValMPI(InType in);
 
   bool ValidationImpl() override;
   bool PreProcessingImpl() override;
@@ -2,15 +2,16 @@
 
 #include <algorithm>
 #include <climits>
+#include <utility>
 #include <vector>
 
 #include "klimenko_v_max_matrix_elems_val/common/include/common.hpp"
 
 namespace klimenko_v_max_matrix_elems_val {
 
-KlimenkoVMaxMatrixElemsValSEQ::KlimenkoVMaxMatrixElemsValSEQ(const InType &in) {
+KlimenkoVMaxMatrixElemsValSEQ::KlimenkoVMaxMatrixElemsValSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = InType(in);
+  GetInput() = std::move(in);
   GetOutput() = 0;
 }
 
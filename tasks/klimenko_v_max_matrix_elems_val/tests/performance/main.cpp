@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <utility>
+
 #include "klimenko_v_max_matrix_elems_val/common/include/common.hpp"
 #include "klimenko_v_max_matrix_elems_val/mpi/include/ops_mpi.hpp"
 #include "klimenko_v_max_matrix_elems_val/seq/include/ops_seq.hpp"
@@ -29,7 +31,7 @@ class KlimenkoVMaxMatrixElemsValPerfTests : public ppc::util::BaseRunPerfTests<I
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 };
 
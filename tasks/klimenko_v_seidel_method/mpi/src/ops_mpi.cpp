@@ -9,6 +9,8 @@
 #include <vector>
 
 #include "klimenko_v_seidel_method/common/include/common.hpp"
+#include "util/include/collectives.hpp"
+#include "util/include/partition.hpp"
 
 namespace klimenko_v_seidel_method {
 
@@ -51,14 +53,11 @@ bool KlimenkoVSeidelMethodMPI::RunImpl() {
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
   MPI_Comm_size(MPI_COMM_WORLD, &size);
 
-  std::vector<int> row_counts(size);
-  std::vector<int> row_displs(size);
-  std::vector<int> matrix_counts(size);
-  std::vector<int> matrix_displs(size);
-  ComputeRowDistribution(n, size, row_counts, row_displs, matrix_counts, matrix_displs);
+  const auto rows = ppc::util::BlockPartition(n, size);
+  const auto row_counts = ppc::util::ToMpiCounts(rows);
 
-  int local_rows = row_counts[rank];
-  int start_row = row_displs[rank];
+  int local_rows = row_counts.counts[rank];
+  int start_row = row_counts.displs[rank];
 
   std::vector<double> flat_matrix;
   std::vector<double> b;
@@ -66,13 +65,8 @@ bool KlimenkoVSeidelMethodMPI::RunImpl() {
     InitializeMatrixAndVector(flat_matrix, b, n);
   }
 
-  std::vector<double> local_matrix(static_cast<size_t>(local_rows) * n, 0.0);
-  MPI_Scatterv(flat_matrix.data(), matrix_counts.data(), matrix_displs.data(), MPI_DOUBLE, local_matrix.data(),
-               local_rows * n, MPI_DOUBLE, 0, MPI_COMM_WORLD);
-
-  std::vector<double> local_b(local_rows, 0.0);
-  MPI_Scatterv(b.data(), row_counts.data(), row_displs.data(), MPI_DOUBLE, local_b.data(), local_rows, MPI_DOUBLE, 0,
-               MPI_COMM_WORLD);
+  std::vector<double> local_matrix = ppc::util::ScatterPartition(flat_matrix, rows, 0, MPI_COMM_WORLD, n);
+  std::vector<double> local_b = ppc::util::ScatterPartition(b, rows, 0, MPI_COMM_WORLD);
 
   std::vector<double> x(n, 0.0);
   const double epsilon = 1e-6;
@@ -86,8 +80,8 @@ bool KlimenkoVSeidelMethodMPI::RunImpl() {
     std::vector<double> local_x_updated(local_rows);
     UpdateLocalXVector(local_rows, start_row, x, local_x_updated);
 
-    MPI_Allgatherv(local_x_updated.data(), local_rows, MPI_DOUBLE, x.data(), row_counts.data(), row_displs.data(),
-                   MPI_DOUBLE, MPI_COMM_WORLD);
+    MPI_Allgatherv(local_x_updated.data(), local_rows, MPI_DOUBLE, x.data(), row_counts.counts.data(),
+                   row_counts.displs.data(), MPI_DOUBLE, MPI_COMM_WORLD);
 
     double local_diff = ComputeLocalDifference(local_rows, start_row, x, x_old);
     double global_diff = 0.0;
@@ -111,26 +105,6 @@ bool KlimenkoVSeidelMethodMPI::PostProcessingImpl() {
   return GetOutput() > 0;
 }
 
-void KlimenkoVSeidelMethodMPI::ComputeRowDistribution(int n, int size, std::vector<int> &row_counts,
-                                                      std::vector<int> &row_displs, std::vector<int> &matrix_counts,
-                                                      std::vector<int> &matrix_displs) {
-  int row_offset = 0;
-  int matrix_offset = 0;
-  for (int proc = 0; proc < size; proc++) {
-    int base_rows = n / size;
-    int extra = (proc < (n % size)) ? 1 : 0;
-    int proc_rows = base_rows + extra;
-
-    row_counts[proc] = proc_rows;
-    row_displs[proc] = row_offset;
-    matrix_counts[proc] = proc_rows * n;
-    matrix_displs[proc] = matrix_offset;
-
-    row_offset += proc_rows;
-    matrix_offset += proc_rows * n;
-  }
-}
-
 int KlimenkoVSeidelMethodMPI::ComputeFinalResult(const std::vector<double> &x, int n) {
   double sum = 0.0;
   for (int i = 0; i < n; i++) {
@@ -11,7 +11,7 @@ class KondrashovaVSumColMatMPI : public BaseTask {
     return ppc::task::TypeOfTask::kMPI;
   }
 
-  explicit KondrashovaVSumColMatMPI(const InType &in);
+  explicit KondrashovaVSumColMatMPI(InType in);
 
  private:
   int rows_ = 0;
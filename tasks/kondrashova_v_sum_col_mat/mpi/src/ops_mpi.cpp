@@ -5,15 +5,16 @@
 #include <algorithm>
 #include <cstddef>
 #include <limits>
+#include <utility>
 #include <vector>
 
 #include "kondrashova_v_sum_col_mat/common/include/common.hpp"
 
 namespace kondrashova_v_sum_col_mat {
 
-KondrashovaVSumColMatMPI::KondrashovaVSumColMatMPI(const InType &in) {
+KondrashovaVSumColMatMPI::KondrashovaVSumColMatMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput().clear();
 }
 
@@ -2,15 +2,16 @@
 
 #include <cstddef>
 #include <limits>
+#include <utility>
 #include <vector>
 
 #include "kondrashova_v_sum_col_mat/common/include/common.hpp"
 
 namespace kondrashova_v_sum_col_mat {
 
-KondrashovaVSumColMatSEQ::KondrashovaVSumColMatSEQ(const InType &in) {
+KondrashovaVSumColMatSEQ::KondrashovaVSumColMatSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput().clear();
 }
 
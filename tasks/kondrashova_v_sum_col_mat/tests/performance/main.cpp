@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <random>
+#include <utility>
 #include <vector>
 
 #include "kondrashova_v_sum_col_mat/common/include/common.hpp"
@@ -86,7 +87,7 @@ class KondrashovaVSumColMatPerfTestsLittle : public ppc::util::BaseRunPerfTests<
   }
 
   InType GetTestInputData() final {
-    return input_data;
+    return std::move(input_data);
   }
 };
 
@@ -10,7 +10,7 @@ class KopilovDSumValColMatMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit KopilovDSumValColMatMPI(const InType &in);
+  explicit KopilovDSumValColMatMPI(InType in);
 
  private:
   bool ValidationImpl() override;
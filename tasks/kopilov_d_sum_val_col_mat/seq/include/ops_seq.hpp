@@ -10,7 +10,7 @@ class KopilovDSumValColMatSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit KopilovDSumValColMatSEQ(const InType &in);
+  explicit KopilovDSumValColMatSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -1,15 +1,16 @@
 #include "kopilov_d_sum_val_col_mat/seq/include/ops_seq.hpp"
 
 #include <cstddef>
+#include <utility>
 #include <vector>
 
 #include "kopilov_d_sum_val_col_mat/common/include/common.hpp"
 
 namespace kopilov_d_sum_val_col_mat {
 
-KopilovDSumValColMatSEQ::KopilovDSumValColMatSEQ(const InType &in) {
+KopilovDSumValColMatSEQ::KopilovDSumValColMatSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = OutType{};
 }
 
@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <cstddef>
+#include <utility>
 #include <vector>
 
 #include "kopilov_d_sum_val_col_mat/common/include/common.hpp"
@@ -40,7 +41,7 @@ class KopilovDSumValColMatPerfTests : public ppc::util::BaseRunPerfTests<InType,
   }
 
   InType GetTestInputData() override {
-    return input_data;
+    return std::move(input_data);
   }
 
   bool CheckTestOutputData(OutType &output_data) override {
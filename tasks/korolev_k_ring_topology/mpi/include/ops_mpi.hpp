@@ -10,7 +10,7 @@ class KorolevKRingTopologyMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit KorolevKRingTopologyMPI(const InType &in);
+  explicit KorolevKRingTopologyMPI(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -3,15 +3,16 @@
 #include <mpi.h>
 
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 #include "korolev_k_ring_topology/common/include/common.hpp"
 
 namespace korolev_k_ring_topology {
 
-KorolevKRingTopologyMPI::KorolevKRingTopologyMPI(const InType &in) {
+KorolevKRingTopologyMPI::KorolevKRingTopologyMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = {};
 }
 
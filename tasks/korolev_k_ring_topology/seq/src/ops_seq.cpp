@@ -4,15 +4,16 @@
 
 #include <array>
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 #include "korolev_k_ring_topology/common/include/common.hpp"
 
 namespace korolev_k_ring_topology {
 
-KorolevKRingTopologySEQ::KorolevKRingTopologySEQ(const InType &in) {
+KorolevKRingTopologySEQ::KorolevKRingTopologySEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = {};
 }
 
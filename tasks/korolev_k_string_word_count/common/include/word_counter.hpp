@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cctype>
+#include <cstdint>
+#include <string_view>
+
+namespace korolev_k_string_word_count {
+
+// Counts the words that start inside `chunk`. `prev_is_space` describes the character right before the chunk
+// (true at the beginning of the text) and is updated to describe the last character of the chunk, so consecutive
+// chunks of one text can be fed one after another.
+inline std::int64_t CountWordsChunk(std::string_view chunk, bool &prev_is_space) {
+  std::int64_t count = 0;
+  for (char ch : chunk) {
+    const bool is_space = std::isspace(static_cast<unsigned char>(ch)) != 0;
+    if (!is_space && prev_is_space) {
+      ++count;
+    }
+    prev_is_space = is_space;
+  }
+  return count;
+}
+
+}  // namespace korolev_k_string_word_count
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "korolev_k_string_word_count/common/include/common.hpp"
+#include "task/include/task.hpp"
+
+namespace korolev_k_string_word_count {
+
+// Streaming variant: the input is the path to a text file instead of the text itself. Every rank maps only its
+// own byte range of the file, so no rank ever holds the whole text.
+class KorolevKStringWordCountStreamMPI : public BaseTask {
+ public:
+  static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
+    return ppc::task::TypeOfTask::kMPI;
+  }
+  explicit KorolevKStringWordCountStreamMPI(InType in);
+
+ private:
+  bool ValidationImpl() override;
+  bool PreProcessingImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+};
+
+}  // namespace korolev_k_string_word_count
@@ -6,48 +6,64 @@
 #include <cctype>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 #include "korolev_k_string_word_count/common/include/common.hpp"
+#include "korolev_k_string_word_count/common/include/word_counter.hpp"
 
 namespace korolev_k_string_word_count {
 
 namespace {
 
-int CountWordsChunk(const std::string &s, std::size_t begin, std::size_t end, bool prev_is_space) {
-  if (begin >= end) {
-    return 0;
-  }
-  int count = 0;
-  bool in_word = false;
+// Largest part of the string distributed by one MPI_Scatterv: counts and displacements (halo bytes included)
+// must fit into `int`, so longer inputs are scattered in several rounds.
+constexpr std::uint64_t kMaxRoundBytes = static_cast<std::uint64_t>(std::numeric_limits<int>::max()) - 1;
+
+// First byte a round sends: a round that does not start the string also carries the halo byte before it.
+std::uint64_t RoundOrigin(std::uint64_t round_begin) {
+  return (round_begin > 0) ? round_begin - 1 : 0;
+}
 
-  auto first = static_cast<unsigned char>(s[begin]);
-  bool first_is_space = std::isspace(first) != 0;
-  if (!first_is_space && prev_is_space) {
-    ++count;
+// Splits [round_begin, round_begin + round_len) into `size` blocks. Every non-empty block that does not start
+// at the beginning of the string is extended one byte to the left, so the receiver sees the character that
+// precedes its segment and can tell whether its first word started on the previous rank.
+// Displacements are relative to RoundOrigin(round_begin).
+void ComputeRoundLayout(std::uint64_t round_begin, std::uint64_t round_len, int size, std::vector<int> &counts,
+                        std::vector<int> &displs) {
+  const auto size_u = static_cast<std::uint64_t>(size);
+  const std::uint64_t base = round_len / size_u;
+  const std::uint64_t rem = round_len % size_u;
+  const std::uint64_t shift = round_begin - RoundOrigin(round_begin);
+
+  for (int proc = 0; proc < size; ++proc) {
+    const auto proc_u = static_cast<std::uint64_t>(proc);
+    const std::uint64_t begin = (proc_u * base) + std::min(proc_u, rem);
+    const std::uint64_t len = base + (proc_u < rem ? 1 : 0);
+    const std::uint64_t halo = (len > 0 && round_begin + begin > 0) ? 1 : 0;
+    counts[proc] = static_cast<int>(len + halo);
+    displs[proc] = static_cast<int>(begin + shift - halo);
   }
-  in_word = !first_is_space;
-
-  for (std::size_t i = begin + 1; i < end; ++i) {
-    auto c = static_cast<unsigned char>(s[i]);
-    bool is_space = std::isspace(c) != 0;
-    if (!is_space) {
-      if (!in_word) {
-        ++count;
-        in_word = true;
-      }
-    } else {
-      in_word = false;
-    }
+}
+
+std::int64_t CountLocalPiece(const char *piece, int piece_len, bool has_halo) {
+  std::string_view view(piece, static_cast<std::size_t>(piece_len));
+  bool prev_is_space = true;
+  if (has_halo) {
+    prev_is_space = std::isspace(static_cast<unsigned char>(view.front())) != 0;
+    view.remove_prefix(1);
   }
-  return count;
+  return CountWordsChunk(view, prev_is_space);
 }
 
 }  // namespace
 
-KorolevKStringWordCountMPI::KorolevKStringWordCountMPI(const InType &in) {
+KorolevKStringWordCountMPI::KorolevKStringWordCountMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0;
 }
 
@@ -67,14 +83,8 @@ bool KorolevKStringWordCountMPI::RunImpl() {
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
   MPI_Comm_size(MPI_COMM_WORLD, &size);
 
-  std::string s;
-  uint64_t n = 0;
-
-  if (rank == 0) {
-    s = GetInput();
-    n = static_cast<uint64_t>(s.size());
-  }
-
+  const std::string &s = GetInput();
+  std::uint64_t n = (rank == 0) ? static_cast<std::uint64_t>(s.size()) : 0;
   MPI_Bcast(&n, 1, MPI_UINT64_T, 0, MPI_COMM_WORLD);
 
   if (n == 0) {
@@ -82,50 +92,37 @@ bool KorolevKStringWordCountMPI::RunImpl() {
     return true;
   }
 
-  const auto n_size = static_cast<std::size_t>(n);
-  const auto size_z = static_cast<std::size_t>(size);
-  const std::size_t base = n_size / size_z;
-  const std::size_t rem = n_size % size_z;
-
-  std::string local_segment;
-  char prev_char = ' ';
-
-  if (rank == 0) {
-    for (int dest = 1; dest < size; ++dest) {
-      auto dest_z = static_cast<std::size_t>(dest);
-      std::size_t begin_i = (dest_z * base) + std::min(dest_z, rem);
-      std::size_t end_i = begin_i + base + (dest_z < rem ? std::size_t{1} : std::size_t{0});
-      int segment_len = static_cast<int>(end_i - begin_i);
-
-      MPI_Send(&segment_len, 1, MPI_INT, dest, 0, MPI_COMM_WORLD);
-
-      char prev = (begin_i > 0) ? s[begin_i - 1] : ' ';
-      MPI_Send(&prev, 1, MPI_CHAR, dest, 1, MPI_COMM_WORLD);
-
-      MPI_Send(s.data() + begin_i, segment_len, MPI_CHAR, dest, 2, MPI_COMM_WORLD);
+  std::vector<int> counts(static_cast<std::size_t>(size));
+  std::vector<int> displs(static_cast<std::size_t>(size));
+  std::vector<char> local_piece;
+  std::int64_t local_count = 0;
+
+  for (std::uint64_t round_begin = 0; round_begin < n; round_begin += kMaxRoundBytes) {
+    const std::uint64_t round_len = std::min(kMaxRoundBytes, n - round_begin);
+    ComputeRoundLayout(round_begin, round_len, size, counts, displs);
+
+    const int my_count = counts[static_cast<std::size_t>(rank)];
+    const int my_displ = displs[static_cast<std::size_t>(rank)];
+    // Only the very first block of the string is sent without a halo byte.
+    const bool has_halo = my_count > 0 && (rank > 0 || round_begin > 0);
+
+    if (rank == 0) {
+      // The root reads its own piece straight from the input instead of receiving a copy of it.
+      const char *round_data = s.data() + RoundOrigin(round_begin);
+      MPI_Scatterv(round_data, counts.data(), displs.data(), MPI_CHAR, MPI_IN_PLACE, my_count, MPI_CHAR, 0,
+                   MPI_COMM_WORLD);
+      local_count += CountLocalPiece(round_data + my_displ, my_count, has_halo);
+    } else {
+      local_piece.resize(static_cast<std::size_t>(my_count));
+      MPI_Scatterv(nullptr, nullptr, nullptr, MPI_CHAR, local_piece.data(), my_count, MPI_CHAR, 0, MPI_COMM_WORLD);
+      local_count += CountLocalPiece(local_piece.data(), my_count, has_halo);
     }
-
-    std::size_t begin_0 = 0;
-    std::size_t end_0 = base + (rem > 0 ? std::size_t{1} : std::size_t{0});
-    local_segment = s.substr(begin_0, end_0 - begin_0);
-    prev_char = ' ';
-  } else {
-    int segment_len = 0;
-    MPI_Recv(&segment_len, 1, MPI_INT, 0, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-    MPI_Recv(&prev_char, 1, MPI_CHAR, 0, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-
-    local_segment.resize(static_cast<std::size_t>(segment_len));
-    MPI_Recv(local_segment.data(), segment_len, MPI_CHAR, 0, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
   }
 
-  bool prev_is_space = std::isspace(static_cast<unsigned char>(prev_char)) != 0;
-
-  int local_count = CountWordsChunk(local_segment, 0, local_segment.size(), prev_is_space);
-
-  int global_count = 0;
-  MPI_Allreduce(&local_count, &global_count, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  std::int64_t global_count = 0;
+  MPI_Allreduce(&local_count, &global_count, 1, MPI_INT64_T, MPI_SUM, MPI_COMM_WORLD);
 
-  GetOutput() = global_count;
+  GetOutput() = static_cast<OutType>(global_count);
 
   return true;
 }
@@ -0,0 +1,76 @@
+#include "korolev_k_string_word_count/mpi/include/ops_mpi_stream.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "korolev_k_string_word_count/common/include/common.hpp"
+#include "korolev_k_string_word_count/common/include/word_counter.hpp"
+#include "util/include/mapped_file.hpp"
+
+namespace korolev_k_string_word_count {
+
+namespace {
+
+// Size of the window each rank keeps mapped at a time.
+constexpr std::uint64_t kWindowBytes = std::uint64_t{16} << 20U;
+
+}  // namespace
+
+KorolevKStringWordCountStreamMPI::KorolevKStringWordCountStreamMPI(InType in) {
+  SetTypeOfTask(GetStaticTypeOfTask());
+  GetInput() = std::move(in);
+  GetOutput() = 0;
+}
+
+bool KorolevKStringWordCountStreamMPI::ValidationImpl() {
+  return std::filesystem::is_regular_file(GetInput()) && GetOutput() == 0;
+}
+
+bool KorolevKStringWordCountStreamMPI::PreProcessingImpl() {
+  GetOutput() = 0;
+  return true;
+}
+
+bool KorolevKStringWordCountStreamMPI::RunImpl() {
+  int rank = 0;
+  int size = 1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  const std::string &path = GetInput();
+  const std::uint64_t n = ppc::util::GetFileSize(path);
+  const auto rank_u = static_cast<std::uint64_t>(rank);
+  const auto size_u = static_cast<std::uint64_t>(size);
+  const std::uint64_t begin = (rank_u * (n / size_u)) + std::min(rank_u, n % size_u);
+  const std::uint64_t end = begin + (n / size_u) + (rank_u < n % size_u ? 1 : 0);
+
+  // The byte before the range decides whether the first word of the range started on the previous rank.
+  bool prev_is_space = true;
+  if (begin > 0 && begin < end) {
+    const ppc::util::MappedFileRange halo(path, begin - 1, 1);
+    prev_is_space = std::isspace(static_cast<unsigned char>(halo.View().front())) != 0;
+  }
+
+  std::int64_t local_count = 0;
+  ppc::util::ForEachFileWindow(path, begin, end, kWindowBytes,
+                               [&](std::string_view window) { local_count += CountWordsChunk(window, prev_is_space); });
+
+  std::int64_t global_count = 0;
+  MPI_Allreduce(&local_count, &global_count, 1, MPI_INT64_T, MPI_SUM, MPI_COMM_WORLD);
+
+  GetOutput() = static_cast<OutType>(global_count);
+  return true;
+}
+
+bool KorolevKStringWordCountStreamMPI::PostProcessingImpl() {
+  return true;
+}
+
+}  // namespace korolev_k_string_word_count
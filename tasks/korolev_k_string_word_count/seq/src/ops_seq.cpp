@@ -2,14 +2,15 @@
 
 #include <cctype>
 #include <string>
+#include <utility>
 
 #include "korolev_k_string_word_count/common/include/common.hpp"
 
 namespace korolev_k_string_word_count {
 
-KorolevKStringWordCountSEQ::KorolevKStringWordCountSEQ(const InType &in) {
+KorolevKStringWordCountSEQ::KorolevKStringWordCountSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0;
 }
 
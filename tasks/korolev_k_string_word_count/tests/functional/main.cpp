@@ -4,11 +4,15 @@
 #include <array>
 #include <cctype>
 #include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <libenvpp/env.hpp>
 #include <string>
 #include <tuple>
 
 #include "korolev_k_string_word_count/common/include/common.hpp"
 #include "korolev_k_string_word_count/mpi/include/ops_mpi.hpp"
+#include "korolev_k_string_word_count/mpi/include/ops_mpi_stream.hpp"
 #include "korolev_k_string_word_count/seq/include/ops_seq.hpp"
 #include "util/include/func_test_util.hpp"
 #include "util/include/util.hpp"
@@ -64,6 +68,40 @@ class KorolevKRunFuncTestsProcesses : public ppc::util::BaseRunFuncTests<InType,
   OutType expected_{};
 };
 
+// Runs the same cases through the streaming task: the text is written to a per-test file and the task gets its path.
+class KorolevKRunFuncTestsStreamProcesses : public ppc::util::BaseRunFuncTests<InType, OutType, TestType> {
+ public:
+  static std::string PrintTestParam(const TestType &test_param) {
+    return KorolevKRunFuncTestsProcesses::PrintTestParam(test_param);
+  }
+
+ protected:
+  void SetUp() override {
+    const auto &params = std::get<static_cast<std::size_t>(ppc::util::GTestParamIndex::kTestParams)>(GetParam());
+    text_ = std::get<0>(params);
+    expected_ = std::get<1>(params);
+  }
+
+  bool CheckTestOutputData(OutType &output_data) final {
+    return output_data == expected_;
+  }
+
+  InType GetTestInputData() final {
+    // PPC_TEST_TMPDIR is unique per test and per rank, so ranks never race on the file.
+    const auto tmp_dir = env::get<std::string>("PPC_TEST_TMPDIR");
+    const auto dir =
+        tmp_dir.has_value() ? std::filesystem::path(tmp_dir.value()) : std::filesystem::temp_directory_path();
+    const auto path = (dir / "korolev_k_string_word_count_input.txt").string();
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << text_;
+    return path;
+  }
+
+ private:
+  std::string text_;
+  OutType expected_{};
+};
+
 namespace {
 
 const std::array<TestType, 12> kTestParam = {
@@ -95,5 +133,20 @@ const auto kFuncTestName = KorolevKRunFuncTestsProcesses::PrintFuncTestName<Koro
 
 INSTANTIATE_TEST_SUITE_P(StringWordCountTests, KorolevKRunFuncTestsProcesses, kGtestValues, kFuncTestName);
 
+TEST_P(KorolevKRunFuncTestsStreamProcesses, CountWordsFromFile) {
+  ExecuteTest(GetParam());
+}
+
+const auto kStreamTestTasksList =
+    ppc::util::AddFuncTask<korolev_k_string_word_count::KorolevKStringWordCountStreamMPI, InType>(
+        kTestParam, PPC_SETTINGS_korolev_k_string_word_count);
+
+const auto kStreamGtestValues = ppc::util::ExpandToValues(kStreamTestTasksList);
+const auto kStreamFuncTestName =
+    KorolevKRunFuncTestsStreamProcesses::PrintFuncTestName<KorolevKRunFuncTestsStreamProcesses>;
+
+INSTANTIATE_TEST_SUITE_P(StringWordCountStreamTests, KorolevKRunFuncTestsStreamProcesses, kStreamGtestValues,
+                         kStreamFuncTestName);
+
 }  // namespace
 }  // namespace korolev_k_string_word_count_processes
@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <string>
+#include <utility>
 
 #include "korolev_k_string_word_count/common/include/common.hpp"
 #include "korolev_k_string_word_count/mpi/include/ops_mpi.hpp"
@@ -32,7 +33,7 @@ class KorolevKRunPerfTestProcesses : public ppc::util::BaseRunPerfTests<InType,
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 
  private:
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cctype>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace kotelnikova_a_num_sent_in_line {
+
+// What a piece of text contributes to the sentence count, computed without knowing the text before it.
+struct ChunkSummary {
+  // Sentences closed inside the piece, assuming it starts outside of a sentence.
+  std::uint64_t closed = 0;
+  // The piece contains a terminator or an alphanumeric character.
+  bool has_marks = false;
+  // The first such character is a terminator: it closes a sentence left open by the previous piece.
+  bool starts_with_terminator = false;
+  // Whether the piece ends inside a sentence; meaningful only when has_marks is set.
+  bool in_sentence = false;
+};
+
+inline bool IsTerminator(char c) {
+  return c == '.' || c == '!' || c == '?';
+}
+
+// Extends `summary` with the next consecutive piece of the same text.
+inline void AccumulateChunk(std::string_view chunk, ChunkSummary &summary) {
+  for (char c : chunk) {
+    if (IsTerminator(c)) {
+      if (!summary.has_marks) {
+        summary.has_marks = true;
+        summary.starts_with_terminator = true;
+      }
+      if (summary.in_sentence) {
+        summary.closed++;
+        summary.in_sentence = false;
+      }
+    } else if (std::isalnum(static_cast<unsigned char>(c)) != 0) {
+      summary.has_marks = true;
+      summary.in_sentence = true;
+    }
+  }
+}
+
+// Folds the summaries of consecutive pieces, in text order, into the sentence count of the whole text.
+// A sentence still open at the end of the text is counted as well.
+inline std::uint64_t CombineSummaries(const std::vector<ChunkSummary> &summaries) {
+  std::uint64_t total = 0;
+  bool in_sentence = false;
+  for (const auto &summary : summaries) {
+    total += summary.closed;
+    if (!summary.has_marks) {
+      continue;
+    }
+    if (in_sentence && summary.starts_with_terminator) {
+      total++;
+    }
+    in_sentence = summary.in_sentence;
+  }
+  return in_sentence ? total + 1 : total;
+}
+
+}  // namespace kotelnikova_a_num_sent_in_line
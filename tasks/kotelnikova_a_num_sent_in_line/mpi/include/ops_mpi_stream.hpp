@@ -0,0 +1,24 @@
+#pragma once
+
+#include "kotelnikova_a_num_sent_in_line/common/include/common.hpp"
+#include "task/include/task.hpp"
+
+namespace kotelnikova_a_num_sent_in_line {
+
+// Streaming variant: the input is the path to a text file instead of the text itself. Every rank maps only its
+// own byte range of the file, so no rank ever holds the whole text.
+class KotelnikovaANumSentInLineStreamMPI : public BaseTask {
+ public:
+  static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
+    return ppc::task::TypeOfTask::kMPI;
+  }
+  explicit KotelnikovaANumSentInLineStreamMPI(InType in);
+
+ private:
+  bool ValidationImpl() override;
+  bool PreProcessingImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+};
+
+}  // namespace kotelnikova_a_num_sent_in_line
@@ -0,0 +1,96 @@
+#include "kotelnikova_a_num_sent_in_line/mpi/include/ops_mpi_stream.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "kotelnikova_a_num_sent_in_line/common/include/common.hpp"
+#include "kotelnikova_a_num_sent_in_line/common/include/sentence_counter.hpp"
+#include "util/include/mapped_file.hpp"
+
+namespace kotelnikova_a_num_sent_in_line {
+
+namespace {
+
+// Size of the window each rank keeps mapped at a time.
+constexpr std::uint64_t kWindowBytes = std::uint64_t{16} << 20U;
+
+using PackedSummary = std::array<std::uint64_t, 4>;
+
+PackedSummary Pack(const ChunkSummary &summary) {
+  return {summary.closed, static_cast<std::uint64_t>(summary.has_marks),
+          static_cast<std::uint64_t>(summary.starts_with_terminator), static_cast<std::uint64_t>(summary.in_sentence)};
+}
+
+ChunkSummary Unpack(const PackedSummary &packed) {
+  return {.closed = packed[0],
+          .has_marks = packed[1] != 0,
+          .starts_with_terminator = packed[2] != 0,
+          .in_sentence = packed[3] != 0};
+}
+
+}  // namespace
+
+KotelnikovaANumSentInLineStreamMPI::KotelnikovaANumSentInLineStreamMPI(InType in) {
+  SetTypeOfTask(GetStaticTypeOfTask());
+  GetInput() = std::move(in);
+  GetOutput() = static_cast<std::size_t>(0);
+}
+
+bool KotelnikovaANumSentInLineStreamMPI::ValidationImpl() {
+  return std::filesystem::is_regular_file(GetInput()) && ppc::util::GetFileSize(GetInput()) > 0;
+}
+
+bool KotelnikovaANumSentInLineStreamMPI::PreProcessingImpl() {
+  return true;
+}
+
+bool KotelnikovaANumSentInLineStreamMPI::RunImpl() {
+  int world_size = 0;
+  int world_rank = 0;
+  MPI_Comm_size(MPI_COMM_WORLD, &world_size);
+  MPI_Comm_rank(MPI_COMM_WORLD, &world_rank);
+
+  const std::string &path = GetInput();
+  const std::uint64_t total_length = ppc::util::GetFileSize(path);
+  const auto rank_u = static_cast<std::uint64_t>(world_rank);
+  const auto size_u = static_cast<std::uint64_t>(world_size);
+  const std::uint64_t chunk_size = total_length / size_u;
+  const std::uint64_t remainder = total_length % size_u;
+  const std::uint64_t start = (rank_u * chunk_size) + std::min(rank_u, remainder);
+  const std::uint64_t end = start + chunk_size + (rank_u < remainder ? 1 : 0);
+
+  ChunkSummary local_summary;
+  ppc::util::ForEachFileWindow(path, start, end, kWindowBytes,
+                               [&](std::string_view window) { AccumulateChunk(window, local_summary); });
+
+  // Whether a rank's first sentence is still open depends on all ranks before it, so the per-rank summaries
+  // are exchanged and folded in rank order.
+  const PackedSummary packed = Pack(local_summary);
+  std::vector<PackedSummary> all_packed(static_cast<std::size_t>(world_size));
+  MPI_Allgather(packed.data(), static_cast<int>(packed.size()), MPI_UINT64_T, all_packed.data(),
+                static_cast<int>(packed.size()), MPI_UINT64_T, MPI_COMM_WORLD);
+
+  std::vector<ChunkSummary> summaries;
+  summaries.reserve(all_packed.size());
+  for (const auto &rank_packed : all_packed) {
+    summaries.push_back(Unpack(rank_packed));
+  }
+
+  GetOutput() = static_cast<std::size_t>(CombineSummaries(summaries));
+  return true;
+}
+
+bool KotelnikovaANumSentInLineStreamMPI::PostProcessingImpl() {
+  return true;
+}
+
+}  // namespace kotelnikova_a_num_sent_in_line
@@ -9,6 +9,7 @@
 
 #include "kotelnikova_a_num_sent_in_line/common/include/common.hpp"
 #include "kotelnikova_a_num_sent_in_line/mpi/include/ops_mpi.hpp"
+#include "kotelnikova_a_num_sent_in_line/mpi/include/ops_mpi_stream.hpp"
 #include "kotelnikova_a_num_sent_in_line/seq/include/ops_seq.hpp"
 #include "util/include/func_test_util.hpp"
 #include "util/include/util.hpp"
@@ -50,6 +51,35 @@ class KotelnikovaARunFuncTestsProcesses : public ppc::util::BaseRunFuncTests<InT
   std::size_t expected_count_ = 0;
 };
 
+// Runs the data files through the streaming task, which gets the path of a file instead of its text.
+class KotelnikovaARunFuncTestsStreamProcesses : public ppc::util::BaseRunFuncTests<InType, OutType, TestType> {
+ public:
+  static std::string PrintTestParam(const TestType &test_param) {
+    std::string name = std::get<0>(test_param);
+    name = name.substr(0, name.find('.'));
+    return name + "_exp" + std::to_string(std::get<1>(test_param));
+  }
+
+ protected:
+  void SetUp() override {
+    TestType params = std::get<static_cast<std::size_t>(ppc::util::GTestParamIndex::kTestParams)>(GetParam());
+    input_data_ = ppc::util::GetAbsoluteTaskPath(PPC_ID_kotelnikova_a_num_sent_in_line, std::get<0>(params));
+    expected_count_ = std::get<1>(params);
+  }
+
+  bool CheckTestOutputData(OutType &output_data) final {
+    return (expected_count_ == output_data);
+  }
+
+  InType GetTestInputData() final {
+    return input_data_;
+  }
+
+ private:
+  InType input_data_;
+  std::size_t expected_count_ = 0;
+};
+
 namespace {
 
 TEST_P(KotelnikovaARunFuncTestsProcesses, SentenceCountingTests) {
@@ -101,6 +131,25 @@ const auto kPerfTestName = KotelnikovaARunFuncTestsProcesses::PrintFuncTestName<
 
 INSTANTIATE_TEST_SUITE_P(SentenceCountingTests, KotelnikovaARunFuncTestsProcesses, kGtestValues, kPerfTestName);
 
+TEST_P(KotelnikovaARunFuncTestsStreamProcesses, SentenceCountingFromFileTests) {
+  ExecuteTest(GetParam());
+}
+
+const std::array<TestType, 6> kStreamTestParam = {
+    std::make_tuple("test_1.txt", 1), std::make_tuple("test_2.txt", 3), std::make_tuple("test_3.txt", 8),
+    std::make_tuple("test_4.txt", 11), std::make_tuple("test_5.txt", 1), std::make_tuple("test_6.txt", 1312)};
+
+const auto kStreamTestTasksList = ppc::util::AddFuncTask<KotelnikovaANumSentInLineStreamMPI, InType>(
+    kStreamTestParam, PPC_SETTINGS_kotelnikova_a_num_sent_in_line);
+
+const auto kStreamGtestValues = ppc::util::ExpandToValues(kStreamTestTasksList);
+
+const auto kStreamTestName =
+    KotelnikovaARunFuncTestsStreamProcesses::PrintFuncTestName<KotelnikovaARunFuncTestsStreamProcesses>;
+
+INSTANTIATE_TEST_SUITE_P(SentenceCountingStreamTests, KotelnikovaARunFuncTestsStreamProcesses, kStreamGtestValues,
+                         kStreamTestName);
+
 }  // namespace
 
 }  // namespace kotelnikova_a_num_sent_in_line
@@ -5,15 +5,16 @@
 #include <algorithm>
 #include <cstddef>
 #include <limits>
+#include <utility>
 #include <vector>
 
 #include "lazareva_a_max_val_matrix/common/include/common.hpp"
 
 namespace lazareva_a_max_val_matrix {
 
-LazarevaAMaxValMatrixMPI::LazarevaAMaxValMatrixMPI(const InType &in) {
+LazarevaAMaxValMatrixMPI::LazarevaAMaxValMatrixMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput().clear();
 }
 
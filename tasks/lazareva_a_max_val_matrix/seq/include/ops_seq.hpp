@@ -10,7 +10,7 @@ class LazarevaAMaxValMatrixSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit LazarevaAMaxValMatrixSEQ(const InType &in);
+  explicit LazarevaAMaxValMatrixSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
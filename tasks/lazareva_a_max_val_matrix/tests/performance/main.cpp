@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <limits>
 #include <random>
+#include <utility>
 
 #include "lazareva_a_max_val_matrix/common/include/common.hpp"
 #include "lazareva_a_max_val_matrix/mpi/include/ops_mpi.hpp"
@@ -58,7 +59,7 @@ class LazarevaARunPerfTestMaxValMatrix : public ppc::util::BaseRunPerfTests<InTy
   }
 
   InType GetTestInputData() final {
-    return input_data;
+    return std::move(input_data);
   }
 };
 
@@ -12,7 +12,7 @@ class SentencesCounterMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit SentencesCounterMPI(const InType &in);
+  explicit SentencesCounterMPI(InType in);
 
  private:
   bool ValidationImpl() override;
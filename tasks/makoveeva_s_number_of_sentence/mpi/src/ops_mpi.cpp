@@ -4,15 +4,16 @@
 
 #include <cstddef>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "makoveeva_s_number_of_sentence/common/include/common.hpp"
 
 namespace makoveeva_s_number_of_sentence {
 
-SentencesCounterMPI::SentencesCounterMPI(const InType &in) {
+SentencesCounterMPI::SentencesCounterMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0;
 }
 
@@ -10,7 +10,7 @@ class SentencesCounterSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit SentencesCounterSEQ(const InType &in);
+  explicit SentencesCounterSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
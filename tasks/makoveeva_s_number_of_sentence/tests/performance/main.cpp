@@ -3,6 +3,7 @@
 #include <array>
 #include <cstddef>
 #include <random>
+#include <utility>
 
 #include "makoveeva_s_number_of_sentence/common/include/common.hpp"
 #include "makoveeva_s_number_of_sentence/mpi/include/ops_mpi.hpp"
@@ -51,7 +52,7 @@ class MakoveevaSNumberOfSentencePerfTests : public ppc::util::BaseRunPerfTests<I
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 };
 
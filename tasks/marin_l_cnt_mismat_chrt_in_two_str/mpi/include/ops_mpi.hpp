@@ -12,7 +12,7 @@ class MarinLCntMismatChrtInTwoStrMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit MarinLCntMismatChrtInTwoStrMPI(const InType &in);
+  explicit MarinLCntMismatChrtInTwoStrMPI(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -21,6 +21,7 @@ class MarinLCntMismatChrtInTwoStrMPI : public BaseTask {
   bool PostProcessingImpl() override;
   std::string local_s1_;
   std::string local_s2_;
+  int len_diff_ = 0;
 };
 
 }  // namespace marin_l_cnt_mismat_chrt_in_two_str
@@ -10,7 +10,7 @@ class MarinLCntMismatChrtInTwoStrSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit MarinLCntMismatChrtInTwoStrSEQ(const InType &in);
+  explicit MarinLCntMismatChrtInTwoStrSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
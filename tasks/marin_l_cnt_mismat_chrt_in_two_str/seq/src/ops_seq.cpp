@@ -3,14 +3,16 @@
 #include <algorithm>
 #include <cstddef>
 #include <string>
+#include <utility>
 
 #include "marin_l_cnt_mismat_chrt_in_two_str/common/include/common.hpp"
+#include "util/include/byte_compare.hpp"
 
 namespace marin_l_cnt_mismat_chrt_in_two_str {
 
-MarinLCntMismatChrtInTwoStrSEQ::MarinLCntMismatChrtInTwoStrSEQ(const InType &in) {
+MarinLCntMismatChrtInTwoStrSEQ::MarinLCntMismatChrtInTwoStrSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0;
 }
 
@@ -27,19 +29,10 @@ bool MarinLCntMismatChrtInTwoStrSEQ::RunImpl() {
   const std::string &s1 = GetInput().first;
   const std::string &s2 = GetInput().second;
 
-  int count = 0;
   size_t min_len = std::min(s1.size(), s2.size());
   size_t max_len = std::max(s1.size(), s2.size());
 
-  for (size_t i = 0; i < min_len; i++) {
-    if (s1[i] != s2[i]) {
-      count++;
-    }
-  }
-
-  count += static_cast<int>(max_len - min_len);
-
-  GetOutput() = count;
+  GetOutput() = static_cast<int>(ppc::util::CountMismatches(s1, s2) + (max_len - min_len));
   return true;
 }
 
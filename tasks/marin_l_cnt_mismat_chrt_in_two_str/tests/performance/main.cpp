@@ -30,7 +30,7 @@ class MarinLCntMismatChrtInTwoStrPerfTests : public ppc::util::BaseRunPerfTests<
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 
  private:
@@ -6,15 +6,16 @@
 #include <cstdlib>
 #include <limits>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "melnik_i_min_neigh_diff_vec/common/include/common.hpp"
 
 namespace melnik_i_min_neigh_diff_vec {
 
-MelnikIMinNeighDiffVecMPI::MelnikIMinNeighDiffVecMPI(const InType &in) {
+MelnikIMinNeighDiffVecMPI::MelnikIMinNeighDiffVecMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = std::make_tuple(-1, -1);
 }
 
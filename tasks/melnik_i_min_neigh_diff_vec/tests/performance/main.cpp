@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <random>
+#include <utility>
 #include <vector>
 
 #include "melnik_i_min_neigh_diff_vec/common/include/common.hpp"
@@ -13,6 +14,7 @@ namespace melnik_i_min_neigh_diff_vec {
 
 class MelnikIMinNeighDiffVecRunPerfTestProcesses : public ppc::util::BaseRunPerfTests<InType, OutType> {
   InType input_data_;
+  std::size_t input_size_ = 0;
 
   void GenerateVector(unsigned int seed) {
     const size_t vector_size = 200000000;
@@ -25,7 +27,7 @@ class MelnikIMinNeighDiffVecRunPerfTestProcesses : public ppc::util::BaseRunPerf
       vector[i] = distribution(generator);
     }
 
-    input_data_ = vector;
+    input_data_ = std::move(vector);
   }
 
   void SetUp() override {
@@ -35,11 +37,12 @@ class MelnikIMinNeighDiffVecRunPerfTestProcesses : public ppc::util::BaseRunPerf
 
   bool CheckTestOutputData(OutType &output_data) final {
     auto [first, second] = output_data;
-    return first >= 0 && second == first + 1 && static_cast<size_t>(second) < input_data_.size();
+    return first >= 0 && second == first + 1 && static_cast<size_t>(second) < input_size_;
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    input_size_ = input_data_.size();
+    return std::move(input_data_);
   }
 };
 
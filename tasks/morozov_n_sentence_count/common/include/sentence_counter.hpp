@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace morozov_n_sentence_count {
+
+inline bool IsTerminator(char c) {
+  return c == '.' || c == '!' || c == '?';
+}
+
+// Counts the terminators in `chunk` that are not preceded by another terminator, i.e. the sentence ends.
+// `prev_is_terminator` describes the character right before the chunk and is updated to describe the last character
+// of the chunk, so consecutive chunks of one text can be fed one after another.
+inline std::size_t CountSentencesChunk(std::string_view chunk, bool &prev_is_terminator) {
+  std::size_t counter = 0;
+  for (char c : chunk) {
+    const bool is_terminator = IsTerminator(c);
+    if (is_terminator && !prev_is_terminator) {
+      counter++;
+    }
+    prev_is_terminator = is_terminator;
+  }
+  return counter;
+}
+
+}  // namespace morozov_n_sentence_count
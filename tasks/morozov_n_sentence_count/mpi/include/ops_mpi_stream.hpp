@@ -0,0 +1,26 @@
+#pragma once
+
+#include "morozov_n_sentence_count/common/include/common.hpp"
+#include "task/include/task.hpp"
+
+namespace morozov_n_sentence_count {
+
+// Streaming variant: the input is the path to a text file instead of the text itself. Every rank maps only its
+// own byte range of the file, so no rank ever holds the whole text.
+class MorozovNSentenceCountStreamMPI : public BaseTask {
+ public:
+  static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
+    return ppc::task::TypeOfTask::kMPI;
+  }
+  explicit MorozovNSentenceCountStreamMPI(InType in);
+
+ private:
+  bool ValidationImpl() override;
+  bool PreProcessingImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+  bool validated_ = false;
+};
+
+}  // namespace morozov_n_sentence_count
@@ -5,14 +5,17 @@
 #include <cstddef>
 #include <iostream>
 #include <string>
+#include <string_view>
+#include <utility>
 
 #include "morozov_n_sentence_count/common/include/common.hpp"
+#include "morozov_n_sentence_count/common/include/sentence_counter.hpp"
 
 namespace morozov_n_sentence_count {
 
-MorozovNSentenceCountMPI::MorozovNSentenceCountMPI(const InType &in) {
+MorozovNSentenceCountMPI::MorozovNSentenceCountMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0;
 }
 
@@ -55,13 +58,9 @@ bool MorozovNSentenceCountMPI::RunImpl() {
     index_end = input.length();
   }
 
-  std::size_t counter = 0;
-  for (std::size_t i = index_start; i < index_end; i++) {
-    if ((input[i] == '.' || input[i] == '!' || input[i] == '?') && (input[i - 1] != '.') && (input[i - 1] != '?') &&
-        (input[i - 1] != '!')) {
-      counter++;
-    }
-  }
+  bool prev_is_terminator = index_start > 0 && IsTerminator(input[index_start - 1]);
+  std::size_t counter =
+      CountSentencesChunk(std::string_view(input).substr(index_start, index_end - index_start), prev_is_terminator);
 
   const std::size_t k_counter = counter;
   std::size_t counter_sum = 0;
@@ -0,0 +1,84 @@
+#include "morozov_n_sentence_count/mpi/include/ops_mpi_stream.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "morozov_n_sentence_count/common/include/common.hpp"
+#include "morozov_n_sentence_count/common/include/sentence_counter.hpp"
+#include "util/include/mapped_file.hpp"
+
+namespace morozov_n_sentence_count {
+
+namespace {
+
+// Size of the window each rank keeps mapped at a time.
+constexpr std::uint64_t kWindowBytes = std::uint64_t{16} << 20U;
+
+}  // namespace
+
+MorozovNSentenceCountStreamMPI::MorozovNSentenceCountStreamMPI(InType in) {
+  SetTypeOfTask(GetStaticTypeOfTask());
+  GetInput() = std::move(in);
+  GetOutput() = 0;
+}
+
+bool MorozovNSentenceCountStreamMPI::ValidationImpl() {
+  validated_ = std::filesystem::is_regular_file(GetInput()) && ppc::util::GetFileSize(GetInput()) > 0 &&
+               (GetOutput() == 0);
+  return validated_;
+}
+
+bool MorozovNSentenceCountStreamMPI::PreProcessingImpl() {
+  return validated_;
+}
+
+bool MorozovNSentenceCountStreamMPI::RunImpl() {
+  if (!validated_) {
+    return false;
+  }
+  int mpi_size = 0;
+  int rank = 0;
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  const std::string &path = GetInput();
+  const std::uint64_t n = ppc::util::GetFileSize(path);
+  const auto rank_u = static_cast<std::uint64_t>(rank);
+  const auto size_u = static_cast<std::uint64_t>(mpi_size);
+  std::uint64_t begin = (rank_u * (n / size_u)) + std::min(rank_u, n % size_u);
+  const std::uint64_t end = begin + (n / size_u) + (rank_u < n % size_u ? 1 : 0);
+
+  // A terminator in the very first byte never ends a sentence (the in-memory tasks blank it in PreProcessing),
+  // so that byte is skipped and treated as an ordinary character.
+  bool prev_is_terminator = false;
+  if (begin == 0 && end > 0) {
+    begin = 1;
+  } else if (begin > 1 && begin < end) {
+    const ppc::util::MappedFileRange halo(path, begin - 1, 1);
+    prev_is_terminator = IsTerminator(halo.View().front());
+  }
+
+  std::uint64_t counter = 0;
+  ppc::util::ForEachFileWindow(path, begin, end, kWindowBytes, [&](std::string_view window) {
+    counter += CountSentencesChunk(window, prev_is_terminator);
+  });
+
+  std::uint64_t counter_sum = 0;
+  MPI_Allreduce(&counter, &counter_sum, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+
+  GetOutput() = static_cast<std::size_t>(counter_sum);
+  return true;
+}
+
+bool MorozovNSentenceCountStreamMPI::PostProcessingImpl() {
+  return validated_;
+}
+
+}  // namespace morozov_n_sentence_count
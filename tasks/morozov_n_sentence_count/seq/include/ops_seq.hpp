@@ -10,7 +10,7 @@ class MorozovNSentenceCountSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit MorozovNSentenceCountSEQ(const InType &in);
+  explicit MorozovNSentenceCountSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -2,14 +2,16 @@
 
 #include <cstddef>
 #include <string>
+#include <utility>
 
 #include "morozov_n_sentence_count/common/include/common.hpp"
+#include "morozov_n_sentence_count/common/include/sentence_counter.hpp"
 
 namespace morozov_n_sentence_count {
 
-MorozovNSentenceCountSEQ::MorozovNSentenceCountSEQ(const InType &in) {
+MorozovNSentenceCountSEQ::MorozovNSentenceCountSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0;
 }
 
@@ -34,13 +36,8 @@ bool MorozovNSentenceCountSEQ::RunImpl() {
   }
 
   std::string &input = GetInput();
-  std::size_t counter = 0;
-  for (size_t i = 0; i < input.length(); i++) {
-    if ((input[i] == '.' || input[i] == '!' || input[i] == '?') && (input[i - 1] != '.') && (input[i - 1] != '?') &&
-        (input[i - 1] != '!')) {
-      counter++;
-    }
-  }
+  bool prev_is_terminator = false;
+  std::size_t counter = CountSentencesChunk(input, prev_is_terminator);
 
   if (counter != 0) {
     GetOutput() = counter;
@@ -11,6 +11,7 @@
 
 #include "morozov_n_sentence_count/common/include/common.hpp"
 #include "morozov_n_sentence_count/mpi/include/ops_mpi.hpp"
+#include "morozov_n_sentence_count/mpi/include/ops_mpi_stream.hpp"
 #include "morozov_n_sentence_count/seq/include/ops_seq.hpp"
 #include "util/include/func_test_util.hpp"
 #include "util/include/util.hpp"
@@ -81,6 +82,33 @@ class MorozovNRunSentenceCountTests : public ppc::util::BaseRunFuncTests<InType,
   }
 };
 
+// Runs the file-based cases through the streaming task, which gets the path of the data file instead of its text.
+class MorozovNRunSentenceCountStreamTests : public ppc::util::BaseRunFuncTests<InType, OutType, TestType> {
+ public:
+  static std::string PrintTestParam(const TestType &test_param) {
+    return std::to_string(std::get<0>(test_param)) + "_" + "stream";
+  }
+
+ protected:
+  void SetUp() override {
+    TestType params = std::get<static_cast<std::size_t>(ppc::util::GTestParamIndex::kTestParams)>(GetParam());
+    input_data_ = ppc::util::GetAbsoluteTaskPath(PPC_ID_morozov_n_sentence_count, std::get<1>(params));
+    task_answer_ = std::get<2>(params);
+  }
+
+  bool CheckTestOutputData(OutType &output_data) final {
+    return output_data == task_answer_;
+  }
+
+  InType GetTestInputData() final {
+    return input_data_;
+  }
+
+ private:
+  InType input_data_;
+  std::size_t task_answer_ = 0;
+};
+
 namespace {
 
 TEST(MorozovNSentenceCountTests, EmptyStringInputMPI) {
@@ -117,6 +145,33 @@ const auto kPerfTestName = MorozovNRunSentenceCountTests::PrintFuncTestName<Moro
 
 INSTANTIATE_TEST_SUITE_P(SentenceCountTest, MorozovNRunSentenceCountTests, kGtestValues, kPerfTestName);
 
+TEST(MorozovNSentenceCountTests, MissingFileInputStreamMPI) {
+  MorozovNSentenceCountStreamMPI task("no_such_file.txt");
+  EXPECT_FALSE(task.Validation());
+  EXPECT_FALSE(task.PreProcessing());
+  EXPECT_FALSE(task.Run());
+  EXPECT_FALSE(task.PostProcessing());
+}
+
+TEST_P(MorozovNRunSentenceCountStreamTests, SentenceCountFromFile) {
+  ExecuteTest(GetParam());
+}
+
+const std::array<TestType, 5> kStreamTestParam = {
+    std::make_tuple(0, "test_0.txt", 0), std::make_tuple(1, "test_1.txt", 1), std::make_tuple(2, "test_2.txt", 4),
+    std::make_tuple(3, "test_3.txt", 100), std::make_tuple(4, "test_4.txt", 1)};
+
+const auto kStreamTestTasksList = ppc::util::AddFuncTask<MorozovNSentenceCountStreamMPI, InType>(
+    kStreamTestParam, PPC_SETTINGS_morozov_n_sentence_count);
+
+const auto kStreamGtestValues = ppc::util::ExpandToValues(kStreamTestTasksList);
+
+const auto kStreamTestName =
+    MorozovNRunSentenceCountStreamTests::PrintFuncTestName<MorozovNRunSentenceCountStreamTests>;
+
+INSTANTIATE_TEST_SUITE_P(SentenceCountStreamTest, MorozovNRunSentenceCountStreamTests, kStreamGtestValues,
+                         kStreamTestName);
+
 }  // namespace
 
 }  // namespace morozov_n_sentence_count
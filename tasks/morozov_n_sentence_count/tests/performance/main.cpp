@@ -3,6 +3,7 @@
 #include <cstddef>
 #include <random>
 #include <string>
+#include <utility>
 
 #include "morozov_n_sentence_count/common/include/common.hpp"
 #include "morozov_n_sentence_count/mpi/include/ops_mpi.hpp"
@@ -25,7 +26,7 @@ class MorozovNRunSentenceCountPerfTests : public ppc::util::BaseRunPerfTests<InT
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 
   static std::string GenerateTestData(const std::size_t s_count, const int seed) {
@@ -15,7 +15,7 @@ class OlesnitskiyVDijkstraCrsMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit OlesnitskiyVDijkstraCrsMPI(const InType &in);
+  explicit OlesnitskiyVDijkstraCrsMPI(InType in);
 
   bool ValidationImpl() override;
   bool PreProcessingImpl() override;
@@ -7,15 +7,16 @@
 #include <limits>
 #include <queue>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "olesnitskiy_v_dijkstra_crs/common/include/common.hpp"
 
 namespace olesnitskiy_v_dijkstra_crs {
 
-OlesnitskiyVDijkstraCrsMPI::OlesnitskiyVDijkstraCrsMPI(const InType &in) {
+OlesnitskiyVDijkstraCrsMPI::OlesnitskiyVDijkstraCrsMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = std::vector<int>();
 }
 
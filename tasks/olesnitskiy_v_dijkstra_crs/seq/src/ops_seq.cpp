@@ -10,9 +10,9 @@
 
 namespace olesnitskiy_v_dijkstra_crs {
 
-OlesnitskiyVDijkstraCrsSEQ::OlesnitskiyVDijkstraCrsSEQ(const InType &in) {
+OlesnitskiyVDijkstraCrsSEQ::OlesnitskiyVDijkstraCrsSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = std::vector<int>();
 }
 
@@ -2,6 +2,7 @@
 
 #include <mpi.h>
 
+#include <utility>
 #include <vector>
 
 #include "olesnitskiy_v_find_viol/common/include/common.hpp"
@@ -13,9 +14,9 @@ namespace olesnitskiy_v_find_viol {
   return (current - next > epsilon) ? 1 : 0;
 }
 
-OlesnitskiyVFindViolMPI::OlesnitskiyVFindViolMPI(const InType &in) {
+OlesnitskiyVFindViolMPI::OlesnitskiyVFindViolMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0;
 }
 
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <cstddef>
 #include <utility>
 #include <vector>
 
@@ -12,6 +13,7 @@ namespace olesnitskiy_v_find_viol {
 
 class OlesnitskiyVFindViolPerfTests : public ppc::util::BaseRunPerfTests<InType, OutType> {
   InType input_data_;
+  std::size_t input_size_ = 0;
 
   void SetUp() override {
     const int vector_size = 90000000;
@@ -20,15 +22,16 @@ class OlesnitskiyVFindViolPerfTests : public ppc::util::BaseRunPerfTests<InType,
     for (int i = 0; i < vector_size; i++) {
       vector[i] = static_cast<double>(i % 1000) + ((i & 1) == 0 ? 1.0 : -1.0);
     }
-    input_data_ = vector;
+    input_data_ = std::move(vector);
   }
 
   bool CheckTestOutputData(OutType &output_data) final {
-    return output_data >= 0 && std::cmp_less_equal(output_data, input_data_.size());
+    return output_data >= 0 && std::cmp_less_equal(output_data, input_size_);
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    input_size_ = input_data_.size();
+    return std::move(input_data_);
   }
 };
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <vector>
 
 #include "olesnitskiy_v_striped_matrix_multiplication/common/include/common.hpp"
@@ -14,7 +15,10 @@ class OlesnitskiyVStripedMatrixMultiplicationMPI : public ppc::task::Task<InType
     return ppc::task::TypeOfTask::kMPI;
   }
 
-  explicit OlesnitskiyVStripedMatrixMultiplicationMPI(const InType &in);
+  explicit OlesnitskiyVStripedMatrixMultiplicationMPI(InType in);
+
+  // Параметр автотюнинга: наибольшее число строк A, при котором умножение выполняет один процесс
+  static constexpr const char *kSingleProcessMaxRows = "single_process_max_rows";
 
   bool ValidationImpl() override;
   bool PreProcessingImpl() override;
@@ -51,11 +55,9 @@ class OlesnitskiyVStripedMatrixMultiplicationMPI : public ppc::task::Task<InType
 
   size_t rows_a_{0};
   size_t cols_a_{0};
-  std::vector<double> data_a_;
 
   size_t rows_b_{0};
   size_t cols_b_{0};
-  std::vector<double> data_b_;
 
   size_t rows_c_{0};
   size_t cols_c_{0};
@@ -63,6 +65,7 @@ class OlesnitskiyVStripedMatrixMultiplicationMPI : public ppc::task::Task<InType
 
   int rank_{-1};
   int world_size_{-1};
+  std::int64_t single_process_max_rows_{0};
 };
 
 }  // namespace olesnitskiy_v_striped_matrix_multiplication
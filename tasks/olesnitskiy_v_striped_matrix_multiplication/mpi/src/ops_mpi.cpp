@@ -2,18 +2,22 @@
 
 #include <mpi.h>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <tuple>
 #include <utility>
 #include <vector>
 
 #include "olesnitskiy_v_striped_matrix_multiplication/common/include/common.hpp"
+#include "util/include/tuning.hpp"
+#include "util/include/util.hpp"
 
 namespace olesnitskiy_v_striped_matrix_multiplication {
 
-OlesnitskiyVStripedMatrixMultiplicationMPI::OlesnitskiyVStripedMatrixMultiplicationMPI(const InType &in) {
+OlesnitskiyVStripedMatrixMultiplicationMPI::OlesnitskiyVStripedMatrixMultiplicationMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = {0UL, 0UL, std::vector<double>()};
   MPI_Comm_rank(MPI_COMM_WORLD, &rank_);
   MPI_Comm_size(MPI_COMM_WORLD, &world_size_);
@@ -43,10 +47,8 @@ bool OlesnitskiyVStripedMatrixMultiplicationMPI::ValidationImpl() {
   const auto &[rows_a, cols_a, data_a, rows_b, cols_b, data_b] = GetInput();
   rows_a_ = rows_a;
   cols_a_ = cols_a;
-  data_a_ = data_a;
   rows_b_ = rows_b;
   cols_b_ = cols_b;
-  data_b_ = data_b;
   if (rows_a == 0 || cols_a == 0 || rows_b == 0 || cols_b == 0) {
     return false;
   }
@@ -64,6 +66,17 @@ bool OlesnitskiyVStripedMatrixMultiplicationMPI::ValidationImpl() {
 bool OlesnitskiyVStripedMatrixMultiplicationMPI::PreProcessingImpl() {
   rows_c_ = rows_a_;
   cols_c_ = cols_b_;
+
+  // Для малых матриц рассылка дороже самого умножения, и его выгоднее выполнить на одном процессе.
+  // Порог подбирается автотюнером; без него один процесс считает, только когда строк меньше, чем процессов.
+  const std::int64_t min_threshold = world_size_ - 1;
+  std::int64_t threshold = min_threshold;
+  if (rank_ == 0) {
+    threshold = ppc::util::GetTunedValue(ppc::util::GetNamespace<OlesnitskiyVStripedMatrixMultiplicationMPI>(),
+                                         kSingleProcessMaxRows, rows_c_ * cols_c_, world_size_, min_threshold);
+  }
+  MPI_Bcast(&threshold, 1, MPI_INT64_T, 0, MPI_COMM_WORLD);
+  single_process_max_rows_ = std::max(threshold, min_threshold);
   return true;
 }
 
@@ -88,6 +101,7 @@ bool OlesnitskiyVStripedMatrixMultiplicationMPI::PrepareScatterData() {
 }
 
 bool OlesnitskiyVStripedMatrixMultiplicationMPI::ScatterData() {
+  const auto &data_a = std::get<2>(GetInput());
   if (std::cmp_less(rows_a_, world_size_)) {
     return false;
   }
@@ -103,10 +117,10 @@ bool OlesnitskiyVStripedMatrixMultiplicationMPI::ScatterData() {
   }
 
   if (!local_a_.empty()) {
-    MPI_Scatterv(data_a_.data(), sendcounts_a_.data(), displs_a_.data(), MPI_DOUBLE, local_a_.data(),
+    MPI_Scatterv(data_a.data(), sendcounts_a_.data(), displs_a_.data(), MPI_DOUBLE, local_a_.data(),
                  sendcounts_a_[rank_], MPI_DOUBLE, 0, MPI_COMM_WORLD);
   } else {
-    MPI_Scatterv(data_a_.data(), sendcounts_a_.data(), displs_a_.data(), MPI_DOUBLE, nullptr, 0, MPI_DOUBLE, 0,
+    MPI_Scatterv(data_a.data(), sendcounts_a_.data(), displs_a_.data(), MPI_DOUBLE, nullptr, 0, MPI_DOUBLE, 0,
                  MPI_COMM_WORLD);
   }
 
@@ -117,7 +131,7 @@ bool OlesnitskiyVStripedMatrixMultiplicationMPI::BroadcastMatrixB() {
   if (rows_b_ > 0 && cols_b_ > 0) {
     local_b_.resize(rows_b_ * cols_b_);
     if (rank_ == 0) {
-      local_b_ = data_b_;
+      local_b_ = std::get<5>(GetInput());
     }
     MPI_Bcast(local_b_.data(), static_cast<int>(local_b_.size()), MPI_DOUBLE, 0, MPI_COMM_WORLD);
   } else {
@@ -237,7 +251,7 @@ bool OlesnitskiyVStripedMatrixMultiplicationMPI::SetOutput() {
 }
 
 bool OlesnitskiyVStripedMatrixMultiplicationMPI::RunImpl() {
-  if (std::cmp_less(rows_a_, world_size_)) {
+  if (std::cmp_less_equal(rows_a_, single_process_max_rows_)) {
     return RunOnSingleProcess();
   }
 
@@ -266,11 +280,13 @@ bool OlesnitskiyVStripedMatrixMultiplicationMPI::RunImpl() {
 }
 
 void OlesnitskiyVStripedMatrixMultiplicationMPI::MultiplySingleProcessMatrix() {
+  const auto &data_a = std::get<2>(GetInput());
+  const auto &data_b = std::get<5>(GetInput());
   for (size_t i = 0; i < rows_a_; ++i) {
     for (size_t j = 0; j < cols_b_; ++j) {
       double sum = 0.0;
       for (size_t k = 0; k < cols_a_; ++k) {
-        sum += data_a_[(i * cols_a_) + k] * data_b_[(k * cols_b_) + j];
+        sum += data_a[(i * cols_a_) + k] * data_b[(k * cols_b_) + j];
       }
       result_c_[(i * cols_c_) + j] = sum;
     }
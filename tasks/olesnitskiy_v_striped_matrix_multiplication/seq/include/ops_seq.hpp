@@ -13,7 +13,7 @@ class OlesnitskiyVStripedMatrixMultiplicationSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit OlesnitskiyVStripedMatrixMultiplicationSEQ(const InType &in);
+  explicit OlesnitskiyVStripedMatrixMultiplicationSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
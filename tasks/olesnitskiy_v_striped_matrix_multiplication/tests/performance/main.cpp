@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -8,7 +10,10 @@
 #include "olesnitskiy_v_striped_matrix_multiplication/common/include/common.hpp"
 #include "olesnitskiy_v_striped_matrix_multiplication/mpi/include/ops_mpi.hpp"
 #include "olesnitskiy_v_striped_matrix_multiplication/seq/include/ops_seq.hpp"
+#include "performance/include/autotune.hpp"
+#include "performance/include/performance.hpp"
 #include "util/include/perf_test_util.hpp"
+#include "util/include/util.hpp"
 
 namespace olesnitskiy_v_striped_matrix_multiplication {
 
@@ -43,13 +48,54 @@ class OlesnitskiyVStripedMatrixMultiplicationPerfTests : public ppc::util::BaseR
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 };
 
 TEST_P(OlesnitskiyVStripedMatrixMultiplicationPerfTests, RunPerfModes) {
   ExecuteTest(GetParam());
 }
+
+namespace {
+
+InType MakeSquareInput(size_t size) {
+  std::vector<double> matrix_a(size * size);
+  std::vector<double> matrix_b(size * size);
+  for (size_t i = 0; i < matrix_a.size(); ++i) {
+    matrix_a[i] = static_cast<double>((i * 37) % 1000) / 1000.0;
+    matrix_b[i] = static_cast<double>((i * 73 + 50) % 1000) / 1000.0;
+  }
+  return std::make_tuple(size, size, matrix_a, size, size, matrix_b);
+}
+
+}  // namespace
+
+// Подбирает порог однопроцессного умножения для нескольких размеров и сохраняет его в кэш автотюнинга
+TEST(OlesnitskiyVStripedMatrixMultiplicationTuning, SingleProcessThreshold) {
+  if (!ppc::util::IsAutotuneEnabled()) {
+    GTEST_SKIP() << "Set PPC_AUTOTUNE=1 to tune";
+  }
+  const int world_size = ppc::util::GetMPISize();
+  ppc::performance::PerfAttr perf_attr;
+  perf_attr.num_running = 3;
+  ppc::util::SetMpiPerfAttributes(perf_attr);
+
+  for (const size_t size : {32, 128, 512}) {
+    const auto input = MakeSquareInput(size);
+    const ppc::performance::TuneTarget target{
+        .task = ppc::util::GetNamespace<OlesnitskiyVStripedMatrixMultiplicationMPI>(),
+        .size = size * size,
+        .num_proc = world_size};
+    const std::vector<ppc::performance::TuneParam> space = {
+        {.name = OlesnitskiyVStripedMatrixMultiplicationMPI::kSingleProcessMaxRows,
+         .values = {world_size - 1, static_cast<std::int64_t>(size)}}};
+    const auto result = ppc::performance::Autotune<InType, OutType>(
+        target, space, [&input] { return std::make_shared<OlesnitskiyVStripedMatrixMultiplicationMPI>(input); },
+        perf_attr);
+    ASSERT_EQ(result.trials.size(), space[0].values.size());
+  }
+}
+
 const auto kAllPerfTasks = ppc::util::MakeAllPerfTasks<InType, OlesnitskiyVStripedMatrixMultiplicationMPI,
                                                        OlesnitskiyVStripedMatrixMultiplicationSEQ>(
     PPC_SETTINGS_olesnitskiy_v_striped_matrix_multiplication);
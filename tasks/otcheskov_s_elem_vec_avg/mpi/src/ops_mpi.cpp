@@ -5,18 +5,19 @@
 #include <cmath>
 #include <cstdint>
 #include <numeric>
+#include <utility>
 #include <vector>
 
 #include "otcheskov_s_elem_vec_avg/common/include/common.hpp"
 
 namespace otcheskov_s_elem_vec_avg {
 
-OtcheskovSElemVecAvgMPI::OtcheskovSElemVecAvgMPI(const InType &in) {
+OtcheskovSElemVecAvgMPI::OtcheskovSElemVecAvgMPI(InType in) {
   MPI_Comm_rank(MPI_COMM_WORLD, &proc_rank_);
   MPI_Comm_size(MPI_COMM_WORLD, &proc_num_);
   SetTypeOfTask(GetStaticTypeOfTask());
   if (proc_rank_ == 0) {
-    GetInput() = in;
+    GetInput() = std::move(in);
   }
   GetOutput() = NAN;
 }
@@ -10,7 +10,7 @@ class OtcheskovSElemVecAvgSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit OtcheskovSElemVecAvgSEQ(const InType &in);
+  explicit OtcheskovSElemVecAvgSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -5,6 +5,7 @@
 #include <limits>
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 #include "otcheskov_s_elem_vec_avg/common/include/common.hpp"
 #include "otcheskov_s_elem_vec_avg/mpi/include/ops_mpi.hpp"
@@ -58,7 +59,7 @@ class OtcheskovSElemVecAvgPerfTests : public ppc::util::BaseRunPerfTests<InType,
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 };
 
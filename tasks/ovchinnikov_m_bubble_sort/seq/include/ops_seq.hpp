@@ -10,7 +10,7 @@ class OvchinnikovMBubbleSortSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit OvchinnikovMBubbleSortSEQ(const InType &in);
+  explicit OvchinnikovMBubbleSortSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -2,15 +2,16 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <utility>
 #include <vector>
 
 #include "ovchinnikov_m_bubble_sort/common/include/common.hpp"
 
 namespace ovchinnikov_m_bubble_sort {
 
-OvchinnikovMBubbleSortSEQ::OvchinnikovMBubbleSortSEQ(const InType &in) {
+OvchinnikovMBubbleSortSEQ::OvchinnikovMBubbleSortSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   static_cast<void>(GetOutput());
 }
 
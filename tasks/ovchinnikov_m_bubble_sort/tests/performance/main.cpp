@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <utility>
 
 #include "ovchinnikov_m_bubble_sort/common/include/common.hpp"
 #include "ovchinnikov_m_bubble_sort/mpi/include/ops_mpi.hpp"
@@ -22,19 +23,21 @@ class OvchinnikovMBubbleSortPerfTest : public ppc::util::BaseRunPerfTests<InType
     for (size_t i = 0; i < size_; i++) {
       input_[i] = static_cast<int>((i * 37) % 100000);  // almost random
     }
+    expected_ = CalcExpected(input_);
   }
 
   bool CheckTestOutputData(OutType &output_data) final {
-    return output_data == CalcExpected(input_);
+    return output_data == expected_;
   }
 
   InType GetTestInputData() final {
-    return input_;
+    return std::move(input_);
   }
 
  private:
   size_t size_ = 0;
   InType input_;
+  OutType expected_;
 
   static OutType CalcExpected(const InType &input) {
     OutType res = input;
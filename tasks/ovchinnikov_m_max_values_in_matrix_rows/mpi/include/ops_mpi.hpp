@@ -10,7 +10,7 @@ class OvchinnikovMMaxValuesInMatrixRowsMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit OvchinnikovMMaxValuesInMatrixRowsMPI(const InType &in);
+  explicit OvchinnikovMMaxValuesInMatrixRowsMPI(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <limits>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "ovchinnikov_m_max_values_in_matrix_rows/common/include/common.hpp"
@@ -29,19 +30,21 @@ class OvchinnikovMMaxValuesInMatrixRowsPerfTest : public ppc::util::BaseRunPerfT
       }
     }
 
-    input_data_ = std::make_tuple(rows_, cols_, data_);
+    input_data_ = std::make_tuple(rows_, cols_, std::move(data_));
+    expected_ = CalcExpected(input_data_);
   }
 
   bool CheckTestOutputData(OutType &output_data) final {
-    return output_data == CalcExpected(input_data_);
+    return output_data == expected_;
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 
  private:
   InType input_data_;
+  OutType expected_;
   std::vector<int> data_;
   size_t rows_ = 0;
   size_t cols_ = 0;
@@ -10,7 +10,7 @@ class PankovAStringWordCountMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit PankovAStringWordCountMPI(const InType &in);
+  explicit PankovAStringWordCountMPI(InType in);
 
  private:
   bool ValidationImpl() override;
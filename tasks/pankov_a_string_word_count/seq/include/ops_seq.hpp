@@ -10,7 +10,7 @@ class PankovAStringWordCountSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit PankovAStringWordCountSEQ(const InType &in);
+  explicit PankovAStringWordCountSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <sstream>
+#include <utility>
 
 #include "pankov_a_string_word_count/common/include/common.hpp"
 #include "pankov_a_string_word_count/mpi/include/ops_mpi.hpp"
@@ -33,7 +34,7 @@ class PankovARunPerfTestProcesses : public ppc::util::BaseRunPerfTests<InType, O
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 };
 
@@ -10,7 +10,7 @@ class ParamonovJarvisMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit ParamonovJarvisMPI(const InType &in);
+  explicit ParamonovJarvisMPI(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -3,15 +3,16 @@
 #include <mpi.h>
 
 #include <cstddef>
+#include <utility>
 #include <vector>
 
 #include "paramonov_jarvis/common/include/common.hpp"
 
 namespace paramonov_jarvis {
 
-ParamonovJarvisMPI::ParamonovJarvisMPI(const InType &in) {
+ParamonovJarvisMPI::ParamonovJarvisMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = OutType();
 }
 
@@ -10,7 +10,7 @@ class ParamonovJarvisSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit ParamonovJarvisSEQ(const InType &in);
+  explicit ParamonovJarvisSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -1,14 +1,15 @@
 #include "paramonov_jarvis/seq/include/ops_seq.hpp"
 
+#include <utility>
 #include <vector>
 
 #include "paramonov_jarvis/common/include/common.hpp"
 
 namespace paramonov_jarvis {
 
-ParamonovJarvisSEQ::ParamonovJarvisSEQ(const InType &in) {
+ParamonovJarvisSEQ::ParamonovJarvisSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = OutType();
 }
 
@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <utility>
 
 #include "paramonov_jarvis/common/include/common.hpp"
 #include "paramonov_jarvis/mpi/include/ops_mpi.hpp"
@@ -36,7 +37,7 @@ class JarvisPerfTests : public ppc::util::BaseRunPerfTests<InType, OutType> {
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 };
 
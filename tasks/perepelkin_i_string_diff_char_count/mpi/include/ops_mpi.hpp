@@ -13,7 +13,7 @@ class PerepelkinIStringDiffCharCountMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit PerepelkinIStringDiffCharCountMPI(const InType &in);
+  explicit PerepelkinIStringDiffCharCountMPI(InType in);
 
  private:
   int proc_rank_{};
@@ -3,22 +3,25 @@
 #include <mpi.h>
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
-#include <functional>
-#include <numeric>
+#include <cstdint>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include "perepelkin_i_string_diff_char_count/common/include/common.hpp"
+#include "util/include/byte_compare.hpp"
 
 namespace perepelkin_i_string_diff_char_count {
 
-PerepelkinIStringDiffCharCountMPI::PerepelkinIStringDiffCharCountMPI(const InType &in) {
+PerepelkinIStringDiffCharCountMPI::PerepelkinIStringDiffCharCountMPI(InType in) {
   MPI_Comm_rank(MPI_COMM_WORLD, &proc_rank_);
   MPI_Comm_size(MPI_COMM_WORLD, &proc_num_);
 
   SetTypeOfTask(GetStaticTypeOfTask());
   if (proc_rank_ == 0) {
-    GetInput() = in;
+    GetInput() = std::move(in);
   }
   GetOutput() = 0;
 }
@@ -32,24 +35,24 @@ bool PerepelkinIStringDiffCharCountMPI::PreProcessingImpl() {
 }
 
 bool PerepelkinIStringDiffCharCountMPI::RunImpl() {
-  size_t min_len = 0;
-  size_t max_len = 0;
+  std::array<std::uint64_t, 2> lengths{};
 
   if (proc_rank_ == 0) {
     const auto &[s1, s2] = GetInput();
-    min_len = std::min(s1.size(), s2.size());
-    max_len = std::max(s1.size(), s2.size());
+    lengths[0] = std::min(s1.size(), s2.size());
+    lengths[1] = std::max(s1.size(), s2.size());
   }
 
-  MPI_Bcast(&min_len, 1, MPI_INT, 0, MPI_COMM_WORLD);
-  MPI_Bcast(&max_len, 1, MPI_INT, 0, MPI_COMM_WORLD);
+  MPI_Bcast(lengths.data(), 2, MPI_UINT64_T, 0, MPI_COMM_WORLD);
+  const auto min_len = static_cast<size_t>(lengths[0]);
+  const auto max_len = static_cast<size_t>(lengths[1]);
 
   std::vector<char> local_s1;
   std::vector<char> local_s2;
   DistributeData(min_len, local_s1, local_s2);
 
-  int local_diff = std::transform_reduce(local_s1.begin(), local_s1.end(), local_s2.begin(), 0, std::plus<>(),
-                                         std::not_equal_to<>());
+  int local_diff = static_cast<int>(ppc::util::CountMismatches(std::string_view(local_s1.data(), local_s1.size()),
+                                                                std::string_view(local_s2.data(), local_s2.size())));
 
   int global_diff = 0;
   MPI_Allreduce(&local_diff, &global_diff, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
@@ -2,16 +2,16 @@
 
 #include <algorithm>
 #include <cstddef>
-#include <functional>
-#include <numeric>
+#include <utility>
 
 #include "perepelkin_i_string_diff_char_count/common/include/common.hpp"
+#include "util/include/byte_compare.hpp"
 
 namespace perepelkin_i_string_diff_char_count {
 
-PerepelkinIStringDiffCharCountSEQ::PerepelkinIStringDiffCharCountSEQ(const InType &in) {
+PerepelkinIStringDiffCharCountSEQ::PerepelkinIStringDiffCharCountSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0;
 }
 
@@ -28,8 +28,7 @@ bool PerepelkinIStringDiffCharCountSEQ::RunImpl() {
   const size_t min_len = std::min(s1.size(), s2.size());
   const size_t max_len = std::max(s1.size(), s2.size());
 
-  int diff = std::transform_reduce(s1.begin(), s1.begin() + static_cast<std::ptrdiff_t>(min_len), s2.begin(), 0,
-                                   std::plus<>(), std::not_equal_to<>());
+  int diff = static_cast<int>(ppc::util::CountMismatches(s1, s2));
 
   GetOutput() = diff + static_cast<int>(max_len - min_len);
   return true;
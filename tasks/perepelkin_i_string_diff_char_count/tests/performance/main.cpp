@@ -34,7 +34,7 @@ class PerepelkinIStringDiffCharCountPerfTestProcesses : public ppc::util::BaseRu
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 
   static std::tuple<std::string, std::string, int> GenerateTestData(size_t base_length, unsigned int seed,
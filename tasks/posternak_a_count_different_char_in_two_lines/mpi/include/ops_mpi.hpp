@@ -10,7 +10,7 @@ class PosternakACountDifferentCharInTwoLinesMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit PosternakACountDifferentCharInTwoLinesMPI(const InType &in);
+  explicit PosternakACountDifferentCharInTwoLinesMPI(InType in);
 
  private:
   bool ValidationImpl() override;
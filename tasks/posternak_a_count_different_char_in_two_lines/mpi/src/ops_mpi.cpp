@@ -9,12 +9,13 @@
 #include <vector>
 
 #include "posternak_a_count_different_char_in_two_lines/common/include/common.hpp"
+#include "util/include/byte_compare.hpp"
 
 namespace posternak_a_count_different_char_in_two_lines {
 
-PosternakACountDifferentCharInTwoLinesMPI::PosternakACountDifferentCharInTwoLinesMPI(const InType &in) {
+PosternakACountDifferentCharInTwoLinesMPI::PosternakACountDifferentCharInTwoLinesMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0;
 }
 
@@ -36,72 +37,39 @@ bool PosternakACountDifferentCharInTwoLinesMPI::RunImpl() {
   int size = 0;
   MPI_Comm_size(MPI_COMM_WORLD, &size);
 
-  std::string s1;
-  std::string s2;
-
   int s1_len = 0;
   int s2_len = 0;
 
   if (rank == 0) {
-    std::pair<std::string, std::string> &lines = GetInput();
-    s1 = lines.first;
-    s2 = lines.second;
-    s1_len = static_cast<int>(s1.length());
-    s2_len = static_cast<int>(s2.length());
+    s1_len = static_cast<int>(GetInput().first.length());
+    s2_len = static_cast<int>(GetInput().second.length());
   }
 
   MPI_Bcast(&s1_len, 1, MPI_INT, 0, MPI_COMM_WORLD);
   MPI_Bcast(&s2_len, 1, MPI_INT, 0, MPI_COMM_WORLD);
 
-  std::vector<std::string> s1_proc_parts;
-  std::vector<std::string> s2_proc_parts;
+  int min_len = std::min(s1_len, s2_len);
+  int local_len = min_len / size;
+  int remainder = min_len % size;
 
-  if (rank == 0) {
-    int min_len = std::min(s1_len, s2_len);
-
-    int local_len = min_len / size;
-    int remainder = min_len % size;
-
-    int start = 0;
-    for (int i = 0; i < size; i++) {
-      int part_len = local_len;
-      if (i == size - 1) {
-        part_len += remainder;
-      }
-
-      s1_proc_parts.push_back(s1.substr(start, part_len));
-      s2_proc_parts.push_back(s2.substr(start, part_len));
-      start += part_len;
-    }
-
-    for (int proc = 1; proc < size; proc++) {
-      int part_len = static_cast<int>(s1_proc_parts[proc].length());
-
-      MPI_Send(&part_len, 1, MPI_INT, proc, 0, MPI_COMM_WORLD);
-      MPI_Send(s1_proc_parts[proc].c_str(), part_len, MPI_CHAR, proc, 1, MPI_COMM_WORLD);
-      MPI_Send(s2_proc_parts[proc].c_str(), part_len, MPI_CHAR, proc, 2, MPI_COMM_WORLD);
-    }
-
-    s1 = s1_proc_parts[0];
-    s2 = s2_proc_parts[0];
-  } else {
-    int part_len = 0;
-    MPI_Recv(&part_len, 1, MPI_INT, 0, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-
-    s1.resize(part_len);
-    s2.resize(part_len);
-
-    MPI_Recv(s1.data(), part_len, MPI_CHAR, 0, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-    MPI_Recv(s2.data(), part_len, MPI_CHAR, 0, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+  // the last process takes the remainder; parts are scattered straight from both input strings
+  std::vector<int> part_lens(size, local_len);
+  part_lens[size - 1] += remainder;
+  std::vector<int> starts(size);
+  for (int i = 1; i < size; i++) {
+    starts[i] = starts[i - 1] + part_lens[i - 1];
   }
 
-  int process_count = 0;
-  int part_len = static_cast<int>(s1.length());
-  for (int i = 0; i < part_len; i++) {
-    if (s1[i] != s2[i]) {
-      process_count++;
-    }
-  }
+  int part_len = part_lens[rank];
+  std::string s1(part_len, '\0');
+  std::string s2(part_len, '\0');
+
+  const char *s1_data = rank == 0 ? GetInput().first.data() : nullptr;
+  const char *s2_data = rank == 0 ? GetInput().second.data() : nullptr;
+  MPI_Scatterv(s1_data, part_lens.data(), starts.data(), MPI_CHAR, s1.data(), part_len, MPI_CHAR, 0, MPI_COMM_WORLD);
+  MPI_Scatterv(s2_data, part_lens.data(), starts.data(), MPI_CHAR, s2.data(), part_len, MPI_CHAR, 0, MPI_COMM_WORLD);
+
+  int process_count = static_cast<int>(ppc::util::CountMismatches(s1, s2));
 
   int count = 0;
   MPI_Allreduce(&process_count, &count, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
@@ -5,12 +5,13 @@
 #include <utility>
 
 #include "posternak_a_count_different_char_in_two_lines/common/include/common.hpp"
+#include "util/include/byte_compare.hpp"
 
 namespace posternak_a_count_different_char_in_two_lines {
 
-PosternakACountDifferentCharInTwoLinesSEQ::PosternakACountDifferentCharInTwoLinesSEQ(const InType &in) {
+PosternakACountDifferentCharInTwoLinesSEQ::PosternakACountDifferentCharInTwoLinesSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0;
 }
 
@@ -25,9 +26,8 @@ bool PosternakACountDifferentCharInTwoLinesSEQ::PreProcessingImpl() {
   return true;
 }
 bool PosternakACountDifferentCharInTwoLinesSEQ::RunImpl() {
-  std::pair<std::string, std::string> &lines = GetInput();
-  std::string s1 = lines.first;
-  std::string s2 = lines.second;
+  const std::string &s1 = GetInput().first;
+  const std::string &s2 = GetInput().second;
 
   int diff_count = 0;
   size_t min = 0;
@@ -41,12 +41,7 @@ bool PosternakACountDifferentCharInTwoLinesSEQ::RunImpl() {
     min = s1_len;
     max = s2_len;
   }
-  for (size_t i = 0; i < min; i++) {
-    if (s1[i] != s2[i]) {
-      diff_count++;
-    }
-  }
-
+  diff_count += static_cast<int>(ppc::util::CountMismatches(s1, s2));
   diff_count += static_cast<int>(max - min);
   GetOutput() = diff_count;
   return true;
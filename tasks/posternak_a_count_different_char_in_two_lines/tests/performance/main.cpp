@@ -31,7 +31,7 @@ class PosternakARunPerfTestProcesses : public ppc::util::BaseRunPerfTests<InType
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 };
 
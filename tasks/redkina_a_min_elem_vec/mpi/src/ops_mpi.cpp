@@ -4,15 +4,16 @@
 
 #include <algorithm>
 #include <climits>
+#include <utility>
 #include <vector>
 
 #include "redkina_a_min_elem_vec/common/include/common.hpp"
 
 namespace redkina_a_min_elem_vec {
 
-RedkinaAMinElemVecMPI::RedkinaAMinElemVecMPI(const InType &in) {
+RedkinaAMinElemVecMPI::RedkinaAMinElemVecMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0;
 }
 
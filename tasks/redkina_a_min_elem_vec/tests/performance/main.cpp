@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <random>
+#include <utility>
 
 #include "redkina_a_min_elem_vec/common/include/common.hpp"
 #include "redkina_a_min_elem_vec/mpi/include/ops_mpi.hpp"
@@ -34,7 +35,7 @@ class RedkinaAMinElemVecRunPerfTests : public ppc::util::BaseRunPerfTests<InType
   }
 
   InType GetTestInputData() final {
-    return input_vec_;
+    return std::move(input_vec_);
   }
 
  private:
@@ -11,7 +11,7 @@ class RemizovKMaxInMatrixStringMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit RemizovKMaxInMatrixStringMPI(const InType &in);
+  explicit RemizovKMaxInMatrixStringMPI(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -5,16 +5,16 @@
 #include <algorithm>
 #include <cstddef>
 #include <limits>
+#include <utility>
 #include <vector>
 
 #include "remizov_k_max_in_matrix_string/common/include/common.hpp"
 
 namespace remizov_k_max_in_matrix_string {
 
-RemizovKMaxInMatrixStringMPI::RemizovKMaxInMatrixStringMPI(const InType &in) {
+RemizovKMaxInMatrixStringMPI::RemizovKMaxInMatrixStringMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  InType tmp(in);
-  GetInput().swap(tmp);
+  GetInput() = std::move(in);
 }
 
 bool RemizovKMaxInMatrixStringMPI::ValidationImpl() {
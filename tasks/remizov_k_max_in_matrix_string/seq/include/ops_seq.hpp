@@ -10,7 +10,7 @@ class RemizovKMaxInMatrixStringSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit RemizovKMaxInMatrixStringSEQ(const InType &in);
+  explicit RemizovKMaxInMatrixStringSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -2,16 +2,16 @@
 
 #include <algorithm>
 #include <limits>
+#include <utility>
 #include <vector>
 
 #include "remizov_k_max_in_matrix_string/common/include/common.hpp"
 
 namespace remizov_k_max_in_matrix_string {
 
-RemizovKMaxInMatrixStringSEQ::RemizovKMaxInMatrixStringSEQ(const InType &in) {
+RemizovKMaxInMatrixStringSEQ::RemizovKMaxInMatrixStringSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  InType tmp(in);
-  GetInput().swap(tmp);
+  GetInput() = std::move(in);
 }
 
 bool RemizovKMaxInMatrixStringSEQ::ValidationImpl() {
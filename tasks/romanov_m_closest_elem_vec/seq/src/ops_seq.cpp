@@ -3,15 +3,16 @@
 #include <cmath>
 #include <cstddef>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "romanov_m_closest_elem_vec/common/include/common.hpp"
 
 namespace romanov_m_closest_elem_vec {
 
-RomanovMClosestElemVecSEQ::RomanovMClosestElemVecSEQ(const InType &in) {
+RomanovMClosestElemVecSEQ::RomanovMClosestElemVecSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = std::make_tuple(-1, -1);
   ;
 }
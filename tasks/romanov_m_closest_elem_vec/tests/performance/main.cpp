@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <utility>
 
 #include "romanov_m_closest_elem_vec/common/include/common.hpp"
 #include "romanov_m_closest_elem_vec/mpi/include/ops_mpi.hpp"
@@ -12,6 +13,7 @@ namespace romanov_m_closest_elem_vec {
 
 class RomanovMClosestElemVecRunPerfTestProcesses : public ppc::util::BaseRunPerfTests<InType, OutType> {
   InType input_data_;
+  std::size_t input_size_ = 0;
 
   void SetUp() override {
     const size_t vector_size = 20000000;
@@ -24,11 +26,12 @@ class RomanovMClosestElemVecRunPerfTestProcesses : public ppc::util::BaseRunPerf
   // test 2
   bool CheckTestOutputData(OutType &output_data) final {
     auto [first_idx, second_idx] = output_data;
-    return first_idx >= 0 && second_idx == first_idx + 1 && static_cast<size_t>(second_idx) < input_data_.size();
+    return first_idx >= 0 && second_idx == first_idx + 1 && static_cast<size_t>(second_idx) < input_size_;
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    input_size_ = input_data_.size();
+    return std::move(input_data_);
   }
 };
 
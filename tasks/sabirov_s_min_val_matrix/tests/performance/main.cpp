@@ -3,11 +3,13 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <span>
 #include <vector>
 
 #include "sabirov_s_min_val_matrix/common/include/common.hpp"
 #include "sabirov_s_min_val_matrix/mpi/include/ops_mpi.hpp"
 #include "sabirov_s_min_val_matrix/seq/include/ops_seq.hpp"
+#include "util/include/dataset_cache.hpp"
 #include "util/include/perf_test_util.hpp"
 
 namespace sabirov_s_min_val_matrix {
@@ -30,15 +32,20 @@ class SabirovSMinValMatrixPerfTests : public ppc::util::BaseRunPerfTests<InType,
       return static_cast<InType>((val % 2000001LL) - 1000000LL);
     };
 
-    expected_mins_.resize(kCount_);
-    for (int i = 0; i < kCount_; i++) {
-      InType min_val = generate_value(static_cast<int64_t>(i), 0);
-      for (int j = 1; j < kCount_; j++) {
-        InType val = generate_value(static_cast<int64_t>(i), static_cast<int64_t>(j));
-        min_val = std::min(min_val, val);
+    // минимумы строк 10^8 ячеек считаются один раз и берутся из кэша при следующих запусках
+    const ppc::util::DatasetKey key{
+        .task = "sabirov_s_min_val_matrix_mins", .size = static_cast<uint64_t>(kCount_), .seed = 42};
+    auto generate_mins = [&](std::span<InType> mins, std::size_t first_row) {
+      for (std::size_t k = 0; k < mins.size(); k++) {
+        const auto i = static_cast<int64_t>(first_row + k);
+        InType min_val = generate_value(i, 0);
+        for (int j = 1; j < kCount_; j++) {
+          min_val = std::min(min_val, generate_value(i, static_cast<int64_t>(j)));
+        }
+        mins[k] = min_val;
       }
-      expected_mins_[i] = min_val;
-    }
+    };
+    expected_mins_ = ppc::util::LoadOrGenerateDataset<InType>(key, generate_mins, 64).ToVector();
   }
 
   bool CheckTestOutputData(OutType &output_data) final {
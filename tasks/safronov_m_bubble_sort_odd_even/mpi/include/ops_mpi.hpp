@@ -12,7 +12,7 @@ class SafronovMBubbleSortOddEvenMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit SafronovMBubbleSortOddEvenMPI(const InType &in);
+  explicit SafronovMBubbleSortOddEvenMPI(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -3,15 +3,16 @@
 #include <mpi.h>
 
 #include <algorithm>
+#include <utility>
 #include <vector>
 
 #include "safronov_m_bubble_sort_odd_even/common/include/common.hpp"
 
 namespace safronov_m_bubble_sort_odd_even {
 
-SafronovMBubbleSortOddEvenMPI::SafronovMBubbleSortOddEvenMPI(const InType &in) {
+SafronovMBubbleSortOddEvenMPI::SafronovMBubbleSortOddEvenMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
 }
 
 bool SafronovMBubbleSortOddEvenMPI::ValidationImpl() {
@@ -11,7 +11,7 @@ class SafronovMSumValuesMatrixMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit SafronovMSumValuesMatrixMPI(const InType &in);
+  explicit SafronovMSumValuesMatrixMPI(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -3,16 +3,16 @@
 #include <mpi.h>
 
 #include <cstddef>
+#include <utility>
 #include <vector>
 
 #include "safronov_m_sum_values_matrix/common/include/common.hpp"
 
 namespace safronov_m_sum_values_matrix {
 
-SafronovMSumValuesMatrixMPI::SafronovMSumValuesMatrixMPI(const InType &in) {
+SafronovMSumValuesMatrixMPI::SafronovMSumValuesMatrixMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  InType tmp(in);
-  GetInput().swap(tmp);
+  GetInput() = std::move(in);
 }
 
 bool SafronovMSumValuesMatrixMPI::ValidationImpl() {
@@ -1,16 +1,16 @@
 #include "safronov_m_sum_values_matrix/seq/include/ops_seq.hpp"
 
 #include <cstddef>
+#include <utility>
 #include <vector>
 
 #include "safronov_m_sum_values_matrix/common/include/common.hpp"
 
 namespace safronov_m_sum_values_matrix {
 
-SafronovMSumValuesMatrixSEQ::SafronovMSumValuesMatrixSEQ(const InType &in) {
+SafronovMSumValuesMatrixSEQ::SafronovMSumValuesMatrixSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  InType tmp(in);
-  GetInput().swap(tmp);
+  GetInput() = std::move(in);
 }
 
 bool SafronovMSumValuesMatrixSEQ::ValidationImpl() {
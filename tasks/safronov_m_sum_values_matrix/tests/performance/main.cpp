@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <cstddef>
+#include <utility>
 #include <vector>
 
 #include "safronov_m_sum_values_matrix/common/include/common.hpp"
@@ -35,7 +36,7 @@ class SafronovMSumValuesMatrixPerfTest : public ppc::util::BaseRunPerfTests<InTy
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 };
 
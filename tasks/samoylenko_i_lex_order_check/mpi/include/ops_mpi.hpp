@@ -11,7 +11,7 @@ class SamoylenkoILexOrderCheckMPI : public BaseTask {
     return ppc::task::TypeOfTask::kMPI;
   }
 
-  explicit SamoylenkoILexOrderCheckMPI(const InType &in);
+  explicit SamoylenkoILexOrderCheckMPI(InType in);
 
  private:
   bool ValidationImpl() override;
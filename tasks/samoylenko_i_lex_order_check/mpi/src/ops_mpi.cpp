@@ -6,8 +6,10 @@
 #include <cstddef>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "samoylenko_i_lex_order_check/common/include/common.hpp"
+#include "util/include/byte_compare.hpp"
 
 namespace samoylenko_i_lex_order_check {
 
@@ -23,47 +25,36 @@ void ExchangeLengths(int rank, const std::pair<std::string, std::string> *input,
 }
 
 void ScatterData(int rank, int size, const std::pair<std::string, std::string> *input, size_t min_len,
-                 size_t substr_size, size_t substr_start, size_t substr_len, std::string &local_str1,
-                 std::string &local_str2) {
-  if (rank == 0) {
-    const std::string &str1 = input->first;
-    const std::string &str2 = input->second;
-
-    if (substr_len > 0) {
-      std::copy_n(str1.begin() + static_cast<std::ptrdiff_t>(substr_start), substr_len, local_str1.begin());
-      std::copy_n(str2.begin() + static_cast<std::ptrdiff_t>(substr_start), substr_len, local_str2.begin());
-    }
-
-    for (int proc = 1; proc < size; ++proc) {
-      size_t proc_start = proc * substr_size;
-      if (proc_start < min_len) {
-        size_t proc_len = std::min(substr_size, min_len - proc_start);
-        MPI_Send(str1.data() + proc_start, static_cast<int>(proc_len), MPI_CHAR, proc, 0, MPI_COMM_WORLD);
-        MPI_Send(str2.data() + proc_start, static_cast<int>(proc_len), MPI_CHAR, proc, 1, MPI_COMM_WORLD);
-      }
-    }
-  } else {
-    if (substr_len > 0) {
-      MPI_Recv(local_str1.data(), static_cast<int>(substr_len), MPI_CHAR, 0, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-      MPI_Recv(local_str2.data(), static_cast<int>(substr_len), MPI_CHAR, 0, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-    }
+                 size_t substr_size, std::string &local_str1, std::string &local_str2) {
+  std::vector<int> counts(size);
+  std::vector<int> displs(size);
+  for (int proc = 0; proc < size; ++proc) {
+    size_t proc_start = std::min(proc * substr_size, min_len);
+    counts[proc] = static_cast<int>(std::min(substr_size, min_len - proc_start));
+    displs[proc] = static_cast<int>(proc_start);
   }
+
+  const char *str1_data = (rank == 0) ? input->first.data() : nullptr;
+  const char *str2_data = (rank == 0) ? input->second.data() : nullptr;
+  MPI_Scatterv(str1_data, counts.data(), displs.data(), MPI_CHAR, local_str1.data(), counts[rank], MPI_CHAR, 0,
+               MPI_COMM_WORLD);
+  MPI_Scatterv(str2_data, counts.data(), displs.data(), MPI_CHAR, local_str2.data(), counts[rank], MPI_CHAR, 0,
+               MPI_COMM_WORLD);
 }
 
 unsigned int FindLocalDifference(const std::string &s1, const std::string &s2, size_t offset, size_t default_val) {
-  for (size_t i = 0; i < s1.size(); ++i) {
-    if (s1[i] != s2[i]) {
-      return static_cast<unsigned int>(offset + i);
-    }
+  size_t index = ppc::util::FindFirstMismatch(s1, s2);
+  if (index < s1.size()) {
+    return static_cast<unsigned int>(offset + index);
   }
   return static_cast<unsigned int>(default_val);
 }
 
 }  // namespace
 
-SamoylenkoILexOrderCheckMPI::SamoylenkoILexOrderCheckMPI(const InType &in) {
+SamoylenkoILexOrderCheckMPI::SamoylenkoILexOrderCheckMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = false;
 }
 
@@ -98,7 +89,7 @@ bool SamoylenkoILexOrderCheckMPI::RunImpl() {
   std::string local_str1(substr_len, '\0');
   std::string local_str2(substr_len, '\0');
 
-  ScatterData(rank, size, input_ptr, min_len, substr_size, substr_start, substr_len, local_str1, local_str2);
+  ScatterData(rank, size, input_ptr, min_len, substr_size, local_str1, local_str2);
 
   unsigned int local_diff = FindLocalDifference(local_str1, local_str2, substr_start, min_len + 1);
   unsigned int global_diff = 0;
@@ -13,7 +13,7 @@ class SamoylenkoILexOrderCheckSEQ : public BaseTask {
     return ppc::task::TypeOfTask::kSEQ;
   }
 
-  explicit SamoylenkoILexOrderCheckSEQ(const InType &in);
+  explicit SamoylenkoILexOrderCheckSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -1,34 +1,27 @@
 #include "samoylenko_i_lex_order_check/seq/include/ops_seq.hpp"
 
+#include <cstddef>
 #include <string>
 #include <utility>
 
 #include "samoylenko_i_lex_order_check/common/include/common.hpp"
+#include "util/include/byte_compare.hpp"
 
 namespace samoylenko_i_lex_order_check {
 
 bool SamoylenkoILexOrderCheckSEQ::SamoylenkoILexOrderCompare(const std::string &s1, const std::string &s2) {
-  auto first1 = s1.begin();
-  auto last1 = s1.end();
-  auto first2 = s2.begin();
-  auto last2 = s2.end();
-
-  for (; (first1 != last1) && (first2 != last2); ++first1, ++first2) {
-    if (*first1 < *first2) {
-      return true;
-    }
-    if (*first2 < *first1) {
-      return false;
-    }
+  const std::size_t index = ppc::util::FindFirstMismatch(s1, s2);
+  if (index < s1.size() && index < s2.size()) {
+    return s1[index] < s2[index];
   }
 
   // Equal and prefix check
-  return ((first1 == last1) && (first2 == last2)) || ((first1 == last1) && (first2 != last2));
+  return s1.size() <= s2.size();
 }
 
-SamoylenkoILexOrderCheckSEQ::SamoylenkoILexOrderCheckSEQ(const InType &in) {
+SamoylenkoILexOrderCheckSEQ::SamoylenkoILexOrderCheckSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = false;
 }
 
@@ -40,7 +40,7 @@ class SamoylenkoRunPerfTests : public ppc::util::BaseRunPerfTests<InType, OutTyp
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 };
 
@@ -10,7 +10,7 @@ class ShakirovaEElemMatrixSumMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit ShakirovaEElemMatrixSumMPI(const InType &in);
+  explicit ShakirovaEElemMatrixSumMPI(InType in);
 
  private:
   bool ValidationImpl() override;
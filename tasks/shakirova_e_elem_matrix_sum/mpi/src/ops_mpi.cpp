@@ -12,9 +12,9 @@
 
 namespace shakirova_e_elem_matrix_sum {
 
-ShakirovaEElemMatrixSumMPI::ShakirovaEElemMatrixSumMPI(const InType &in) {
+ShakirovaEElemMatrixSumMPI::ShakirovaEElemMatrixSumMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0;
 }
 
@@ -10,7 +10,7 @@ class ShakirovaEElemMatrixSumSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit ShakirovaEElemMatrixSumSEQ(const InType &in);
+  explicit ShakirovaEElemMatrixSumSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
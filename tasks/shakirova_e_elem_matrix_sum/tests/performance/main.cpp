@@ -3,6 +3,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <string>
+#include <utility>
 
 #include "shakirova_e_elem_matrix_sum/common/include/common.hpp"
 #include "shakirova_e_elem_matrix_sum/mpi/include/ops_mpi.hpp"
@@ -31,7 +32,7 @@ class ShakirovaEElemMatrixSumPerfTest : public ppc::util::BaseRunPerfTests<InTyp
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 
  private:
@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <utility>
 #include <vector>
 
 #include "shemetov_d_find_error_vec/common/include/common.hpp"
@@ -20,9 +21,9 @@ int ShemetovDFindErrorVecMPI::DetectDrop(double left, double right) noexcept {
   return (left > right + kEpsilon) ? 1 : 0;
 }
 
-ShemetovDFindErrorVecMPI::ShemetovDFindErrorVecMPI(const InType &input) {
+ShemetovDFindErrorVecMPI::ShemetovDFindErrorVecMPI(InType input) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = input;
+  GetInput() = std::move(input);
   GetOutput() = 0;
 }
 
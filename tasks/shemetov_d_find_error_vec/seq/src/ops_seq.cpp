@@ -1,6 +1,7 @@
 #include "shemetov_d_find_error_vec/seq/include/ops_seq.hpp"
 
 #include <cstddef>
+#include <utility>
 #include <vector>
 
 #include "shemetov_d_find_error_vec/common/include/common.hpp"
@@ -11,9 +12,9 @@ namespace {
 constexpr double kEpsilon = 1e-10;
 }  // namespace
 
-ShemetovDFindErrorVecSEQ::ShemetovDFindErrorVecSEQ(const InType &input) {
+ShemetovDFindErrorVecSEQ::ShemetovDFindErrorVecSEQ(InType input) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = input;
+  GetInput() = std::move(input);
   GetOutput() = 0;
 }
 
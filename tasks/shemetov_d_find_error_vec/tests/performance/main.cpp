@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <cstddef>
 #include <utility>
 
 #include "shemetov_d_find_error_vec/common/include/common.hpp"
@@ -23,15 +24,17 @@ class ShemetovDFindErrorVecPerfTests : public ppc::util::BaseRunPerfTests<InType
   }
 
   bool CheckTestOutputData(OutType &output) final {
-    return (output >= 0) && std::cmp_less_equal(output, inputData_.size());
+    return (output >= 0) && std::cmp_less_equal(output, inputSize_);
   }
 
   InType GetTestInputData() final {
-    return inputData_;
+    inputSize_ = inputData_.size();
+    return std::move(inputData_);
   }
 
  private:
   InType inputData_;
+  std::size_t inputSize_ = 0;
 };
 
 TEST_P(ShemetovDFindErrorVecPerfTests, RunPerformanceModes) {
@@ -5,18 +5,19 @@
 #include <algorithm>
 #include <cstddef>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "shilin_n_counting_number_sentences_in_line/common/include/common.hpp"
 
 namespace shilin_n_counting_number_sentences_in_line {
 
-ShilinNCountingNumberSentencesInLineMPI::ShilinNCountingNumberSentencesInLineMPI(const InType &in) {
+ShilinNCountingNumberSentencesInLineMPI::ShilinNCountingNumberSentencesInLineMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   int rank = 0;
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
   if (rank == 0) {
-    GetInput() = in;
+    GetInput() = std::move(in);
   }
   GetOutput() = 0;
 }
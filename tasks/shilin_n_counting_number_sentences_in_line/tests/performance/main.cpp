@@ -3,6 +3,7 @@
 #include <array>
 #include <cstddef>
 #include <random>
+#include <utility>
 
 #include "shilin_n_counting_number_sentences_in_line/common/include/common.hpp"
 #include "shilin_n_counting_number_sentences_in_line/mpi/include/ops_mpi.hpp"
@@ -51,7 +52,7 @@ class ShilinNCountingNumberSentencesInLinePerfTests : public ppc::util::BaseRunP
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 };
 
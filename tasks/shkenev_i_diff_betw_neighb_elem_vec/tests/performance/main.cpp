@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cmath>
 #include <random>
+#include <utility>
 
 #include "shkenev_i_diff_betw_neighb_elem_vec/common/include/common.hpp"
 #include "shkenev_i_diff_betw_neighb_elem_vec/mpi/include/ops_mpi.hpp"
@@ -43,7 +44,7 @@ class ShkenevIDiffBetwNeighbElemVecPerfTests : public ppc::util::BaseRunPerfTest
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 
  private:
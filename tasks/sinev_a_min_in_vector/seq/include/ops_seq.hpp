@@ -10,7 +10,7 @@ class SinevAMinInVectorSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit SinevAMinInVectorSEQ(const InType &in);
+  explicit SinevAMinInVectorSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <random>
+#include <utility>
 
 #include "sinev_a_min_in_vector/common/include/common.hpp"
 #include "sinev_a_min_in_vector/mpi/include/ops_mpi.hpp"
@@ -36,7 +37,7 @@ class SinevAMinInVectorPerfTests : public ppc::util::BaseRunPerfTests<InType, Ou
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 };
 
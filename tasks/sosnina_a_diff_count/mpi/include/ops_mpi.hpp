@@ -24,6 +24,9 @@ class SosninaADiffCountMPI : public BaseTask {
   bool PostProcessingImpl() override;
   std::string str1_;
   std::string str2_;
+  std::string local_str1_;
+  std::string local_str2_;
+  int len_diff_ = 0;
   int diff_counter_ = 0;
 };
 
@@ -4,10 +4,12 @@
 
 #include <algorithm>
 #include <array>
-#include <cstddef>
+#include <cstdlib>
 #include <utility>
+#include <vector>
 
 #include "sosnina_a_diff_count/common/include/common.hpp"
+#include "util/include/byte_compare.hpp"
 
 namespace sosnina_a_diff_count {
 
@@ -50,52 +52,37 @@ bool SosninaADiffCountMPI::PreProcessingImpl() {
   }
 
   MPI_Bcast(lengths.data(), 2, MPI_INT, 0, MPI_COMM_WORLD);
-
-  if (rank != 0) {
-    str1_.resize(lengths[0]);
-    str2_.resize(lengths[1]);
+  len_diff_ = std::abs(lengths[0] - lengths[1]);
+
+  // хвост длинной строки целиком состоит из несовпадений, рассылаем только общую часть
+  const int common_len = std::min(lengths[0], lengths[1]);
+  const int chunk_size = common_len / size;
+  const int remainder = common_len % size;
+
+  std::vector<int> counts(size);
+  std::vector<int> displs(size);
+  for (int i = 0, offset = 0; i < size; i++) {
+    counts[i] = chunk_size + (i < remainder ? 1 : 0);
+    displs[i] = offset;
+    offset += counts[i];
   }
 
-  MPI_Bcast(str1_.data(), lengths[0], MPI_CHAR, 0, MPI_COMM_WORLD);
-  MPI_Bcast(str2_.data(), lengths[1], MPI_CHAR, 0, MPI_COMM_WORLD);
+  local_str1_.resize(counts[rank]);
+  local_str2_.resize(counts[rank]);
+  MPI_Scatterv(str1_.data(), counts.data(), displs.data(), MPI_CHAR, local_str1_.data(), counts[rank], MPI_CHAR, 0,
+               MPI_COMM_WORLD);
+  MPI_Scatterv(str2_.data(), counts.data(), displs.data(), MPI_CHAR, local_str2_.data(), counts[rank], MPI_CHAR, 0,
+               MPI_COMM_WORLD);
 
   return true;
 }
 
 bool SosninaADiffCountMPI::RunImpl() {
-  int rank = 0;
-  int size = 1;
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-  MPI_Comm_size(MPI_COMM_WORLD, &size);
-
-  std::size_t str1_len = str1_.size();
-  std::size_t str2_len = str2_.size();
-  std::size_t total_len = std::max(str1_len, str2_len);
-
-  if (total_len == 0) {
-    diff_counter_ = 0;
-    return true;
-  }
-
-  std::size_t chunk_size = total_len / size;
-  std::size_t remainder = total_len % size;
-
-  std::size_t start = (rank * chunk_size) + std::min(static_cast<std::size_t>(rank), remainder);
-  std::size_t end = start + chunk_size;
-  if (std::cmp_less(rank, remainder)) {
-    end += 1;
-  }
-
   // подсчёт несовпадений на своём отрезке
-  int local_diff_count = 0;
-  for (std::size_t i = start; i < end && i < total_len; i++) {
-    if (i >= str1_len || i >= str2_len || str1_[i] != str2_[i]) {
-      local_diff_count++;
-    }
-  }
+  int local_diff_count = static_cast<int>(ppc::util::CountMismatches(local_str1_, local_str2_));
 
-  MPI_Reduce(&local_diff_count, &diff_counter_, 1, MPI_INT, MPI_SUM, 0, MPI_COMM_WORLD);
-  MPI_Bcast(&diff_counter_, 1, MPI_INT, 0, MPI_COMM_WORLD);
+  MPI_Allreduce(&local_diff_count, &diff_counter_, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  diff_counter_ += len_diff_;
   GetOutput() = diff_counter_;
 
   return true;
@@ -6,6 +6,7 @@
 #include <utility>
 
 #include "sosnina_a_diff_count/common/include/common.hpp"
+#include "util/include/byte_compare.hpp"
 
 namespace sosnina_a_diff_count {
 
@@ -28,13 +29,9 @@ bool SosninaADiffCountSEQ::RunImpl() {
   const std::string &str2 = input_.second;
 
   std::size_t total_len = std::max(str1.size(), str2.size());
-  diff_counter_ = 0;
+  std::size_t common_len = std::min(str1.size(), str2.size());
 
-  for (std::size_t i = 0; i < total_len; i++) {
-    if (i >= str1.size() || i >= str2.size() || str1[i] != str2[i]) {
-      diff_counter_++;
-    }
-  }
+  diff_counter_ = static_cast<int>(ppc::util::CountMismatches(str1, str2) + (total_len - common_len));
 
   return true;
 }
@@ -27,7 +27,7 @@ class SosninaADiffCountRunPerfTests : public ppc::util::BaseRunPerfTests<InType,
   }
 
   InType GetTestInputData() final {
-    return std::make_pair(str1_, str2_);
+    return std::make_pair(std::move(str1_), std::move(str2_));
   }
 
  private:
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <vector>
+
+#include "sosnina_a_matrix_mult_horizontal/common/include/common.hpp"
+#include "task/include/task.hpp"
+#include "util/include/first_touch.hpp"
+
+namespace sosnina_a_matrix_mult_horizontal {
+
+// Гибридная версия: полосы строк A распределяются между процессами через MPI, матрица B хранится в одном
+// экземпляре на узел (общая память MPI), а строки своей полосы процесс считает в OpenMP-потоках.
+class SosninaAMatrixMultHorizontalALL : public BaseTask {
+ public:
+  static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
+    return ppc::task::TypeOfTask::kALL;
+  }
+
+  explicit SosninaAMatrixMultHorizontalALL(InType in);
+
+ private:
+  bool ValidationImpl() override;
+  bool PreProcessingImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+  void ComputeRowCounts(std::vector<int> &row_counts, std::vector<int> &row_displs, int rows_a) const;
+  static void ComputeLocalRows(const ppc::util::FirstTouchVector<double> &local_a_flat, const double *b_flat,
+                               ppc::util::FirstTouchVector<double> &local_result_flat, int local_rows, int cols_a,
+                               int cols_b);
+  void ConvertToMatrix(const std::vector<double> &result_flat, int rows_a, int cols_b);
+
+  std::vector<std::vector<double>> matrix_A_;
+  std::vector<std::vector<double>> matrix_B_;
+  int rank_ = 0;
+  int world_size_ = 1;
+};
+
+}  // namespace sosnina_a_matrix_mult_horizontal
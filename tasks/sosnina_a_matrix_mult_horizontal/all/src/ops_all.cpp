@@ -0,0 +1,160 @@
+#include "sosnina_a_matrix_mult_horizontal/all/include/ops_all.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "sosnina_a_matrix_mult_horizontal/common/include/common.hpp"
+#include "task/include/hybrid.hpp"
+#include "util/include/first_touch.hpp"
+#include "util/include/util.hpp"
+
+namespace sosnina_a_matrix_mult_horizontal {
+
+SosninaAMatrixMultHorizontalALL::SosninaAMatrixMultHorizontalALL(InType in) {
+  SetTypeOfTask(GetStaticTypeOfTask());
+  GetOutput() = std::vector<std::vector<double>>();
+
+  int rank = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  if (rank == 0) {
+    matrix_A_ = std::move(in.first);
+    matrix_B_ = std::move(in.second);
+  }
+}
+
+bool SosninaAMatrixMultHorizontalALL::ValidationImpl() {
+  int mpi_initialized = 0;
+  MPI_Initialized(&mpi_initialized);
+  return mpi_initialized != 0;
+}
+
+bool SosninaAMatrixMultHorizontalALL::PreProcessingImpl() {
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank_);
+  MPI_Comm_size(MPI_COMM_WORLD, &world_size_);
+  GetOutput() = std::vector<std::vector<double>>();
+  return true;
+}
+
+bool SosninaAMatrixMultHorizontalALL::RunImpl() {
+  std::array<int, 4> sizes{};
+  if (rank_ == 0) {
+    sizes[0] = static_cast<int>(matrix_A_.size());
+    sizes[1] = sizes[0] > 0 ? static_cast<int>(matrix_A_[0].size()) : 0;
+    sizes[2] = static_cast<int>(matrix_B_.size());
+    sizes[3] = sizes[2] > 0 ? static_cast<int>(matrix_B_[0].size()) : 0;
+  }
+  MPI_Bcast(sizes.data(), 4, MPI_INT, 0, MPI_COMM_WORLD);
+
+  const auto [rows_a, cols_a, rows_b, cols_b] = sizes;
+  if (cols_a != rows_b || rows_a == 0 || cols_a == 0 || cols_b == 0) {
+    return true;
+  }
+
+  // B нужна целиком каждому процессу: храним её один раз на узел, по сети она идёт только между узлами
+  const ppc::task::NodeComm node_comm;
+  ppc::task::NodeSharedArray<double> b_shared(node_comm, static_cast<size_t>(rows_b) * static_cast<size_t>(cols_b));
+  if (rank_ == 0) {
+    auto b_flat = b_shared.Data();
+    for (int i = 0; i < rows_b; ++i) {
+      std::ranges::copy(matrix_B_[i], b_flat.begin() + static_cast<std::ptrdiff_t>(i) * cols_b);
+    }
+  }
+  b_shared.BroadcastFromRoot();
+
+  std::vector<int> row_counts;
+  std::vector<int> row_displs;
+  ComputeRowCounts(row_counts, row_displs, rows_a);
+
+  std::vector<int> a_counts(world_size_);
+  std::vector<int> a_displs(world_size_);
+  for (int i = 0; i < world_size_; ++i) {
+    a_counts[i] = row_counts[i] * cols_a;
+    a_displs[i] = row_displs[i] * cols_a;
+  }
+
+  std::vector<double> a_flat;
+  if (rank_ == 0) {
+    a_flat.resize(static_cast<size_t>(rows_a) * static_cast<size_t>(cols_a));
+    for (int i = 0; i < rows_a; ++i) {
+      std::ranges::copy(matrix_A_[i], a_flat.begin() + static_cast<std::ptrdiff_t>(i) * cols_a);
+    }
+  }
+
+  // Полосы A и C размещаются в памяти тех потоков, которые будут считать их строки
+  const int local_rows = row_counts[rank_];
+  auto local_a_flat = ppc::util::MakeFirstTouchVector(static_cast<size_t>(local_rows) * static_cast<size_t>(cols_a),
+                                                      0.0, static_cast<size_t>(cols_a));
+  MPI_Scatterv(a_flat.data(), a_counts.data(), a_displs.data(), MPI_DOUBLE, local_a_flat.data(), a_counts[rank_],
+               MPI_DOUBLE, 0, MPI_COMM_WORLD);
+
+  auto local_result_flat = ppc::util::MakeFirstTouchVector(
+      static_cast<size_t>(local_rows) * static_cast<size_t>(cols_b), 0.0, static_cast<size_t>(cols_b));
+  ComputeLocalRows(local_a_flat, b_shared.Data().data(), local_result_flat, local_rows, cols_a, cols_b);
+
+  std::vector<int> c_counts(world_size_);
+  std::vector<int> c_displs(world_size_);
+  for (int i = 0; i < world_size_; ++i) {
+    c_counts[i] = row_counts[i] * cols_b;
+    c_displs[i] = row_displs[i] * cols_b;
+  }
+
+  std::vector<double> result_flat(static_cast<size_t>(rows_a) * static_cast<size_t>(cols_b));
+  MPI_Allgatherv(local_result_flat.data(), c_counts[rank_], MPI_DOUBLE, result_flat.data(), c_counts.data(),
+                 c_displs.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+
+  ConvertToMatrix(result_flat, rows_a, cols_b);
+  return true;
+}
+
+void SosninaAMatrixMultHorizontalALL::ComputeRowCounts(std::vector<int> &row_counts, std::vector<int> &row_displs,
+                                                       int rows_a) const {
+  row_counts.assign(world_size_, rows_a / world_size_);
+  row_displs.assign(world_size_, 0);
+  for (int i = 0; i < rows_a % world_size_; ++i) {
+    row_counts[i]++;
+  }
+  for (int i = 1; i < world_size_; ++i) {
+    row_displs[i] = row_displs[i - 1] + row_counts[i - 1];
+  }
+}
+
+void SosninaAMatrixMultHorizontalALL::ComputeLocalRows(const ppc::util::FirstTouchVector<double> &local_a_flat,
+                                                       const double *b_flat,
+                                                       ppc::util::FirstTouchVector<double> &local_result_flat,
+                                                       int local_rows, int cols_a, int cols_b) {
+#pragma omp parallel for default(none) shared(local_a_flat, b_flat, local_result_flat, local_rows, cols_a, cols_b) \
+    num_threads(ppc::util::GetNumThreads()) schedule(static)
+  for (int i = 0; i < local_rows; ++i) {
+    const double *a_row = &local_a_flat[static_cast<size_t>(i) * static_cast<size_t>(cols_a)];
+    double *result_row = &local_result_flat[static_cast<size_t>(i) * static_cast<size_t>(cols_b)];
+
+    for (int k = 0; k < cols_a; ++k) {
+      const double aik = a_row[k];
+      const double *b_row = b_flat + (static_cast<size_t>(k) * static_cast<size_t>(cols_b));
+      for (int j = 0; j < cols_b; ++j) {
+        result_row[j] += aik * b_row[j];
+      }
+    }
+  }
+}
+
+void SosninaAMatrixMultHorizontalALL::ConvertToMatrix(const std::vector<double> &result_flat, int rows_a, int cols_b) {
+  auto &output = GetOutput();
+  output.assign(rows_a, std::vector<double>(cols_b));
+  for (int i = 0; i < rows_a; ++i) {
+    const auto row_begin = result_flat.begin() + static_cast<std::ptrdiff_t>(i) * cols_b;
+    std::copy(row_begin, row_begin + cols_b, output[i].begin());
+  }
+}
+
+bool SosninaAMatrixMultHorizontalALL::PostProcessingImpl() {
+  return true;
+}
+
+}  // namespace sosnina_a_matrix_mult_horizontal
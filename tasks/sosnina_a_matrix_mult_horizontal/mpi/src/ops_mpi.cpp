@@ -5,13 +5,14 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <utility>
 #include <vector>
 
 #include "sosnina_a_matrix_mult_horizontal/common/include/common.hpp"
 
 namespace sosnina_a_matrix_mult_horizontal {
 
-SosninaAMatrixMultHorizontalMPI::SosninaAMatrixMultHorizontalMPI(const InType &in) {
+SosninaAMatrixMultHorizontalMPI::SosninaAMatrixMultHorizontalMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetOutput() = std::vector<std::vector<double>>();
 
@@ -19,8 +20,8 @@ SosninaAMatrixMultHorizontalMPI::SosninaAMatrixMultHorizontalMPI(const InType &i
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 
   if (rank == 0) {
-    matrix_A_ = in.first;
-    matrix_B_ = in.second;
+    matrix_A_ = std::move(in.first);
+    matrix_B_ = std::move(in.second);
   }
 }
 
@@ -8,6 +8,7 @@
 #include <utility>
 #include <vector>
 
+#include "sosnina_a_matrix_mult_horizontal/all/include/ops_all.hpp"
 #include "sosnina_a_matrix_mult_horizontal/common/include/common.hpp"
 #include "sosnina_a_matrix_mult_horizontal/mpi/include/ops_mpi.hpp"
 #include "sosnina_a_matrix_mult_horizontal/seq/include/ops_seq.hpp"
@@ -213,12 +214,16 @@ const auto kFunctionalTasksList =
     std::tuple_cat(ppc::util::AddFuncTask<sosnina_a_matrix_mult_horizontal::SosninaAMatrixMultHorizontalMPI, InType>(
                        kFunctionalTests, PPC_SETTINGS_sosnina_a_matrix_mult_horizontal),
                    ppc::util::AddFuncTask<sosnina_a_matrix_mult_horizontal::SosninaAMatrixMultHorizontalSEQ, InType>(
+                       kFunctionalTests, PPC_SETTINGS_sosnina_a_matrix_mult_horizontal),
+                   ppc::util::AddFuncTask<sosnina_a_matrix_mult_horizontal::SosninaAMatrixMultHorizontalALL, InType>(
                        kFunctionalTests, PPC_SETTINGS_sosnina_a_matrix_mult_horizontal));
 
 const auto kCoverageTasksList =
     std::tuple_cat(ppc::util::AddFuncTask<sosnina_a_matrix_mult_horizontal::SosninaAMatrixMultHorizontalMPI, InType>(
                        kCoverageTests, PPC_SETTINGS_sosnina_a_matrix_mult_horizontal),
                    ppc::util::AddFuncTask<sosnina_a_matrix_mult_horizontal::SosninaAMatrixMultHorizontalSEQ, InType>(
+                       kCoverageTests, PPC_SETTINGS_sosnina_a_matrix_mult_horizontal),
+                   ppc::util::AddFuncTask<sosnina_a_matrix_mult_horizontal::SosninaAMatrixMultHorizontalALL, InType>(
                        kCoverageTests, PPC_SETTINGS_sosnina_a_matrix_mult_horizontal));
 
 inline const auto kFunctionalGtestValues = ppc::util::ExpandToValues(kFunctionalTasksList);
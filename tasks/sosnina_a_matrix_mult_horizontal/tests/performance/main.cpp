@@ -4,9 +4,11 @@
 #include <utility>
 #include <vector>
 
+#include "sosnina_a_matrix_mult_horizontal/all/include/ops_all.hpp"
 #include "sosnina_a_matrix_mult_horizontal/common/include/common.hpp"
 #include "sosnina_a_matrix_mult_horizontal/mpi/include/ops_mpi.hpp"
 #include "sosnina_a_matrix_mult_horizontal/seq/include/ops_seq.hpp"
+#include "performance/include/result_sink.hpp"
 #include "util/include/perf_test_util.hpp"
 
 namespace sosnina_a_matrix_mult_horizontal {
@@ -17,28 +19,46 @@ class SosninaAMatrixMultHorizontalRunPerfTests : public ppc::util::BaseRunPerfTe
 
  protected:
   void SetUp() override {
-    matrix_a_ = std::vector<std::vector<double>>(kSize, std::vector<double>(kSize));
+    // при слабом масштабировании растёт число строк A: работа пропорциональна числу строк
+    const size_t rows_a = kSize * static_cast<size_t>(GetProblemScale());
+    matrix_a_ = std::vector<std::vector<double>>(rows_a, std::vector<double>(kSize));
     matrix_b_ = std::vector<std::vector<double>>(kSize, std::vector<double>(kSize));
 
-    for (size_t i = 0; i < kSize; ++i) {
+    for (size_t i = 0; i < rows_a; ++i) {
       for (size_t j = 0; j < kSize; ++j) {
         matrix_a_[i][j] = static_cast<double>((i * kSize) + j) * 0.001;
+      }
+    }
+    for (size_t i = 0; i < kSize; ++i) {
+      for (size_t j = 0; j < kSize; ++j) {
         matrix_b_[i][j] = static_cast<double>(i + j) * 0.002;
       }
     }
   }
 
+  [[nodiscard]] bool SupportsProblemScale() const final {
+    return true;
+  }
+
   bool CheckTestOutputData(OutType &output_data) final {
     return !output_data.empty();
   }
 
   InType GetTestInputData() final {
-    return std::make_pair(matrix_a_, matrix_b_);
+    rows_a_ = matrix_a_.size();
+    return std::make_pair(std::move(matrix_a_), std::move(matrix_b_));
+  }
+
+  // одно умножение-сложение на каждую тройку (i, j, k)
+  [[nodiscard]] ppc::performance::WorkAmount GetWorkAmount() const final {
+    const double flops = 2.0 * static_cast<double>(rows_a_) * static_cast<double>(kSize * kSize);
+    return {.count = flops / 1e9, .unit = "GFLOP"};
   }
 
  private:
   std::vector<std::vector<double>> matrix_a_;
   std::vector<std::vector<double>> matrix_b_;
+  size_t rows_a_ = 0;
 };
 
 TEST_P(SosninaAMatrixMultHorizontalRunPerfTests, RunPerfModes) {
@@ -46,8 +66,8 @@ TEST_P(SosninaAMatrixMultHorizontalRunPerfTests, RunPerfModes) {
 }
 
 const auto kAllPerfTasks =
-    ppc::util::MakeAllPerfTasks<InType, SosninaAMatrixMultHorizontalMPI, SosninaAMatrixMultHorizontalSEQ>(
-        PPC_SETTINGS_sosnina_a_matrix_mult_horizontal);
+    ppc::util::MakeAllPerfTasks<InType, SosninaAMatrixMultHorizontalALL, SosninaAMatrixMultHorizontalMPI,
+                                SosninaAMatrixMultHorizontalSEQ>(PPC_SETTINGS_sosnina_a_matrix_mult_horizontal);
 const auto kGtestValues = ppc::util::TupleToGTestValues(kAllPerfTasks);
 
 const auto kPerfTestName = SosninaAMatrixMultHorizontalRunPerfTests::CustomPerfTestName;
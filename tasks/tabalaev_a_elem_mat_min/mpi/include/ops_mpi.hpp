@@ -10,7 +10,7 @@ class TabalaevAElemMatMinMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit TabalaevAElemMatMinMPI(const InType &in);
+  explicit TabalaevAElemMatMinMPI(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -2,15 +2,16 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <utility>
 #include <vector>
 
 #include "tabalaev_a_elem_mat_min/common/include/common.hpp"
 
 namespace tabalaev_a_elem_mat_min {
 
-TabalaevAElemMatMinSEQ::TabalaevAElemMatMinSEQ(const InType &in) {
+TabalaevAElemMatMinSEQ::TabalaevAElemMatMinSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0;
 }
 
@@ -2,16 +2,19 @@
 
 #include <mpi.h>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <string>
 #include <utility>
 
 #include "timofeev_n_lexicographic_ordering/common/include/common.hpp"
 
 namespace timofeev_n_lexicographic_ordering {
 
-TimofeevNLexicographicOrderingMPI::TimofeevNLexicographicOrderingMPI(const InType &in) {
+TimofeevNLexicographicOrderingMPI::TimofeevNLexicographicOrderingMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = std::pair<int, int>(1, 1);
 }
 
@@ -30,44 +33,31 @@ bool TimofeevNLexicographicOrderingMPI::RunImpl() {
   MPI_Comm_size(MPI_COMM_WORLD, &size);
   GetOutput() = std::pair<int, int>(1, 1);
 
+  const auto &input = GetInput();
   if (size <= 1) {
-    auto input = GetInput();
-    for (size_t i = 0; !input.first.empty() && i < input.first.length() - 1; i++) {
-      GetOutput().first &= static_cast<int>(input.first[i] <= input.first[i + 1]);
-    }
-    for (size_t i = 0; !input.second.empty() && i < input.second.length() - 1; i++) {
-      GetOutput().second &= static_cast<int>(input.second[i] <= input.second[i + 1]);
-    }
+    GetOutput().first = static_cast<int>(std::ranges::is_sorted(input.first));
+    GetOutput().second = static_cast<int>(std::ranges::is_sorted(input.second));
     return true;
   }
 
   if (rank == 0) {
-    auto input = GetInput();
-    size_t second_length = input.second.length();
-    MPI_Send(&second_length, 1, MPI_UNSIGNED_LONG, 1, 0, MPI_COMM_WORLD);
-    MPI_Send(input.second.c_str(), static_cast<int>(second_length), MPI_CHAR, 1, 1, MPI_COMM_WORLD);
+    std::uint64_t second_length = input.second.length();
+    MPI_Send(&second_length, 1, MPI_UINT64_T, 1, 0, MPI_COMM_WORLD);
+    // the second string is sent straight from the input, without an intermediate copy
+    MPI_Send(input.second.data(), static_cast<int>(second_length), MPI_CHAR, 1, 1, MPI_COMM_WORLD);
     // only true if comparison is true on every step
-    for (size_t i = 0; !input.first.empty() && i < input.first.length() - 1; i++) {
-      GetOutput().first &= static_cast<int>(input.first[i] <= input.first[i + 1]);
-    }
+    GetOutput().first = static_cast<int>(std::ranges::is_sorted(input.first));
   } else if (rank == 1) {
-    size_t llength = 0;
-    // если упадёт на каких-то мудрёных тестах - может быть, дело в size_t
-    MPI_Recv(&llength, 1, MPI_UNSIGNED_LONG, 0, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-    char *inpput = new char[(llength + 1) * sizeof(char)];
-    inpput[llength] = '\0';
-    MPI_Recv(inpput, static_cast<int>(llength), MPI_CHAR, 0, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-    for (size_t i = 0; llength != 0 && i < llength - 1; i++) {
-      GetOutput().second &= static_cast<int>(inpput[i] <= inpput[i + 1]);
-    }
-    delete[] inpput;
+    std::uint64_t llength = 0;
+    MPI_Recv(&llength, 1, MPI_UINT64_T, 0, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    std::string second(static_cast<std::size_t>(llength), '\0');
+    MPI_Recv(second.data(), static_cast<int>(llength), MPI_CHAR, 0, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    GetOutput().second = static_cast<int>(std::ranges::is_sorted(second));
   }
 
   MPI_Bcast(&GetOutput().first, 1, MPI_INT, 0, MPI_COMM_WORLD);
   MPI_Bcast(&GetOutput().second, 1, MPI_INT, 1, MPI_COMM_WORLD);
 
-  MPI_Barrier(MPI_COMM_WORLD);
-
   return true;
 }
 
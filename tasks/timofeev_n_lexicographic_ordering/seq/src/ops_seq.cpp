@@ -1,15 +1,15 @@
 #include "timofeev_n_lexicographic_ordering/seq/include/ops_seq.hpp"
 
-#include <cstddef>
+#include <algorithm>
 #include <utility>
 
 #include "timofeev_n_lexicographic_ordering/common/include/common.hpp"
 
 namespace timofeev_n_lexicographic_ordering {
 
-TimofeevNLexicographicOrderingSEQ::TimofeevNLexicographicOrderingSEQ(const InType &in) {
+TimofeevNLexicographicOrderingSEQ::TimofeevNLexicographicOrderingSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = std::pair<int, int>(1, 1);
 }
 
@@ -22,15 +22,11 @@ bool TimofeevNLexicographicOrderingSEQ::PreProcessingImpl() {
 }
 
 bool TimofeevNLexicographicOrderingSEQ::RunImpl() {
-  auto input = GetInput();
+  const auto &input = GetInput();
 
   // only true if comparison is true on every step
-  for (size_t i = 0; !input.first.empty() && i < input.first.length() - 1; i++) {
-    GetOutput().first &= static_cast<int>(input.first[i] <= input.first[i + 1]);
-  }
-  for (size_t i = 0; !input.second.empty() && i < input.second.length() - 1; i++) {
-    GetOutput().second &= static_cast<int>(input.second[i] <= input.second[i + 1]);
-  }
+  GetOutput().first = static_cast<int>(std::ranges::is_sorted(input.first));
+  GetOutput().second = static_cast<int>(std::ranges::is_sorted(input.second));
 
   return true;
 }
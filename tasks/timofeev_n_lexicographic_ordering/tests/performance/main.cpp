@@ -30,7 +30,7 @@ class LexicographicRunPerfTestProcesses : public ppc::util::BaseRunPerfTests<InT
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 };
 
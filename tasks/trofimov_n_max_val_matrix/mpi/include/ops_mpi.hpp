@@ -10,7 +10,7 @@ class TrofimovNMaxValMatrixMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit TrofimovNMaxValMatrixMPI(const InType &in);
+  explicit TrofimovNMaxValMatrixMPI(InType in);
 
  private:
   bool ValidationImpl() override;
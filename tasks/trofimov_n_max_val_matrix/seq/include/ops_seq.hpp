@@ -10,7 +10,7 @@ class TrofimovNMaxValMatrixSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit TrofimovNMaxValMatrixSEQ(const InType &in);
+  explicit TrofimovNMaxValMatrixSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <utility>
 #include <vector>
 
 #include "trofimov_n_max_val_matrix/common/include/common.hpp"
@@ -70,7 +71,7 @@ class MaxValMatrixRunPerfTestProcesses : public ppc::util::BaseRunPerfTests<InTy
   }
 
   InType GetTestInputData() final {
-    return input_data;
+    return std::move(input_data);
   }
 };
 
@@ -13,7 +13,7 @@ class TsyplakovKVecNeighboursSEQ : public BaseTask {
     return ppc::task::TypeOfTask::kSEQ;
   }
 
-  explicit TsyplakovKVecNeighboursSEQ(const InType &in);
+  explicit TsyplakovKVecNeighboursSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
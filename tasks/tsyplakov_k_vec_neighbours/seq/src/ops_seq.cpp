@@ -12,9 +12,9 @@
 
 namespace tsyplakov_k_vec_neighbours {
 
-TsyplakovKVecNeighboursSEQ::TsyplakovKVecNeighboursSEQ(const InType &in) {
+TsyplakovKVecNeighboursSEQ::TsyplakovKVecNeighboursSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = std::make_tuple(-1, -1);
 }
 
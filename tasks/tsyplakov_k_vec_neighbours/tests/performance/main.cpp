@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <cstddef>
 #include <utility>
 #include <vector>
 
@@ -14,13 +15,14 @@ class TsyplakovKVecNeighboursPerfTest : public ppc::util::BaseRunPerfTests<InTyp
  protected:
   static const int kCount = 150000000;
   InType input_data;
+  std::size_t input_size = 0;
 
   void SetUp() override {
     std::vector<int> vec(kCount);
     for (int i = 0; i < kCount; ++i) {
       vec[i] = i;
     }
-    input_data = vec;
+    input_data = std::move(vec);
   }
 
   bool CheckTestOutputData(OutType &output_data) final {
@@ -29,7 +31,7 @@ class TsyplakovKVecNeighboursPerfTest : public ppc::util::BaseRunPerfTests<InTyp
     if (i2 != i1 + 1) {
       return false;
     }
-    if (i1 < 0 || std::cmp_greater_equal(i2, input_data.size())) {
+    if (i1 < 0 || std::cmp_greater_equal(i2, input_size)) {
       return false;
     }
 
@@ -37,7 +39,8 @@ class TsyplakovKVecNeighboursPerfTest : public ppc::util::BaseRunPerfTests<InTyp
   }
 
   InType GetTestInputData() final {
-    return input_data;
+    input_size = input_data.size();
+    return std::move(input_data);
   }
 };
 
@@ -69,7 +69,7 @@ class VasilievMVecSignsPerfTests : public ppc::util::BaseRunPerfTests<InType, Ou
   InType GetTestInputData() final {
     input_data_ = test_vectors_[0].first;
     expected_output_ = test_vectors_[0].second;
-    return input_data_;
+    return std::move(input_data_);
   }
 };
 
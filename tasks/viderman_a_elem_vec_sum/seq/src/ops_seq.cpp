@@ -1,14 +1,15 @@
 #include "viderman_a_elem_vec_sum/seq/include/ops_seq.hpp"
 
 #include <numeric>
+#include <utility>
 
 #include "viderman_a_elem_vec_sum/common/include/common.hpp"
 
 namespace viderman_a_elem_vec_sum {
 
-VidermanAElemVecSumSEQ::VidermanAElemVecSumSEQ(const InType &in) {
+VidermanAElemVecSumSEQ::VidermanAElemVecSumSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0.0;
 }
 
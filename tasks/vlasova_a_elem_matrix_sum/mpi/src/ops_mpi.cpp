@@ -5,27 +5,25 @@
 #include <algorithm>
 #include <cstddef>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "vlasova_a_elem_matrix_sum/common/include/common.hpp"
 
 namespace vlasova_a_elem_matrix_sum {
 
-VlasovaAElemMatrixSumMPI::VlasovaAElemMatrixSumMPI(const InType &in) {
+VlasovaAElemMatrixSumMPI::VlasovaAElemMatrixSumMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
   GetOutput() = {};
 
   int rank = 0;
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 
-  std::vector<int> empty_data;
-  InType processed_input = std::make_tuple(empty_data, std::get<1>(in), std::get<2>(in));
-
-  if (rank == 0) {
-    GetInput() = in;
-  } else {
-    GetInput() = processed_input;
+  // Матрица нужна только нулевому процессу, остальным достаточно размеров
+  if (rank != 0) {
+    std::get<0>(in).clear();
   }
+  GetInput() = std::move(in);
 }
 
 bool VlasovaAElemMatrixSumMPI::ValidationImpl() {
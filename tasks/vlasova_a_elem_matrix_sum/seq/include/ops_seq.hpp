@@ -10,7 +10,7 @@ class VlasovaAElemMatrixSumSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit VlasovaAElemMatrixSumSEQ(const InType &in);
+  explicit VlasovaAElemMatrixSumSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
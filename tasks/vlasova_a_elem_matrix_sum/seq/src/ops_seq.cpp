@@ -1,15 +1,16 @@
 #include "vlasova_a_elem_matrix_sum/seq/include/ops_seq.hpp"
 
 #include <cstddef>
+#include <utility>
 #include <vector>
 
 #include "vlasova_a_elem_matrix_sum/common/include/common.hpp"
 
 namespace vlasova_a_elem_matrix_sum {
 
-VlasovaAElemMatrixSumSEQ::VlasovaAElemMatrixSumSEQ(const InType &in) {
+VlasovaAElemMatrixSumSEQ::VlasovaAElemMatrixSumSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = {};
 }
 
@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "util/include/perf_test_util.hpp"
@@ -47,7 +48,7 @@ class VlasovaAElemMatrixSumPerfTests : public ppc::util::BaseRunPerfTests<InType
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 };
 
@@ -12,7 +12,7 @@ class ZaharovGMatrixColSumMPI : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kMPI;
   }
-  explicit ZaharovGMatrixColSumMPI(const InType &in);
+  explicit ZaharovGMatrixColSumMPI(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -11,10 +11,9 @@
 
 namespace zaharov_g_matrix_col_sum {
 
-ZaharovGMatrixColSumMPI::ZaharovGMatrixColSumMPI(const InType &in) {
+ZaharovGMatrixColSumMPI::ZaharovGMatrixColSumMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  InType tmp(in);
-  GetInput().swap(tmp);
+  GetInput() = std::move(in);
 }
 
 bool ZaharovGMatrixColSumMPI::ValidationImpl() {
@@ -10,7 +10,7 @@ class ZaharovGMatrixColSumSEQ : public BaseTask {
   static constexpr ppc::task::TypeOfTask GetStaticTypeOfTask() {
     return ppc::task::TypeOfTask::kSEQ;
   }
-  explicit ZaharovGMatrixColSumSEQ(const InType &in);
+  explicit ZaharovGMatrixColSumSEQ(InType in);
 
  private:
   bool ValidationImpl() override;
@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <cstddef>
+#include <utility>
 #include <vector>
 
 #include "util/include/perf_test_util.hpp"
@@ -48,7 +49,7 @@ class ZaharovGMatrixColSumPerfTestProcesses : public ppc::util::BaseRunPerfTests
   }
 
   InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 };
 
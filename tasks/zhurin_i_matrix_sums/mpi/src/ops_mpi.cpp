@@ -3,15 +3,16 @@
 #include <mpi.h>
 
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 #include "zhurin_i_matrix_sums/common/include/common.hpp"
 
 namespace zhurin_i_matrix_sums {
 
-ZhurinIMatrixSumsMPI::ZhurinIMatrixSumsMPI(const InType &in) {
+ZhurinIMatrixSumsMPI::ZhurinIMatrixSumsMPI(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0.0;
 }
 
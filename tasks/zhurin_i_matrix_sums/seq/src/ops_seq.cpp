@@ -2,15 +2,16 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 #include "zhurin_i_matrix_sums/common/include/common.hpp"
 
 namespace zhurin_i_matrix_sums {
 
-ZhurinIMatrixSumsSEQ::ZhurinIMatrixSumsSEQ(const InType &in) {
+ZhurinIMatrixSumsSEQ::ZhurinIMatrixSumsSEQ(InType in) {
   SetTypeOfTask(GetStaticTypeOfTask());
-  GetInput() = in;
+  GetInput() = std::move(in);
   GetOutput() = 0.0;
 }
 
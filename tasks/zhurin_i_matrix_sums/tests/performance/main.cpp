@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 #include "util/include/perf_test_util.hpp"
@@ -42,7 +43,7 @@ class ZhurinIMatrixSumsPerfTests : public ppc::util::BaseRunPerfTests<InType, Ou
   }
 
   [[nodiscard]] InType GetTestInputData() final {
-    return input_data_;
+    return std::move(input_data_);
   }
 };
 
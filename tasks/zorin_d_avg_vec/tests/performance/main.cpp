@@ -4,6 +4,7 @@
 #include <fstream>
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 #include "util/include/perf_test_util.hpp"
 #include "util/include/util.hpp"
@@ -45,7 +46,7 @@ class ZorinDAvgVecPerfTests : public ppc::util::BaseRunPerfTests<InType, OutType
   }
 
   InType GetTestInputData() final {
-    return input_;
+    return std::move(input_);
   }
 };
 